@@ -0,0 +1,105 @@
+#ifndef AWS_CHECKSUMS_BENCHMARK_H
+#define AWS_CHECKSUMS_BENCHMARK_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/common.h>
+
+/* exit code CTest is told to treat as "skipped" (SKIP_RETURN_CODE) */
+#define BENCHMARK_EXIT_SKIPPED 77
+
+typedef uint32_t(benchmark_crc_fn)(const uint8_t *input, int length, uint32_t previousCrc32);
+
+struct benchmark_kernel {
+    const char *name;
+    /* the checksum the kernel computes, replay mode only feeds it calls recorded for this algorithm */
+    enum aws_checksums_crc_algorithm algorithm;
+    benchmark_crc_fn *fn;
+    /* Returns false if the host cannot execute this kernel (e.g. the instructions it uses are missing). */
+    bool (*is_available)(void);
+};
+
+struct benchmark_options {
+    struct aws_allocator *allocator;
+    /* comma separated list of kernel names to run, NULL runs every available kernel */
+    const char *kernel_filter;
+    /* bytes per call (sweep mode) or per thread buffer (scaling mode), 0 selects the mode's default */
+    size_t buffer_size;
+    /* 0 runs the single threaded size sweep, otherwise the scaling mode goes up to this many threads */
+    size_t max_threads;
+    /* cpu group (NUMA node) to place threads on, -1 for all groups */
+    int32_t numa_node;
+    bool pin_threads;
+    bool skip_smt;
+    uint64_t duration_ns;
+    /* perf gate mode: baseline file to compare against, NULL if not running the gate */
+    const char *baseline_path;
+    /* fraction a probe may fall below its baseline ratio before it counts as a regression */
+    double tolerance;
+    /* re-measure and print the baseline file with updated ratios instead of gating */
+    bool write_baseline;
+    /* replay mode: trace file recorded with AWS_CHECKSUMS_ENABLE_TRACE, NULL if not replaying */
+    const char *replay_path;
+    /* replay mode: wait out the recorded inter-arrival times instead of replaying calls back to back */
+    bool replay_paced;
+    /* time the first call of each selected kernel against a warm call instead of measuring throughput */
+    bool cold_start;
+};
+
+struct benchmark_result {
+    const char *kernel_name;
+    size_t buffer_size;
+    size_t threads;
+    double aggregate_gbps;
+    double per_thread_gbps;
+    /* aggregate throughput relative to a STREAM-style copy on the same threads, 0 if not measured */
+    double copy_efficiency;
+};
+
+extern const struct benchmark_kernel g_benchmark_kernels[];
+extern const size_t g_benchmark_kernel_count;
+
+/* Reference implementations the library is compared against (reference.c). */
+uint32_t benchmark_crc32_bitwise(const uint8_t *input, int length, uint32_t previousCrc32);
+uint32_t benchmark_crc32c_bitwise(const uint8_t *input, int length, uint32_t previousCrc32);
+#ifdef AWS_CHECKSUMS_BENCHMARK_HAVE_ZLIB
+uint32_t benchmark_zlib_crc32(const uint8_t *input, int length, uint32_t previousCrc32);
+uint32_t benchmark_zlib_crc32_z(const uint8_t *input, int length, uint32_t previousCrc32);
+bool benchmark_zlib_crc32_z_available(void);
+#endif
+
+bool benchmark_kernel_selected(const struct benchmark_options *options, const struct benchmark_kernel *kernel);
+
+/* Runs fn over the buffer back to back for at least duration_ns and returns the throughput in GB/s. */
+double benchmark_measure_gbps(benchmark_crc_fn *fn, const uint8_t *buffer, size_t length, uint64_t duration_ns);
+
+void benchmark_print_header(void);
+void benchmark_print_result(const struct benchmark_result *result);
+
+/* Multi-core scaling mode: aggregate/per thread throughput and efficiency against copy bandwidth as N grows. */
+int benchmark_run_scaling(const struct benchmark_options *options);
+
+/*
+ * Perf regression gate: probes every kernel listed in the baseline file and compares its throughput relative to an
+ * in-process memcpy against the stored ratio. Returns the process exit code: 0 on pass, 1 on a regression, or
+ * BENCHMARK_EXIT_SKIPPED if none of the listed kernels can run on this host.
+ */
+int benchmark_run_perf_gate(const struct benchmark_options *options);
+
+/*
+ * Trace replay: re-executes the calls of a recorded trace (same lengths and alignments) against every selected
+ * kernel of the matching algorithm and reports the throughput in the usual format, size being the mean call size.
+ */
+int benchmark_run_replay(const struct benchmark_options *options);
+
+/*
+ * Cold start: latency of the first call of each selected kernel in the process next to its best warm call, for
+ * comparing table layouts and build options on short lived processes.
+ */
+int benchmark_run_cold_start(const struct benchmark_options *options);
+
+#endif /* AWS_CHECKSUMS_BENCHMARK_H */
@@ -0,0 +1,72 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark.h"
+
+#include <aws/common/clock.h>
+
+#include <stdio.h>
+
+/* a typical small object / request body, small enough that the first call is dominated by table faults and misses */
+#define COLD_START_DEFAULT_BUFFER_SIZE 4096
+
+/* warm calls timed individually after the first one, the fastest is reported */
+#define COLD_START_WARM_CALLS 1000
+
+static volatile uint32_t s_sink;
+
+static uint64_t s_time_call(benchmark_crc_fn *fn, const uint8_t *buffer, size_t length) {
+    uint64_t start = 0;
+    uint64_t end = 0;
+
+    aws_high_res_clock_get_ticks(&start);
+    s_sink ^= fn(buffer, (int)length, 0);
+    aws_high_res_clock_get_ticks(&end);
+    return end - start;
+}
+
+/*
+ * First call latency: how long the very first checksum of the process takes (lookup tables paged in or generated,
+ * cpu feature detection, cold caches) next to the same call once warm. Only the first kernel that touches a given
+ * table is really cold, so for comparing builds (e.g. with and without AWS_CHECKSUMS_COMPACT_TABLES) run one kernel
+ * per process with --kernel.
+ */
+int benchmark_run_cold_start(const struct benchmark_options *options) {
+    size_t size = options->buffer_size ? options->buffer_size : COLD_START_DEFAULT_BUFFER_SIZE;
+
+    /* fault the input in up front so only the kernel's own first touch is measured */
+    uint8_t *buffer = aws_mem_acquire(options->allocator, size);
+    for (size_t i = 0; i < size; ++i) {
+        buffer[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    fprintf(stdout, "%-34s %12s %16s %16s\n", "kernel", "size", "first call ns", "warm call ns");
+
+    for (size_t k = 0; k < g_benchmark_kernel_count; ++k) {
+        const struct benchmark_kernel *kernel = &g_benchmark_kernels[k];
+        if (!benchmark_kernel_selected(options, kernel)) {
+            continue;
+        }
+
+        uint64_t first_ns = s_time_call(kernel->fn, buffer, size);
+        uint64_t warm_ns = UINT64_MAX;
+        for (size_t i = 0; i < COLD_START_WARM_CALLS; ++i) {
+            uint64_t call_ns = s_time_call(kernel->fn, buffer, size);
+            warm_ns = call_ns < warm_ns ? call_ns : warm_ns;
+        }
+
+        fprintf(
+            stdout,
+            "%-34s %12zu %16llu %16llu\n",
+            kernel->name,
+            size,
+            (unsigned long long)first_ns,
+            (unsigned long long)warm_ns);
+        fflush(stdout);
+    }
+
+    aws_mem_release(options->allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
@@ -0,0 +1,331 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark.h"
+
+#include <aws/checksums/crc.h>
+#include <aws/checksums/private/crc_priv.h>
+
+#include <aws/common/clock.h>
+#include <aws/common/command_line_parser.h>
+#include <aws/common/cpuid.h>
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool s_always_available(void) {
+    return true;
+}
+
+static bool s_crc32c_hw_available(void) {
+    return aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) || aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC);
+}
+
+static bool s_crc32_hw_available(void) {
+    /* intel has no crc32 (gzip) instruction, aws_checksums_crc32_hw() would just measure the sw path again */
+    return aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC);
+}
+
+/*
+ * The clmul kernels fold 512 bits at a time where the cpu has VPCLMULQDQ and 128 bits otherwise. They are listed once
+ * per width, each only where it is the one that runs, so the two keep separate perf baselines.
+ */
+static bool s_clmul_128_available(void) {
+    return aws_checksums_clmul_fold_is_available() && !aws_checksums_avx512_fold_is_available();
+}
+
+const struct benchmark_kernel g_benchmark_kernels[] = {
+    {"aws_checksums_crc32", AWS_CHECKSUMS_CRC32, aws_checksums_crc32, s_always_available},
+    {"aws_checksums_crc32c", AWS_CHECKSUMS_CRC32C, aws_checksums_crc32c, s_always_available},
+    {"aws_checksums_crc32_sw", AWS_CHECKSUMS_CRC32, aws_checksums_crc32_sw, s_always_available},
+    {"aws_checksums_crc32c_sw", AWS_CHECKSUMS_CRC32C, aws_checksums_crc32c_sw, s_always_available},
+    {"aws_checksums_crc32_hw", AWS_CHECKSUMS_CRC32, aws_checksums_crc32_hw, s_crc32_hw_available},
+    {"aws_checksums_crc32c_hw", AWS_CHECKSUMS_CRC32C, aws_checksums_crc32c_hw, s_crc32c_hw_available},
+    {"aws_checksums_crc32_pshufb", AWS_CHECKSUMS_CRC32, aws_checksums_crc32_pshufb, aws_checksums_pshufb_is_available},
+    {"aws_checksums_crc32c_pshufb",
+     AWS_CHECKSUMS_CRC32C,
+     aws_checksums_crc32c_pshufb,
+     aws_checksums_pshufb_is_available},
+    {"aws_checksums_crc32_clmul", AWS_CHECKSUMS_CRC32, aws_checksums_crc32_clmul, s_clmul_128_available},
+    {"aws_checksums_crc32c_clmul", AWS_CHECKSUMS_CRC32C, aws_checksums_crc32c_clmul, s_clmul_128_available},
+    {"aws_checksums_crc32_clmul_avx512",
+     AWS_CHECKSUMS_CRC32,
+     aws_checksums_crc32_clmul,
+     aws_checksums_avx512_fold_is_available},
+    {"aws_checksums_crc32c_clmul_avx512",
+     AWS_CHECKSUMS_CRC32C,
+     aws_checksums_crc32c_clmul,
+     aws_checksums_avx512_fold_is_available},
+#ifdef AWS_CHECKSUMS_BENCHMARK_HAVE_ZLIB
+    {"zlib_crc32", AWS_CHECKSUMS_CRC32, benchmark_zlib_crc32, s_always_available},
+    {"zlib_crc32_z", AWS_CHECKSUMS_CRC32, benchmark_zlib_crc32_z, benchmark_zlib_crc32_z_available},
+#endif
+    {"reference_crc32_bitwise", AWS_CHECKSUMS_CRC32, benchmark_crc32_bitwise, s_always_available},
+    {"reference_crc32c_bitwise", AWS_CHECKSUMS_CRC32C, benchmark_crc32c_bitwise, s_always_available},
+};
+
+const size_t g_benchmark_kernel_count = AWS_ARRAY_SIZE(g_benchmark_kernels);
+
+bool benchmark_kernel_selected(const struct benchmark_options *options, const struct benchmark_kernel *kernel) {
+    if (!kernel->is_available()) {
+        return false;
+    }
+
+    if (!options->kernel_filter) {
+        return true;
+    }
+
+    size_t name_len = strlen(kernel->name);
+    const char *filter = options->kernel_filter;
+    while (*filter) {
+        const char *end = strchr(filter, ',');
+        size_t filter_len = end ? (size_t)(end - filter) : strlen(filter);
+        if (filter_len == name_len && !strncmp(filter, kernel->name, name_len)) {
+            return true;
+        }
+        filter += filter_len;
+        if (*filter == ',') {
+            filter++;
+        }
+    }
+
+    return false;
+}
+
+/* keeps the compiler from discarding the crc computations we are timing */
+static volatile uint32_t s_sink;
+
+double benchmark_measure_gbps(benchmark_crc_fn *fn, const uint8_t *buffer, size_t length, uint64_t duration_ns) {
+    uint32_t crc = fn(buffer, (int)length, 0);
+    uint64_t bytes = 0;
+    uint64_t start = 0;
+    uint64_t now = 0;
+
+    aws_high_res_clock_get_ticks(&start);
+    do {
+        /* batch calls between clock reads so tiny buffers measure the kernel rather than the clock */
+        for (size_t i = 0; i < 64; ++i) {
+            crc = fn(buffer, (int)length, crc);
+        }
+        bytes += 64 * length;
+        aws_high_res_clock_get_ticks(&now);
+    } while (now - start < duration_ns);
+
+    s_sink ^= crc;
+    return (double)bytes / (double)(now - start);
+}
+
+void benchmark_print_header(void) {
+    fprintf(
+        stdout,
+        "%-34s %12s %8s %14s %14s %10s\n",
+        "kernel",
+        "size",
+        "threads",
+        "aggregate GB/s",
+        "per-thread GB/s",
+        "vs copy");
+}
+
+void benchmark_print_result(const struct benchmark_result *result) {
+    char efficiency[16] = "-";
+    if (result->copy_efficiency > 0) {
+        snprintf(efficiency, sizeof(efficiency), "%.1f%%", result->copy_efficiency * 100.0);
+    }
+
+    fprintf(
+        stdout,
+        "%-34s %12zu %8zu %14.3f %14.3f %10s\n",
+        result->kernel_name,
+        result->buffer_size,
+        result->threads,
+        result->aggregate_gbps,
+        result->per_thread_gbps,
+        efficiency);
+    fflush(stdout);
+}
+
+static const size_t s_sweep_sizes[] = {8, 16, 64, 256, 1024, 4096, 16384, 65536, 1024 * 1024};
+
+static int s_run_sweep(const struct benchmark_options *options) {
+    size_t max_size = options->buffer_size;
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_sweep_sizes); ++i) {
+        if (s_sweep_sizes[i] > max_size) {
+            max_size = s_sweep_sizes[i];
+        }
+    }
+
+    uint8_t *buffer = aws_mem_acquire(options->allocator, max_size);
+    for (size_t i = 0; i < max_size; ++i) {
+        buffer[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    benchmark_print_header();
+    for (size_t k = 0; k < g_benchmark_kernel_count; ++k) {
+        const struct benchmark_kernel *kernel = &g_benchmark_kernels[k];
+        if (!benchmark_kernel_selected(options, kernel)) {
+            continue;
+        }
+
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(s_sweep_sizes); ++i) {
+            size_t size = options->buffer_size ? options->buffer_size : s_sweep_sizes[i];
+            double gbps = benchmark_measure_gbps(kernel->fn, buffer, size, options->duration_ns);
+            struct benchmark_result result = {
+                .kernel_name = kernel->name,
+                .buffer_size = size,
+                .threads = 1,
+                .aggregate_gbps = gbps,
+                .per_thread_gbps = gbps,
+            };
+            benchmark_print_result(&result);
+
+            if (options->buffer_size) {
+                break;
+            }
+        }
+    }
+
+    aws_mem_release(options->allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
+
+static void s_usage(int exit_code) {
+    fprintf(stderr, "usage: aws-checksums-benchmark [options]\n");
+    fprintf(stderr, "\n Options:\n\n");
+    fprintf(stderr, "  -k, --kernel NAME[,NAME...]: only run the named kernels (default: all available).\n");
+    fprintf(stderr, "  -s, --size BYTES: bytes per call, or per thread buffer size in scaling mode.\n");
+    fprintf(stderr, "  -d, --duration MS: time spent on each measurement (default: 200).\n");
+    fprintf(stderr, "  -t, --threads N: scaling mode, run 1, 2, 4 ... N threads on private buffers.\n");
+    fprintf(stderr, "  -n, --numa-node GROUP: scaling mode, only place threads on cpus of this cpu group.\n");
+    fprintf(stderr, "      --no-pin: scaling mode, let the scheduler place threads.\n");
+    fprintf(stderr, "      --no-smt: scaling mode, skip cpus that look like hyper-thread siblings.\n");
+    fprintf(stderr, "      --perf-gate FILE: compare kernel throughput (relative to memcpy) against a baseline\n");
+    fprintf(stderr, "      file.\n");
+    fprintf(stderr, "      --tolerance PCT: perf gate, allowed drop below the baseline ratio (default: 25).\n");
+    fprintf(stderr, "      --write-baseline: perf gate, print the baseline file with freshly measured ratios.\n");
+    fprintf(stderr, "      --replay FILE: re-run the calls of a recorded trace against the selected kernels.\n");
+    fprintf(stderr, "      --paced: replay, honor the recorded inter-arrival times instead of running back to back.\n");
+    fprintf(stderr, "      --cold-start: time the first call of each selected kernel (use one --kernel per run).\n");
+    fprintf(stderr, "  -h, --help: Display this message and quit.\n");
+    exit(exit_code);
+}
+
+static struct aws_cli_option s_long_options[] = {
+    {"kernel", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'k'},
+    {"size", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 's'},
+    {"duration", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'd'},
+    {"threads", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 't'},
+    {"numa-node", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'n'},
+    {"no-pin", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'p'},
+    {"no-smt", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'm'},
+    {"perf-gate", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'g'},
+    {"tolerance", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'o'},
+    {"write-baseline", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'w'},
+    {"replay", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'r'},
+    {"paced", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'a'},
+    {"cold-start", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'c'},
+    {"help", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'h'},
+    /* Per getopt(3) the last element of the array has to be filled with all zeros */
+    {NULL, AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 0},
+};
+
+static void s_parse_options(int argc, char **argv, struct benchmark_options *options) {
+    while (true) {
+        int option_index = 0;
+        int c = aws_cli_getopt_long(argc, argv, "k:s:d:t:n:h", s_long_options, &option_index);
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+            case 0:
+                /* getopt_long() returns 0 if an option.flag is non-null */
+                break;
+            case 'k':
+                options->kernel_filter = aws_cli_optarg;
+                break;
+            case 's': {
+                unsigned long long size = strtoull(aws_cli_optarg, NULL, 10);
+                if (size == 0 || size > INT_MAX) {
+                    fprintf(stderr, "--size must be between 1 and %d\n", INT_MAX);
+                    s_usage(1);
+                }
+                options->buffer_size = (size_t)size;
+                break;
+            }
+            case 'd':
+                options->duration_ns = aws_timestamp_convert(
+                    strtoull(aws_cli_optarg, NULL, 10), AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+                break;
+            case 't':
+                options->max_threads = (size_t)strtoull(aws_cli_optarg, NULL, 10);
+                break;
+            case 'n':
+                options->numa_node = (int32_t)strtol(aws_cli_optarg, NULL, 10);
+                break;
+            case 'p':
+                options->pin_threads = false;
+                break;
+            case 'm':
+                options->skip_smt = true;
+                break;
+            case 'g':
+                options->baseline_path = aws_cli_optarg;
+                break;
+            case 'o':
+                options->tolerance = strtod(aws_cli_optarg, NULL) / 100.0;
+                break;
+            case 'w':
+                options->write_baseline = true;
+                break;
+            case 'r':
+                options->replay_path = aws_cli_optarg;
+                break;
+            case 'a':
+                options->replay_paced = true;
+                break;
+            case 'c':
+                options->cold_start = true;
+                break;
+            case 'h':
+                s_usage(0);
+                break;
+            default:
+                fprintf(stderr, "Unknown option\n");
+                s_usage(1);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    struct aws_allocator *allocator = aws_default_allocator();
+    aws_common_library_init(allocator);
+
+    struct benchmark_options options = {
+        .allocator = allocator,
+        .numa_node = -1,
+        .pin_threads = true,
+        .duration_ns = aws_timestamp_convert(200, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL),
+        .tolerance = 0.25,
+    };
+    s_parse_options(argc, argv, &options);
+
+    int exit_code = 0;
+    if (options.baseline_path) {
+        exit_code = benchmark_run_perf_gate(&options);
+    } else if (options.replay_path) {
+        exit_code = benchmark_run_replay(&options) == AWS_OP_SUCCESS ? 0 : 1;
+    } else if (options.cold_start) {
+        exit_code = benchmark_run_cold_start(&options) == AWS_OP_SUCCESS ? 0 : 1;
+    } else {
+        int result = options.max_threads ? benchmark_run_scaling(&options) : s_run_sweep(&options);
+        exit_code = result == AWS_OP_SUCCESS ? 0 : 1;
+    }
+
+    aws_common_library_clean_up();
+    return exit_code;
+}
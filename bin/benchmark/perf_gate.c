@@ -0,0 +1,162 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark.h"
+
+#include <aws/common/clock.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Throughput regression gate. Absolute GB/s numbers don't carry across machines, so every probe is expressed as a
+ * ratio against an in-process calibration loop (memcpy of a buffer of the same size) and compared to the ratio
+ * checked into the baseline file. Each line of the baseline file reads:
+ *
+ *     <kernel name> <probe size in bytes> <minimum throughput relative to memcpy>
+ *
+ * Blank lines and lines starting with '#' are ignored.
+ */
+
+/* best-of-N keeps a single descheduled sample from failing the gate */
+#define PERF_GATE_SAMPLES 5
+
+static double s_measure_copy_gbps(uint8_t *dst, const uint8_t *src, size_t length, uint64_t duration_ns) {
+    uint64_t bytes = 0;
+    uint64_t start = 0;
+    uint64_t now = 0;
+
+    aws_high_res_clock_get_ticks(&start);
+    do {
+        for (size_t i = 0; i < 64; ++i) {
+            /* dst escapes to the caller, so the copies can't be elided */
+            memcpy(dst, src, length);
+        }
+        bytes += 64 * length;
+        aws_high_res_clock_get_ticks(&now);
+    } while (now - start < duration_ns);
+
+    return (double)bytes / (double)(now - start);
+}
+
+static const struct benchmark_kernel *s_find_kernel(const char *name) {
+    for (size_t i = 0; i < g_benchmark_kernel_count; ++i) {
+        if (!strcmp(g_benchmark_kernels[i].name, name)) {
+            return &g_benchmark_kernels[i];
+        }
+    }
+    return NULL;
+}
+
+/* Measures one probe and returns its throughput relative to memcpy of the same size. */
+static double s_probe_ratio(
+    const struct benchmark_options *options,
+    const struct benchmark_kernel *kernel,
+    size_t probe_size,
+    struct benchmark_result *result) {
+
+    uint8_t *src = aws_mem_acquire(options->allocator, probe_size);
+    uint8_t *dst = aws_mem_acquire(options->allocator, probe_size);
+    for (size_t i = 0; i < probe_size; ++i) {
+        src[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    double best_copy = 0;
+    double best_crc = 0;
+    for (int sample = 0; sample < PERF_GATE_SAMPLES; ++sample) {
+        double copy_gbps = s_measure_copy_gbps(dst, src, probe_size, options->duration_ns);
+        double crc_gbps = benchmark_measure_gbps(kernel->fn, src, probe_size, options->duration_ns);
+        best_copy = copy_gbps > best_copy ? copy_gbps : best_copy;
+        best_crc = crc_gbps > best_crc ? crc_gbps : best_crc;
+    }
+
+    aws_mem_release(options->allocator, dst);
+    aws_mem_release(options->allocator, src);
+
+    result->kernel_name = kernel->name;
+    result->buffer_size = probe_size;
+    result->threads = 1;
+    result->aggregate_gbps = best_crc;
+    result->per_thread_gbps = best_crc;
+    result->copy_efficiency = best_crc / best_copy;
+    return result->copy_efficiency;
+}
+
+int benchmark_run_perf_gate(const struct benchmark_options *options) {
+    FILE *baseline = fopen(options->baseline_path, "r");
+    if (!baseline) {
+        fprintf(stderr, "unable to open baseline file %s\n", options->baseline_path);
+        return 1;
+    }
+
+    size_t probes_run = 0;
+    size_t regressions = 0;
+    char line[256];
+
+    if (!options->write_baseline) {
+        benchmark_print_header();
+    }
+
+    while (fgets(line, sizeof(line), baseline)) {
+        char name[128];
+        unsigned long long probe_size = 0;
+        double expected_ratio = 0;
+
+        if (line[0] == '#' || sscanf(line, "%127s %llu %lf", name, &probe_size, &expected_ratio) != 3) {
+            if (options->write_baseline) {
+                fputs(line, stdout);
+            }
+            continue;
+        }
+
+        const struct benchmark_kernel *kernel = s_find_kernel(name);
+        if (!kernel) {
+            fprintf(stderr, "baseline references unknown kernel %s\n", name);
+            fclose(baseline);
+            return 1;
+        }
+
+        if (!benchmark_kernel_selected(options, kernel) || probe_size == 0 || probe_size > INT32_MAX) {
+            if (options->write_baseline) {
+                fputs(line, stdout);
+            }
+            continue;
+        }
+
+        struct benchmark_result result;
+        AWS_ZERO_STRUCT(result);
+        double ratio = s_probe_ratio(options, kernel, (size_t)probe_size, &result);
+        probes_run++;
+
+        if (options->write_baseline) {
+            fprintf(stdout, "%s %llu %.3f\n", name, probe_size, ratio);
+            continue;
+        }
+
+        benchmark_print_result(&result);
+        double min_ratio = expected_ratio * (1.0 - options->tolerance);
+        if (ratio < min_ratio) {
+            regressions++;
+            fprintf(
+                stderr,
+                "REGRESSION: %s at %llu bytes ran at %.3fx memcpy, baseline %.3fx (tolerance %.0f%%)\n",
+                name,
+                probe_size,
+                ratio,
+                expected_ratio,
+                options->tolerance * 100.0);
+        }
+    }
+
+    fclose(baseline);
+
+    if (!probes_run) {
+        /* nothing this host can run, e.g. a hw kernel on a cpu without the instructions */
+        fprintf(stderr, "no baseline probes are runnable on this host, skipping\n");
+        return BENCHMARK_EXIT_SKIPPED;
+    }
+
+    return regressions ? 1 : 0;
+}
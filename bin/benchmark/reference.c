@@ -0,0 +1,60 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark.h"
+
+#ifdef AWS_CHECKSUMS_BENCHMARK_HAVE_ZLIB
+#    include <zlib.h>
+#endif
+
+/*
+ * Other implementations measured alongside the library's kernels, wrapped to the library's signature so they slot
+ * into the same kernel table and report.
+ */
+
+/* Textbook one bit at a time reflected crc, the floor every table or instruction based kernel should beat. */
+static uint32_t s_crc_bitwise(const uint8_t *input, int length, uint32_t previous_crc, uint32_t reflected_poly) {
+    uint32_t crc = ~previous_crc;
+    for (int i = 0; i < length; ++i) {
+        crc ^= input[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (reflected_poly & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+uint32_t benchmark_crc32_bitwise(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return s_crc_bitwise(input, length, previousCrc32, 0xEDB88320);
+}
+
+uint32_t benchmark_crc32c_bitwise(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return s_crc_bitwise(input, length, previousCrc32, 0x82F63B78);
+}
+
+#ifdef AWS_CHECKSUMS_BENCHMARK_HAVE_ZLIB
+
+uint32_t benchmark_zlib_crc32(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return (uint32_t)crc32(previousCrc32, input, (uInt)length);
+}
+
+/* crc32_z() (size_t length) only exists since zlib 1.2.9 */
+bool benchmark_zlib_crc32_z_available(void) {
+#    if ZLIB_VERNUM >= 0x1290
+    return true;
+#    else
+    return false;
+#    endif
+}
+
+uint32_t benchmark_zlib_crc32_z(const uint8_t *input, int length, uint32_t previousCrc32) {
+#    if ZLIB_VERNUM >= 0x1290
+    return (uint32_t)crc32_z(previousCrc32, input, (z_size_t)length);
+#    else
+    return benchmark_zlib_crc32(input, length, previousCrc32);
+#    endif
+}
+
+#endif /* AWS_CHECKSUMS_BENCHMARK_HAVE_ZLIB */
@@ -0,0 +1,208 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark.h"
+
+#include <aws/checksums/trace.h>
+
+#include <aws/common/byte_buf.h>
+#include <aws/common/clock.h>
+#include <aws/common/file.h>
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+
+/* allocation alignment the recorded alignments (address % 64) are reproduced against */
+#define REPLAY_ALIGNMENT 64
+
+struct replay_trace {
+    struct aws_checksums_trace_record *records;
+    size_t record_count;
+    size_t max_length;
+    uint64_t calls[AWS_CHECKSUMS_CRC_ALGORITHM_COUNT];
+    uint64_t bytes[AWS_CHECKSUMS_CRC_ALGORITHM_COUNT];
+    uint64_t span_ns;
+};
+
+static int s_load_trace(const struct benchmark_options *options, struct replay_trace *trace) {
+    FILE *file = aws_fopen(options->replay_path, "rb");
+    if (!file) {
+        fprintf(stderr, "unable to open trace file %s\n", options->replay_path);
+        return AWS_OP_ERR;
+    }
+
+    int64_t file_length = 0;
+    if (aws_file_get_length(file, &file_length) || file_length < 0) {
+        fprintf(stderr, "unable to get the length of %s\n", options->replay_path);
+        fclose(file);
+        return AWS_OP_ERR;
+    }
+
+    uint8_t *contents = aws_mem_acquire(options->allocator, (size_t)file_length + 1);
+    size_t read = fread(contents, 1, (size_t)file_length, file);
+    fclose(file);
+
+    struct aws_byte_cursor input = aws_byte_cursor_from_array(contents, read);
+    if (aws_checksums_trace_decode_header(&input)) {
+        fprintf(stderr, "%s is not a checksum trace (or has an unsupported version)\n", options->replay_path);
+        aws_mem_release(options->allocator, contents);
+        return AWS_OP_ERR;
+    }
+
+    /* every record is at least 3 bytes, which bounds the record count */
+    size_t capacity = input.len / 3 + 1;
+    trace->records = aws_mem_calloc(options->allocator, capacity, sizeof(struct aws_checksums_trace_record));
+    while (input.len && trace->record_count < capacity) {
+        struct aws_checksums_trace_record *record = &trace->records[trace->record_count];
+        if (aws_checksums_trace_decode_record(&input, record)) {
+            /* a trace cut short (e.g. the process died mid capture) still replays up to the damaged record */
+            fprintf(
+                stderr,
+                "stopping at malformed record %zu: %s\n",
+                trace->record_count,
+                aws_error_str(aws_last_error()));
+            break;
+        }
+        /* the kernels take an int length, which every recorded call had */
+        if (record->length > INT_MAX) {
+            fprintf(
+                stderr,
+                "stopping at record %zu: length %" PRIu32 " is more than one call takes\n",
+                trace->record_count,
+                record->length);
+            break;
+        }
+
+        trace->record_count++;
+        trace->calls[record->algorithm]++;
+        trace->bytes[record->algorithm] += record->length;
+        trace->span_ns += record->inter_arrival_ns;
+        if (record->length > trace->max_length) {
+            trace->max_length = record->length;
+        }
+    }
+
+    aws_mem_release(options->allocator, contents);
+    return AWS_OP_SUCCESS;
+}
+
+/* keeps the compiler from discarding the replayed crc computations */
+static volatile uint32_t s_replay_sink;
+
+/* Replays every matching record back to back, looping over the trace until duration_ns has passed. */
+static double s_replay_back_to_back(
+    const struct benchmark_options *options,
+    const struct replay_trace *trace,
+    const struct benchmark_kernel *kernel,
+    const uint8_t *buffer) {
+
+    uint32_t crc = 0;
+    uint64_t bytes = 0;
+    uint64_t start = 0;
+    uint64_t now = 0;
+
+    aws_high_res_clock_get_ticks(&start);
+    do {
+        for (size_t i = 0; i < trace->record_count; ++i) {
+            const struct aws_checksums_trace_record *record = &trace->records[i];
+            if (record->algorithm == kernel->algorithm) {
+                crc = kernel->fn(buffer + record->alignment, (int)record->length, crc);
+                bytes += record->length;
+            }
+        }
+        aws_high_res_clock_get_ticks(&now);
+    } while (now - start < options->duration_ns);
+
+    s_replay_sink ^= crc;
+    return bytes ? (double)bytes / (double)(now - start) : 0;
+}
+
+/*
+ * Replays the trace once on its original schedule, spinning out the recorded gaps (including those of calls for the
+ * other algorithm) so the caches see the same idle time between calls, and only counting the time spent inside the
+ * kernel. Every call pays for two clock reads, so this reads low for tiny calls.
+ */
+static double s_replay_paced(
+    const struct replay_trace *trace,
+    const struct benchmark_kernel *kernel,
+    const uint8_t *buffer) {
+
+    uint32_t crc = 0;
+    uint64_t bytes = 0;
+    uint64_t kernel_ns = 0;
+    uint64_t start = 0;
+    uint64_t due = 0;
+    uint64_t now = 0;
+
+    aws_high_res_clock_get_ticks(&start);
+    for (size_t i = 0; i < trace->record_count; ++i) {
+        const struct aws_checksums_trace_record *record = &trace->records[i];
+        due += record->inter_arrival_ns;
+        if (record->algorithm != kernel->algorithm) {
+            continue;
+        }
+
+        do {
+            aws_high_res_clock_get_ticks(&now);
+        } while (now - start < due);
+
+        crc = kernel->fn(buffer + record->alignment, (int)record->length, crc);
+        uint64_t end = 0;
+        aws_high_res_clock_get_ticks(&end);
+        kernel_ns += end - now;
+        bytes += record->length;
+    }
+
+    s_replay_sink ^= crc;
+    return kernel_ns ? (double)bytes / (double)kernel_ns : 0;
+}
+
+int benchmark_run_replay(const struct benchmark_options *options) {
+    struct replay_trace trace;
+    AWS_ZERO_STRUCT(trace);
+    if (s_load_trace(options, &trace)) {
+        return AWS_OP_ERR;
+    }
+
+    fprintf(
+        stdout,
+        "trace %s: %zu calls (crc32: %" PRIu64 ", crc32c: %" PRIu64 "), %" PRIu64 " bytes over %.3f ms\n",
+        options->replay_path,
+        trace.record_count,
+        trace.calls[AWS_CHECKSUMS_CRC32],
+        trace.calls[AWS_CHECKSUMS_CRC32C],
+        trace.bytes[AWS_CHECKSUMS_CRC32] + trace.bytes[AWS_CHECKSUMS_CRC32C],
+        (double)trace.span_ns / 1e6);
+
+    uint8_t *allocation = aws_mem_acquire(options->allocator, trace.max_length + 2 * REPLAY_ALIGNMENT);
+    uint8_t *buffer = (uint8_t *)(((uintptr_t)allocation + REPLAY_ALIGNMENT - 1) & ~(uintptr_t)(REPLAY_ALIGNMENT - 1));
+    for (size_t i = 0; i < trace.max_length + REPLAY_ALIGNMENT; ++i) {
+        buffer[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    benchmark_print_header();
+    for (size_t k = 0; k < g_benchmark_kernel_count; ++k) {
+        const struct benchmark_kernel *kernel = &g_benchmark_kernels[k];
+        if (!benchmark_kernel_selected(options, kernel) || !trace.calls[kernel->algorithm]) {
+            continue;
+        }
+
+        double gbps = options->replay_paced ? s_replay_paced(&trace, kernel, buffer)
+                                            : s_replay_back_to_back(options, &trace, kernel, buffer);
+        struct benchmark_result result = {
+            .kernel_name = kernel->name,
+            .buffer_size = (size_t)(trace.bytes[kernel->algorithm] / trace.calls[kernel->algorithm]),
+            .threads = 1,
+            .aggregate_gbps = gbps,
+            .per_thread_gbps = gbps,
+        };
+        benchmark_print_result(&result);
+    }
+
+    aws_mem_release(options->allocator, allocation);
+    aws_mem_release(options->allocator, trace.records);
+    return AWS_OP_SUCCESS;
+}
@@ -0,0 +1,273 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "benchmark.h"
+
+#include <aws/common/clock.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/mutex.h>
+#include <aws/common/system_info.h>
+#include <aws/common/thread.h>
+
+#include <stdio.h>
+
+/* Large enough to spill out of the last level cache on current server parts, so the run becomes DRAM bound. */
+#define SCALING_DEFAULT_BUFFER_SIZE (32 * 1024 * 1024)
+
+/*
+ * Shared state for one measurement: every worker allocates and touches its buffers, checks in, and then waits
+ * until all workers are ready so that the timed sections overlap.
+ */
+struct scaling_run {
+    struct aws_mutex lock;
+    struct aws_condition_variable signal;
+    size_t ready_count;
+    size_t thread_count;
+    bool started;
+    uint64_t duration_ns;
+};
+
+struct scaling_worker {
+    struct scaling_run *run;
+    struct aws_allocator *allocator;
+    /* NULL runs the STREAM-style copy used as the bandwidth reference */
+    benchmark_crc_fn *fn;
+    size_t buffer_size;
+    uint8_t seed;
+    uint64_t bytes;
+    uint64_t elapsed_ns;
+    uint32_t crc;
+};
+
+static bool s_all_ready(void *user_data) {
+    struct scaling_run *run = user_data;
+    return run->ready_count == run->thread_count;
+}
+
+static bool s_started(void *user_data) {
+    struct scaling_run *run = user_data;
+    return run->started;
+}
+
+static void s_worker_main(void *arg) {
+    struct scaling_worker *worker = arg;
+    struct scaling_run *run = worker->run;
+    size_t size = worker->buffer_size;
+
+    /* Buffers are private to each thread and first touched by it, so a pinned thread gets node local pages. */
+    uint8_t *src = aws_mem_acquire(worker->allocator, size);
+    uint8_t *dst = worker->fn ? NULL : aws_mem_acquire(worker->allocator, size);
+    memset(src, worker->seed, size);
+    if (dst) {
+        memset(dst, 0, size);
+    }
+
+    aws_mutex_lock(&run->lock);
+    run->ready_count++;
+    aws_condition_variable_notify_all(&run->signal);
+    aws_condition_variable_wait_pred(&run->signal, &run->lock, s_started, run);
+    aws_mutex_unlock(&run->lock);
+
+    uint32_t crc = 0;
+    uint64_t bytes = 0;
+    uint64_t start = 0;
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&start);
+    do {
+        if (worker->fn) {
+            crc = worker->fn(src, (int)size, crc);
+            bytes += size;
+        } else {
+            memcpy(dst, src, size);
+            /* STREAM counts copy bandwidth as bytes read plus bytes written */
+            bytes += 2 * size;
+        }
+        aws_high_res_clock_get_ticks(&now);
+    } while (now - start < run->duration_ns);
+
+    worker->crc = crc;
+    worker->bytes = bytes;
+    worker->elapsed_ns = now - start;
+
+    aws_mem_release(worker->allocator, src);
+    if (dst) {
+        aws_mem_release(worker->allocator, dst);
+    }
+}
+
+/*
+ * Runs thread_count workers concurrently and reports the sum of the per thread rates (aggregate) and their mean.
+ */
+static int s_run_threads(
+    const struct benchmark_options *options,
+    const int32_t *cpu_ids,
+    size_t cpu_count,
+    size_t thread_count,
+    benchmark_crc_fn *fn,
+    size_t buffer_size,
+    double *aggregate_gbps) {
+
+    struct scaling_run run = {
+        .lock = AWS_MUTEX_INIT,
+        .signal = AWS_CONDITION_VARIABLE_INIT,
+        .thread_count = thread_count,
+        .duration_ns = options->duration_ns,
+    };
+
+    struct aws_thread *threads = aws_mem_calloc(options->allocator, thread_count, sizeof(struct aws_thread));
+    struct scaling_worker *workers = aws_mem_calloc(options->allocator, thread_count, sizeof(struct scaling_worker));
+
+    int result = AWS_OP_SUCCESS;
+    size_t launched = 0;
+    for (; launched < thread_count; ++launched) {
+        struct scaling_worker *worker = &workers[launched];
+        worker->run = &run;
+        worker->allocator = options->allocator;
+        worker->fn = fn;
+        worker->buffer_size = buffer_size;
+        worker->seed = (uint8_t)(launched + 1);
+
+        struct aws_thread_options thread_options = *aws_default_thread_options();
+        thread_options.cpu_id = (options->pin_threads && cpu_count) ? cpu_ids[launched % cpu_count] : -1;
+
+        aws_thread_init(&threads[launched], options->allocator);
+        if (aws_thread_launch(&threads[launched], s_worker_main, worker, &thread_options)) {
+            fprintf(stderr, "failed to launch thread %zu: %s\n", launched, aws_error_str(aws_last_error()));
+            aws_thread_clean_up(&threads[launched]);
+            result = AWS_OP_ERR;
+            break;
+        }
+    }
+
+    aws_mutex_lock(&run.lock);
+    /* on a launch failure, release whoever did start so they can be joined */
+    run.thread_count = launched;
+    aws_condition_variable_wait_pred(&run.signal, &run.lock, s_all_ready, &run);
+    run.started = true;
+    aws_condition_variable_notify_all(&run.signal);
+    aws_mutex_unlock(&run.lock);
+
+    *aggregate_gbps = 0;
+    for (size_t i = 0; i < launched; ++i) {
+        aws_thread_join(&threads[i]);
+        aws_thread_clean_up(&threads[i]);
+        if (workers[i].elapsed_ns) {
+            *aggregate_gbps += (double)workers[i].bytes / (double)workers[i].elapsed_ns;
+        }
+    }
+
+    aws_mem_release(options->allocator, workers);
+    aws_mem_release(options->allocator, threads);
+    return result;
+}
+
+/*
+ * Orders the cpus threads get pinned to: physical cores first, then the suspected hyper-thread siblings (unless
+ * skipped), so the point where siblings start sharing a core's crc unit shows up as a knee in the per thread column.
+ */
+static size_t s_collect_cpu_ids(const struct benchmark_options *options, int32_t *cpu_ids, size_t capacity) {
+    size_t count = 0;
+    uint16_t group_count = aws_get_cpu_group_count();
+
+    for (int pass = 0; pass < 2; ++pass) {
+        bool want_hyper_threads = pass == 1;
+        if (want_hyper_threads && options->skip_smt) {
+            break;
+        }
+
+        for (uint16_t group = 0; group < group_count; ++group) {
+            if (options->numa_node >= 0 && group != (uint16_t)options->numa_node) {
+                continue;
+            }
+
+            size_t group_cpu_count = aws_get_cpu_count_for_group(group);
+            if (!group_cpu_count) {
+                continue;
+            }
+
+            struct aws_cpu_info *cpus =
+                aws_mem_calloc(options->allocator, group_cpu_count, sizeof(struct aws_cpu_info));
+            aws_get_cpu_ids_for_group(group, cpus, group_cpu_count);
+            for (size_t i = 0; i < group_cpu_count && count < capacity; ++i) {
+                if (cpus[i].cpu_id >= 0 && cpus[i].suspected_hyper_thread == want_hyper_threads) {
+                    cpu_ids[count++] = cpus[i].cpu_id;
+                }
+            }
+            aws_mem_release(options->allocator, cpus);
+        }
+    }
+
+    return count;
+}
+
+int benchmark_run_scaling(const struct benchmark_options *options) {
+    size_t buffer_size = options->buffer_size ? options->buffer_size : SCALING_DEFAULT_BUFFER_SIZE;
+    size_t capacity = aws_system_info_processor_count();
+    int32_t *cpu_ids = aws_mem_calloc(options->allocator, capacity ? capacity : 1, sizeof(int32_t));
+    size_t cpu_count = s_collect_cpu_ids(options, cpu_ids, capacity);
+
+    if (options->numa_node >= 0 && !cpu_count) {
+        fprintf(stderr, "no cpus found for cpu group %d\n", (int)options->numa_node);
+        aws_mem_release(options->allocator, cpu_ids);
+        return AWS_OP_ERR;
+    }
+
+    if (options->pin_threads && options->max_threads > cpu_count) {
+        fprintf(
+            stderr,
+            "note: %zu threads requested but only %zu cpus selected, threads will share cpus\n",
+            options->max_threads,
+            cpu_count);
+    }
+
+    benchmark_print_header();
+
+    int result = AWS_OP_SUCCESS;
+    size_t threads = 1;
+    while (result == AWS_OP_SUCCESS) {
+        double copy_gbps = 0;
+        result = s_run_threads(options, cpu_ids, cpu_count, threads, NULL, buffer_size, &copy_gbps);
+        if (result) {
+            break;
+        }
+
+        struct benchmark_result copy_result = {
+            .kernel_name = "memcpy (stream copy)",
+            .buffer_size = buffer_size,
+            .threads = threads,
+            .aggregate_gbps = copy_gbps,
+            .per_thread_gbps = copy_gbps / (double)threads,
+        };
+        benchmark_print_result(&copy_result);
+
+        for (size_t k = 0; k < g_benchmark_kernel_count && result == AWS_OP_SUCCESS; ++k) {
+            const struct benchmark_kernel *kernel = &g_benchmark_kernels[k];
+            if (!benchmark_kernel_selected(options, kernel)) {
+                continue;
+            }
+
+            double crc_gbps = 0;
+            result = s_run_threads(options, cpu_ids, cpu_count, threads, kernel->fn, buffer_size, &crc_gbps);
+
+            struct benchmark_result crc_result = {
+                .kernel_name = kernel->name,
+                .buffer_size = buffer_size,
+                .threads = threads,
+                .aggregate_gbps = crc_gbps,
+                .per_thread_gbps = crc_gbps / (double)threads,
+                .copy_efficiency = copy_gbps > 0 ? crc_gbps / copy_gbps : 0,
+            };
+            benchmark_print_result(&crc_result);
+        }
+
+        if (threads == options->max_threads) {
+            break;
+        }
+        threads = threads * 2 > options->max_threads ? options->max_threads : threads * 2;
+    }
+
+    aws_mem_release(options->allocator, cpu_ids);
+    return result;
+}
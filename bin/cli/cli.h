@@ -0,0 +1,75 @@
+#ifndef AWS_CHECKSUMS_CLI_H
+#define AWS_CHECKSUMS_CLI_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/common.h>
+
+struct cli_algorithm {
+    const char *name;
+    /* bytes of the checksum, which is also the length of its big-endian (S3 header) encoding */
+    size_t width;
+    /* continues previous over data, any length */
+    uint64_t (*update)(const uint8_t *data, size_t length, uint64_t previous);
+    /* the checksum of A followed by B from the checksums of both and the length of B */
+    uint64_t (*combine)(uint64_t crc_a, uint64_t crc_b, uint64_t length_b);
+    /*
+     * whether enum aws_checksums_crc_algorithm has this algorithm, as library_algorithm, so that the file, multipart
+     * and header value helpers of the library take it
+     */
+    bool has_library_algorithm;
+    enum aws_checksums_crc_algorithm library_algorithm;
+};
+
+extern const struct cli_algorithm g_cli_algorithms[];
+extern const size_t g_cli_algorithm_count;
+
+/* CRC64/NVME (crc64.c), the full object crc64 of S3. The library itself only has crc32 and crc32c. */
+uint64_t cli_crc64nvme_update(const uint8_t *data, size_t length, uint64_t previous);
+uint64_t cli_crc64nvme_combine(uint64_t crc_a, uint64_t crc_b, uint64_t length_b);
+
+struct cli_options {
+    struct aws_allocator *allocator;
+    const struct cli_algorithm *algorithm;
+    /* bytes per part for multipart style output, 0 for a single checksum per input */
+    uint64_t part_size;
+    /* threads reading a regular file, 0 for one per processor */
+    size_t thread_count;
+    /* print checksums in the base64 x-amz-checksum-* header form instead of hex */
+    bool base64;
+    /* print bytes, time and throughput of every input on stderr */
+    bool stats;
+};
+
+struct cli_part {
+    uint64_t offset;
+    uint64_t length;
+    uint64_t crc;
+};
+
+struct cli_digest {
+    uint64_t crc;
+    uint64_t bytes;
+    /* one entry per part_size bytes of input when cli_options.part_size is set, NULL otherwise */
+    struct cli_part *parts;
+    size_t part_count;
+    /* threads the input was actually read with */
+    size_t threads;
+    uint64_t elapsed_ns;
+};
+
+/*
+ * Checksums the file at path, or stdin for "-". Regular files are read by up to thread_count threads, each over a
+ * contiguous run of parts (or of the file when there are no parts), and the results are combined in file order; pipes
+ * and other unseekable inputs are read sequentially on the calling thread. Release the digest with
+ * cli_digest_clean_up().
+ */
+int cli_digest_path(const struct cli_options *options, const char *path, struct cli_digest *digest);
+
+void cli_digest_clean_up(struct aws_allocator *allocator, struct cli_digest *digest);
+
+#endif /* AWS_CHECKSUMS_CLI_H */
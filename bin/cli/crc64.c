@@ -0,0 +1,613 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "cli.h"
+
+/*
+ * CRC64/NVME, the full object crc64 of S3. The library only has crc32 and crc32c, so the cli carries this one itself,
+ * slice-by-8 in software.
+ */
+
+/* CRC64/NVME, reflected (reverse of 0xAD93D23594C93659) */
+#define CRC64NVME_POLYNOMIAL 0x9A6C9329AC4BC9B5ull
+
+/** slice-by-8 lookup table, [s][n] is the register after byte n followed by s zero bytes */
+static const uint64_t s_crc64nvme_table[8][256] = {
+    {
+        0x0000000000000000ull, 0x7F6EF0C830358979ull, 0xFEDDE190606B12F2ull, 0x81B31158505E9B8Bull, /* [0][0x04]*/
+        0xC962E5739841B68Full, 0xB60C15BBA8743FF6ull, 0x37BF04E3F82AA47Dull, 0x48D1F42BC81F2D04ull, /* [0][0x08]*/
+        0xA61CECB46814FE75ull, 0xD9721C7C5821770Cull, 0x58C10D24087FEC87ull, 0x27AFFDEC384A65FEull, /* [0][0x0c]*/
+        0x6F7E09C7F05548FAull, 0x1010F90FC060C183ull, 0x91A3E857903E5A08ull, 0xEECD189FA00BD371ull, /* [0][0x10]*/
+        0x78E0FF3B88BE6F81ull, 0x078E0FF3B88BE6F8ull, 0x863D1EABE8D57D73ull, 0xF953EE63D8E0F40Aull, /* [0][0x14]*/
+        0xB1821A4810FFD90Eull, 0xCEECEA8020CA5077ull, 0x4F5FFBD87094CBFCull, 0x30310B1040A14285ull, /* [0][0x18]*/
+        0xDEFC138FE0AA91F4ull, 0xA192E347D09F188Dull, 0x2021F21F80C18306ull, 0x5F4F02D7B0F40A7Full, /* [0][0x1c]*/
+        0x179EF6FC78EB277Bull, 0x68F0063448DEAE02ull, 0xE943176C18803589ull, 0x962DE7A428B5BCF0ull, /* [0][0x20]*/
+        0xF1C1FE77117CDF02ull, 0x8EAF0EBF2149567Bull, 0x0F1C1FE77117CDF0ull, 0x7072EF2F41224489ull, /* [0][0x24]*/
+        0x38A31B04893D698Dull, 0x47CDEBCCB908E0F4ull, 0xC67EFA94E9567B7Full, 0xB9100A5CD963F206ull, /* [0][0x28]*/
+        0x57DD12C379682177ull, 0x28B3E20B495DA80Eull, 0xA900F35319033385ull, 0xD66E039B2936BAFCull, /* [0][0x2c]*/
+        0x9EBFF7B0E12997F8ull, 0xE1D10778D11C1E81ull, 0x606216208142850Aull, 0x1F0CE6E8B1770C73ull, /* [0][0x30]*/
+        0x8921014C99C2B083ull, 0xF64FF184A9F739FAull, 0x77FCE0DCF9A9A271ull, 0x08921014C99C2B08ull, /* [0][0x34]*/
+        0x4043E43F0183060Cull, 0x3F2D14F731B68F75ull, 0xBE9E05AF61E814FEull, 0xC1F0F56751DD9D87ull, /* [0][0x38]*/
+        0x2F3DEDF8F1D64EF6ull, 0x50531D30C1E3C78Full, 0xD1E00C6891BD5C04ull, 0xAE8EFCA0A188D57Dull, /* [0][0x3c]*/
+        0xE65F088B6997F879ull, 0x9931F84359A27100ull, 0x1882E91B09FCEA8Bull, 0x67EC19D339C963F2ull, /* [0][0x40]*/
+        0xD75ADABD7A6E2D6Full, 0xA8342A754A5BA416ull, 0x29873B2D1A053F9Dull, 0x56E9CBE52A30B6E4ull, /* [0][0x44]*/
+        0x1E383FCEE22F9BE0ull, 0x6156CF06D21A1299ull, 0xE0E5DE5E82448912ull, 0x9F8B2E96B271006Bull, /* [0][0x48]*/
+        0x71463609127AD31Aull, 0x0E28C6C1224F5A63ull, 0x8F9BD7997211C1E8ull, 0xF0F5275142244891ull, /* [0][0x4c]*/
+        0xB824D37A8A3B6595ull, 0xC74A23B2BA0EECECull, 0x46F932EAEA507767ull, 0x3997C222DA65FE1Eull, /* [0][0x50]*/
+        0xAFBA2586F2D042EEull, 0xD0D4D54EC2E5CB97ull, 0x5167C41692BB501Cull, 0x2E0934DEA28ED965ull, /* [0][0x54]*/
+        0x66D8C0F56A91F461ull, 0x19B6303D5AA47D18ull, 0x980521650AFAE693ull, 0xE76BD1AD3ACF6FEAull, /* [0][0x58]*/
+        0x09A6C9329AC4BC9Bull, 0x76C839FAAAF135E2ull, 0xF77B28A2FAAFAE69ull, 0x8815D86ACA9A2710ull, /* [0][0x5c]*/
+        0xC0C42C4102850A14ull, 0xBFAADC8932B0836Dull, 0x3E19CDD162EE18E6ull, 0x41773D1952DB919Full, /* [0][0x60]*/
+        0x269B24CA6B12F26Dull, 0x59F5D4025B277B14ull, 0xD846C55A0B79E09Full, 0xA72835923B4C69E6ull, /* [0][0x64]*/
+        0xEFF9C1B9F35344E2ull, 0x90973171C366CD9Bull, 0x1124202993385610ull, 0x6E4AD0E1A30DDF69ull, /* [0][0x68]*/
+        0x8087C87E03060C18ull, 0xFFE938B633338561ull, 0x7E5A29EE636D1EEAull, 0x0134D92653589793ull, /* [0][0x6c]*/
+        0x49E52D0D9B47BA97ull, 0x368BDDC5AB7233EEull, 0xB738CC9DFB2CA865ull, 0xC8563C55CB19211Cull, /* [0][0x70]*/
+        0x5E7BDBF1E3AC9DECull, 0x21152B39D3991495ull, 0xA0A63A6183C78F1Eull, 0xDFC8CAA9B3F20667ull, /* [0][0x74]*/
+        0x97193E827BED2B63ull, 0xE877CE4A4BD8A21Aull, 0x69C4DF121B863991ull, 0x16AA2FDA2BB3B0E8ull, /* [0][0x78]*/
+        0xF86737458BB86399ull, 0x8709C78DBB8DEAE0ull, 0x06BAD6D5EBD3716Bull, 0x79D4261DDBE6F812ull, /* [0][0x7c]*/
+        0x3105D23613F9D516ull, 0x4E6B22FE23CC5C6Full, 0xCFD833A67392C7E4ull, 0xB0B6C36E43A74E9Dull, /* [0][0x80]*/
+        0x9A6C9329AC4BC9B5ull, 0xE50263E19C7E40CCull, 0x64B172B9CC20DB47ull, 0x1BDF8271FC15523Eull, /* [0][0x84]*/
+        0x530E765A340A7F3Aull, 0x2C608692043FF643ull, 0xADD397CA54616DC8ull, 0xD2BD67026454E4B1ull, /* [0][0x88]*/
+        0x3C707F9DC45F37C0ull, 0x431E8F55F46ABEB9ull, 0xC2AD9E0DA4342532ull, 0xBDC36EC59401AC4Bull, /* [0][0x8c]*/
+        0xF5129AEE5C1E814Full, 0x8A7C6A266C2B0836ull, 0x0BCF7B7E3C7593BDull, 0x74A18BB60C401AC4ull, /* [0][0x90]*/
+        0xE28C6C1224F5A634ull, 0x9DE29CDA14C02F4Dull, 0x1C518D82449EB4C6ull, 0x633F7D4A74AB3DBFull, /* [0][0x94]*/
+        0x2BEE8961BCB410BBull, 0x548079A98C8199C2ull, 0xD53368F1DCDF0249ull, 0xAA5D9839ECEA8B30ull, /* [0][0x98]*/
+        0x449080A64CE15841ull, 0x3BFE706E7CD4D138ull, 0xBA4D61362C8A4AB3ull, 0xC52391FE1CBFC3CAull, /* [0][0x9c]*/
+        0x8DF265D5D4A0EECEull, 0xF29C951DE49567B7ull, 0x732F8445B4CBFC3Cull, 0x0C41748D84FE7545ull, /* [0][0xa0]*/
+        0x6BAD6D5EBD3716B7ull, 0x14C39D968D029FCEull, 0x95708CCEDD5C0445ull, 0xEA1E7C06ED698D3Cull, /* [0][0xa4]*/
+        0xA2CF882D2576A038ull, 0xDDA178E515432941ull, 0x5C1269BD451DB2CAull, 0x237C997575283BB3ull, /* [0][0xa8]*/
+        0xCDB181EAD523E8C2ull, 0xB2DF7122E51661BBull, 0x336C607AB548FA30ull, 0x4C0290B2857D7349ull, /* [0][0xac]*/
+        0x04D364994D625E4Dull, 0x7BBD94517D57D734ull, 0xFA0E85092D094CBFull, 0x856075C11D3CC5C6ull, /* [0][0xb0]*/
+        0x134D926535897936ull, 0x6C2362AD05BCF04Full, 0xED9073F555E26BC4ull, 0x92FE833D65D7E2BDull, /* [0][0xb4]*/
+        0xDA2F7716ADC8CFB9ull, 0xA54187DE9DFD46C0ull, 0x24F29686CDA3DD4Bull, 0x5B9C664EFD965432ull, /* [0][0xb8]*/
+        0xB5517ED15D9D8743ull, 0xCA3F8E196DA80E3Aull, 0x4B8C9F413DF695B1ull, 0x34E26F890DC31CC8ull, /* [0][0xbc]*/
+        0x7C339BA2C5DC31CCull, 0x035D6B6AF5E9B8B5ull, 0x82EE7A32A5B7233Eull, 0xFD808AFA9582AA47ull, /* [0][0xc0]*/
+        0x4D364994D625E4DAull, 0x3258B95CE6106DA3ull, 0xB3EBA804B64EF628ull, 0xCC8558CC867B7F51ull, /* [0][0xc4]*/
+        0x8454ACE74E645255ull, 0xFB3A5C2F7E51DB2Cull, 0x7A894D772E0F40A7ull, 0x05E7BDBF1E3AC9DEull, /* [0][0xc8]*/
+        0xEB2AA520BE311AAFull, 0x944455E88E0493D6ull, 0x15F744B0DE5A085Dull, 0x6A99B478EE6F8124ull, /* [0][0xcc]*/
+        0x224840532670AC20ull, 0x5D26B09B16452559ull, 0xDC95A1C3461BBED2ull, 0xA3FB510B762E37ABull, /* [0][0xd0]*/
+        0x35D6B6AF5E9B8B5Bull, 0x4AB846676EAE0222ull, 0xCB0B573F3EF099A9ull, 0xB465A7F70EC510D0ull, /* [0][0xd4]*/
+        0xFCB453DCC6DA3DD4ull, 0x83DAA314F6EFB4ADull, 0x0269B24CA6B12F26ull, 0x7D0742849684A65Full, /* [0][0xd8]*/
+        0x93CA5A1B368F752Eull, 0xECA4AAD306BAFC57ull, 0x6D17BB8B56E467DCull, 0x12794B4366D1EEA5ull, /* [0][0xdc]*/
+        0x5AA8BF68AECEC3A1ull, 0x25C64FA09EFB4AD8ull, 0xA4755EF8CEA5D153ull, 0xDB1BAE30FE90582Aull, /* [0][0xe0]*/
+        0xBCF7B7E3C7593BD8ull, 0xC399472BF76CB2A1ull, 0x422A5673A732292Aull, 0x3D44A6BB9707A053ull, /* [0][0xe4]*/
+        0x759552905F188D57ull, 0x0AFBA2586F2D042Eull, 0x8B48B3003F739FA5ull, 0xF42643C80F4616DCull, /* [0][0xe8]*/
+        0x1AEB5B57AF4DC5ADull, 0x6585AB9F9F784CD4ull, 0xE436BAC7CF26D75Full, 0x9B584A0FFF135E26ull, /* [0][0xec]*/
+        0xD389BE24370C7322ull, 0xACE74EEC0739FA5Bull, 0x2D545FB4576761D0ull, 0x523AAF7C6752E8A9ull, /* [0][0xf0]*/
+        0xC41748D84FE75459ull, 0xBB79B8107FD2DD20ull, 0x3ACAA9482F8C46ABull, 0x45A459801FB9CFD2ull, /* [0][0xf4]*/
+        0x0D75ADABD7A6E2D6ull, 0x721B5D63E7936BAFull, 0xF3A84C3BB7CDF024ull, 0x8CC6BCF387F8795Dull, /* [0][0xf8]*/
+        0x620BA46C27F3AA2Cull, 0x1D6554A417C62355ull, 0x9CD645FC4798B8DEull, 0xE3B8B53477AD31A7ull, /* [0][0xfc]*/
+        0xAB69411FBFB21CA3ull, 0xD407B1D78F8795DAull, 0x55B4A08FDFD90E51ull, 0x2ADA5047EFEC8728ull  /* [0][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0x8776A97D73BDDF69ull, 0x3A3474A9BFEC2DB9ull, 0xBD42DDD4CC51F2D0ull, /* [1][0x04]*/
+        0x7468E9537FD85B72ull, 0xF31E402E0C65841Bull, 0x4E5C9DFAC03476CBull, 0xC92A3487B389A9A2ull, /* [1][0x08]*/
+        0xE8D1D2A6FFB0B6E4ull, 0x6FA77BDB8C0D698Dull, 0xD2E5A60F405C9B5Dull, 0x55930F7233E14434ull, /* [1][0x0c]*/
+        0x9CB93BF58068ED96ull, 0x1BCF9288F3D532FFull, 0xA68D4F5C3F84C02Full, 0x21FBE6214C391F46ull, /* [1][0x10]*/
+        0xE57A831EA7F6FEA3ull, 0x620C2A63D44B21CAull, 0xDF4EF7B7181AD31Aull, 0x58385ECA6BA70C73ull, /* [1][0x14]*/
+        0x91126A4DD82EA5D1ull, 0x1664C330AB937AB8ull, 0xAB261EE467C28868ull, 0x2C50B799147F5701ull, /* [1][0x18]*/
+        0x0DAB51B858464847ull, 0x8ADDF8C52BFB972Eull, 0x379F2511E7AA65FEull, 0xB0E98C6C9417BA97ull, /* [1][0x1c]*/
+        0x79C3B8EB279E1335ull, 0xFEB511965423CC5Cull, 0x43F7CC4298723E8Cull, 0xC481653FEBCFE1E5ull, /* [1][0x20]*/
+        0xFE2C206E177A6E2Dull, 0x795A891364C7B144ull, 0xC41854C7A8964394ull, 0x436EFDBADB2B9CFDull, /* [1][0x24]*/
+        0x8A44C93D68A2355Full, 0x0D3260401B1FEA36ull, 0xB070BD94D74E18E6ull, 0x370614E9A4F3C78Full, /* [1][0x28]*/
+        0x16FDF2C8E8CAD8C9ull, 0x918B5BB59B7707A0ull, 0x2CC986615726F570ull, 0xABBF2F1C249B2A19ull, /* [1][0x2c]*/
+        0x62951B9B971283BBull, 0xE5E3B2E6E4AF5CD2ull, 0x58A16F3228FEAE02ull, 0xDFD7C64F5B43716Bull, /* [1][0x30]*/
+        0x1B56A370B08C908Eull, 0x9C200A0DC3314FE7ull, 0x2162D7D90F60BD37ull, 0xA6147EA47CDD625Eull, /* [1][0x34]*/
+        0x6F3E4A23CF54CBFCull, 0xE848E35EBCE91495ull, 0x550A3E8A70B8E645ull, 0xD27C97F70305392Cull, /* [1][0x38]*/
+        0xF38771D64F3C266Aull, 0x74F1D8AB3C81F903ull, 0xC9B3057FF0D00BD3ull, 0x4EC5AC02836DD4BAull, /* [1][0x3c]*/
+        0x87EF988530E47D18ull, 0x009931F84359A271ull, 0xBDDBEC2C8F0850A1ull, 0x3AAD4551FCB58FC8ull, /* [1][0x40]*/
+        0xC881668F76634F31ull, 0x4FF7CFF205DE9058ull, 0xF2B51226C98F6288ull, 0x75C3BB5BBA32BDE1ull, /* [1][0x44]*/
+        0xBCE98FDC09BB1443ull, 0x3B9F26A17A06CB2Aull, 0x86DDFB75B65739FAull, 0x01AB5208C5EAE693ull, /* [1][0x48]*/
+        0x2050B42989D3F9D5ull, 0xA7261D54FA6E26BCull, 0x1A64C080363FD46Cull, 0x9D1269FD45820B05ull, /* [1][0x4c]*/
+        0x54385D7AF60BA2A7ull, 0xD34EF40785B67DCEull, 0x6E0C29D349E78F1Eull, 0xE97A80AE3A5A5077ull, /* [1][0x50]*/
+        0x2DFBE591D195B192ull, 0xAA8D4CECA2286EFBull, 0x17CF91386E799C2Bull, 0x90B938451DC44342ull, /* [1][0x54]*/
+        0x59930CC2AE4DEAE0ull, 0xDEE5A5BFDDF03589ull, 0x63A7786B11A1C759ull, 0xE4D1D116621C1830ull, /* [1][0x58]*/
+        0xC52A37372E250776ull, 0x425C9E4A5D98D81Full, 0xFF1E439E91C92ACFull, 0x7868EAE3E274F5A6ull, /* [1][0x5c]*/
+        0xB142DE6451FD5C04ull, 0x363477192240836Dull, 0x8B76AACDEE1171BDull, 0x0C0003B09DACAED4ull, /* [1][0x60]*/
+        0x36AD46E16119211Cull, 0xB1DBEF9C12A4FE75ull, 0x0C993248DEF50CA5ull, 0x8BEF9B35AD48D3CCull, /* [1][0x64]*/
+        0x42C5AFB21EC17A6Eull, 0xC5B306CF6D7CA507ull, 0x78F1DB1BA12D57D7ull, 0xFF877266D29088BEull, /* [1][0x68]*/
+        0xDE7C94479EA997F8ull, 0x590A3D3AED144891ull, 0xE448E0EE2145BA41ull, 0x633E499352F86528ull, /* [1][0x6c]*/
+        0xAA147D14E171CC8Aull, 0x2D62D46992CC13E3ull, 0x902009BD5E9DE133ull, 0x1756A0C02D203E5Aull, /* [1][0x70]*/
+        0xD3D7C5FFC6EFDFBFull, 0x54A16C82B55200D6ull, 0xE9E3B1567903F206ull, 0x6E95182B0ABE2D6Full, /* [1][0x74]*/
+        0xA7BF2CACB93784CDull, 0x20C985D1CA8A5BA4ull, 0x9D8B580506DBA974ull, 0x1AFDF1787566761Dull, /* [1][0x78]*/
+        0x3B061759395F695Bull, 0xBC70BE244AE2B632ull, 0x013263F086B344E2ull, 0x8644CA8DF50E9B8Bull, /* [1][0x7c]*/
+        0x4F6EFE0A46873229ull, 0xC8185777353AED40ull, 0x755A8AA3F96B1F90ull, 0xF22C23DE8AD6C0F9ull, /* [1][0x80]*/
+        0xA5DBEB4DB4510D09ull, 0x22AD4230C7ECD260ull, 0x9FEF9FE40BBD20B0ull, 0x189936997800FFD9ull, /* [1][0x84]*/
+        0xD1B3021ECB89567Bull, 0x56C5AB63B8348912ull, 0xEB8776B774657BC2ull, 0x6CF1DFCA07D8A4ABull, /* [1][0x88]*/
+        0x4D0A39EB4BE1BBEDull, 0xCA7C9096385C6484ull, 0x773E4D42F40D9654ull, 0xF048E43F87B0493Dull, /* [1][0x8c]*/
+        0x3962D0B83439E09Full, 0xBE1479C547843FF6ull, 0x0356A4118BD5CD26ull, 0x84200D6CF868124Full, /* [1][0x90]*/
+        0x40A1685313A7F3AAull, 0xC7D7C12E601A2CC3ull, 0x7A951CFAAC4BDE13ull, 0xFDE3B587DFF6017Aull, /* [1][0x94]*/
+        0x34C981006C7FA8D8ull, 0xB3BF287D1FC277B1ull, 0x0EFDF5A9D3938561ull, 0x898B5CD4A02E5A08ull, /* [1][0x98]*/
+        0xA870BAF5EC17454Eull, 0x2F0613889FAA9A27ull, 0x9244CE5C53FB68F7ull, 0x153267212046B79Eull, /* [1][0x9c]*/
+        0xDC1853A693CF1E3Cull, 0x5B6EFADBE072C155ull, 0xE62C270F2C233385ull, 0x615A8E725F9EECECull, /* [1][0xa0]*/
+        0x5BF7CB23A32B6324ull, 0xDC81625ED096BC4Dull, 0x61C3BF8A1CC74E9Dull, 0xE6B516F76F7A91F4ull, /* [1][0xa4]*/
+        0x2F9F2270DCF33856ull, 0xA8E98B0DAF4EE73Full, 0x15AB56D9631F15EFull, 0x92DDFFA410A2CA86ull, /* [1][0xa8]*/
+        0xB32619855C9BD5C0ull, 0x3450B0F82F260AA9ull, 0x89126D2CE377F879ull, 0x0E64C45190CA2710ull, /* [1][0xac]*/
+        0xC74EF0D623438EB2ull, 0x403859AB50FE51DBull, 0xFD7A847F9CAFA30Bull, 0x7A0C2D02EF127C62ull, /* [1][0xb0]*/
+        0xBE8D483D04DD9D87ull, 0x39FBE140776042EEull, 0x84B93C94BB31B03Eull, 0x03CF95E9C88C6F57ull, /* [1][0xb4]*/
+        0xCAE5A16E7B05C6F5ull, 0x4D93081308B8199Cull, 0xF0D1D5C7C4E9EB4Cull, 0x77A77CBAB7543425ull, /* [1][0xb8]*/
+        0x565C9A9BFB6D2B63ull, 0xD12A33E688D0F40Aull, 0x6C68EE32448106DAull, 0xEB1E474F373CD9B3ull, /* [1][0xbc]*/
+        0x223473C884B57011ull, 0xA542DAB5F708AF78ull, 0x180007613B595DA8ull, 0x9F76AE1C48E482C1ull, /* [1][0xc0]*/
+        0x6D5A8DC2C2324238ull, 0xEA2C24BFB18F9D51ull, 0x576EF96B7DDE6F81ull, 0xD01850160E63B0E8ull, /* [1][0xc4]*/
+        0x19326491BDEA194Aull, 0x9E44CDECCE57C623ull, 0x23061038020634F3ull, 0xA470B94571BBEB9Aull, /* [1][0xc8]*/
+        0x858B5F643D82F4DCull, 0x02FDF6194E3F2BB5ull, 0xBFBF2BCD826ED965ull, 0x38C982B0F1D3060Cull, /* [1][0xcc]*/
+        0xF1E3B637425AAFAEull, 0x76951F4A31E770C7ull, 0xCBD7C29EFDB68217ull, 0x4CA16BE38E0B5D7Eull, /* [1][0xd0]*/
+        0x88200EDC65C4BC9Bull, 0x0F56A7A1167963F2ull, 0xB2147A75DA289122ull, 0x3562D308A9954E4Bull, /* [1][0xd4]*/
+        0xFC48E78F1A1CE7E9ull, 0x7B3E4EF269A13880ull, 0xC67C9326A5F0CA50ull, 0x410A3A5BD64D1539ull, /* [1][0xd8]*/
+        0x60F1DC7A9A740A7Full, 0xE7877507E9C9D516ull, 0x5AC5A8D3259827C6ull, 0xDDB301AE5625F8AFull, /* [1][0xdc]*/
+        0x14993529E5AC510Dull, 0x93EF9C5496118E64ull, 0x2EAD41805A407CB4ull, 0xA9DBE8FD29FDA3DDull, /* [1][0xe0]*/
+        0x9376ADACD5482C15ull, 0x140004D1A6F5F37Cull, 0xA942D9056AA401ACull, 0x2E3470781919DEC5ull, /* [1][0xe4]*/
+        0xE71E44FFAA907767ull, 0x6068ED82D92DA80Eull, 0xDD2A3056157C5ADEull, 0x5A5C992B66C185B7ull, /* [1][0xe8]*/
+        0x7BA77F0A2AF89AF1ull, 0xFCD1D67759454598ull, 0x41930BA39514B748ull, 0xC6E5A2DEE6A96821ull, /* [1][0xec]*/
+        0x0FCF96595520C183ull, 0x88B93F24269D1EEAull, 0x35FBE2F0EACCEC3Aull, 0xB28D4B8D99713353ull, /* [1][0xf0]*/
+        0x760C2EB272BED2B6ull, 0xF17A87CF01030DDFull, 0x4C385A1BCD52FF0Full, 0xCB4EF366BEEF2066ull, /* [1][0xf4]*/
+        0x0264C7E10D6689C4ull, 0x85126E9C7EDB56ADull, 0x3850B348B28AA47Dull, 0xBF261A35C1377B14ull, /* [1][0xf8]*/
+        0x9EDDFC148D0E6452ull, 0x19AB5569FEB3BB3Bull, 0xA4E988BD32E249EBull, 0x239F21C0415F9682ull, /* [1][0xfc]*/
+        0xEAB51547F2D63F20ull, 0x6DC3BC3A816BE049ull, 0xD08161EE4D3A1299ull, 0x57F7C8933E87CDF0ull  /* [1][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0xFF6E4E1F4E4038BEull, 0xCA05BA6DC417E217ull, 0x356BF4728A57DAA9ull, /* [2][0x04]*/
+        0xA0D25288D0B85745ull, 0x5FBC1C979EF86FFBull, 0x6AD7E8E514AFB552ull, 0x95B9A6FA5AEF8DECull, /* [2][0x08]*/
+        0x757D8342F9E73DE1ull, 0x8A13CD5DB7A7055Full, 0xBF78392F3DF0DFF6ull, 0x4016773073B0E748ull, /* [2][0x0c]*/
+        0xD5AFD1CA295F6AA4ull, 0x2AC19FD5671F521Aull, 0x1FAA6BA7ED4888B3ull, 0xE0C425B8A308B00Dull, /* [2][0x10]*/
+        0xEAFB0685F3CE7BC2ull, 0x1595489ABD8E437Cull, 0x20FEBCE837D999D5ull, 0xDF90F2F77999A16Bull, /* [2][0x14]*/
+        0x4A29540D23762C87ull, 0xB5471A126D361439ull, 0x802CEE60E761CE90ull, 0x7F42A07FA921F62Eull, /* [2][0x18]*/
+        0x9F8685C70A294623ull, 0x60E8CBD844697E9Dull, 0x55833FAACE3EA434ull, 0xAAED71B5807E9C8Aull, /* [2][0x1c]*/
+        0x3F54D74FDA911166ull, 0xC03A995094D129D8ull, 0xF5516D221E86F371ull, 0x0A3F233D50C6CBCFull, /* [2][0x20]*/
+        0xE12F2B58BF0B64EFull, 0x1E416547F14B5C51ull, 0x2B2A91357B1C86F8ull, 0xD444DF2A355CBE46ull, /* [2][0x24]*/
+        0x41FD79D06FB333AAull, 0xBE9337CF21F30B14ull, 0x8BF8C3BDABA4D1BDull, 0x74968DA2E5E4E903ull, /* [2][0x28]*/
+        0x9452A81A46EC590Eull, 0x6B3CE60508AC61B0ull, 0x5E57127782FBBB19ull, 0xA1395C68CCBB83A7ull, /* [2][0x2c]*/
+        0x3480FA9296540E4Bull, 0xCBEEB48DD81436F5ull, 0xFE8540FF5243EC5Cull, 0x01EB0EE01C03D4E2ull, /* [2][0x30]*/
+        0x0BD42DDD4CC51F2Dull, 0xF4BA63C202852793ull, 0xC1D197B088D2FD3Aull, 0x3EBFD9AFC692C584ull, /* [2][0x34]*/
+        0xAB067F559C7D4868ull, 0x5468314AD23D70D6ull, 0x6103C538586AAA7Full, 0x9E6D8B27162A92C1ull, /* [2][0x38]*/
+        0x7EA9AE9FB52222CCull, 0x81C7E080FB621A72ull, 0xB4AC14F27135C0DBull, 0x4BC25AED3F75F865ull, /* [2][0x3c]*/
+        0xDE7BFC17659A7589ull, 0x2115B2082BDA4D37ull, 0x147E467AA18D979Eull, 0xEB100865EFCDAF20ull, /* [2][0x40]*/
+        0xF68770E226815AB5ull, 0x09E93EFD68C1620Bull, 0x3C82CA8FE296B8A2ull, 0xC3EC8490ACD6801Cull, /* [2][0x44]*/
+        0x5655226AF6390DF0ull, 0xA93B6C75B879354Eull, 0x9C509807322EEFE7ull, 0x633ED6187C6ED759ull, /* [2][0x48]*/
+        0x83FAF3A0DF666754ull, 0x7C94BDBF91265FEAull, 0x49FF49CD1B718543ull, 0xB69107D25531BDFDull, /* [2][0x4c]*/
+        0x2328A1280FDE3011ull, 0xDC46EF37419E08AFull, 0xE92D1B45CBC9D206ull, 0x1643555A8589EAB8ull, /* [2][0x50]*/
+        0x1C7C7667D54F2177ull, 0xE31238789B0F19C9ull, 0xD679CC0A1158C360ull, 0x291782155F18FBDEull, /* [2][0x54]*/
+        0xBCAE24EF05F77632ull, 0x43C06AF04BB74E8Cull, 0x76AB9E82C1E09425ull, 0x89C5D09D8FA0AC9Bull, /* [2][0x58]*/
+        0x6901F5252CA81C96ull, 0x966FBB3A62E82428ull, 0xA3044F48E8BFFE81ull, 0x5C6A0157A6FFC63Full, /* [2][0x5c]*/
+        0xC9D3A7ADFC104BD3ull, 0x36BDE9B2B250736Dull, 0x03D61DC03807A9C4ull, 0xFCB853DF7647917Aull, /* [2][0x60]*/
+        0x17A85BBA998A3E5Aull, 0xE8C615A5D7CA06E4ull, 0xDDADE1D75D9DDC4Dull, 0x22C3AFC813DDE4F3ull, /* [2][0x64]*/
+        0xB77A09324932691Full, 0x4814472D077251A1ull, 0x7D7FB35F8D258B08ull, 0x8211FD40C365B3B6ull, /* [2][0x68]*/
+        0x62D5D8F8606D03BBull, 0x9DBB96E72E2D3B05ull, 0xA8D06295A47AE1ACull, 0x57BE2C8AEA3AD912ull, /* [2][0x6c]*/
+        0xC2078A70B0D554FEull, 0x3D69C46FFE956C40ull, 0x0802301D74C2B6E9ull, 0xF76C7E023A828E57ull, /* [2][0x70]*/
+        0xFD535D3F6A444598ull, 0x023D132024047D26ull, 0x3756E752AE53A78Full, 0xC838A94DE0139F31ull, /* [2][0x74]*/
+        0x5D810FB7BAFC12DDull, 0xA2EF41A8F4BC2A63ull, 0x9784B5DA7EEBF0CAull, 0x68EAFBC530ABC874ull, /* [2][0x78]*/
+        0x882EDE7D93A37879ull, 0x77409062DDE340C7ull, 0x422B641057B49A6Eull, 0xBD452A0F19F4A2D0ull, /* [2][0x7c]*/
+        0x28FC8CF5431B2F3Cull, 0xD792C2EA0D5B1782ull, 0xE2F93698870CCD2Bull, 0x1D977887C94CF595ull, /* [2][0x80]*/
+        0xD9D7C79715952601ull, 0x26B989885BD51EBFull, 0x13D27DFAD182C416ull, 0xECBC33E59FC2FCA8ull, /* [2][0x84]*/
+        0x7905951FC52D7144ull, 0x866BDB008B6D49FAull, 0xB3002F72013A9353ull, 0x4C6E616D4F7AABEDull, /* [2][0x88]*/
+        0xACAA44D5EC721BE0ull, 0x53C40ACAA232235Eull, 0x66AFFEB82865F9F7ull, 0x99C1B0A76625C149ull, /* [2][0x8c]*/
+        0x0C78165D3CCA4CA5ull, 0xF3165842728A741Bull, 0xC67DAC30F8DDAEB2ull, 0x3913E22FB69D960Cull, /* [2][0x90]*/
+        0x332CC112E65B5DC3ull, 0xCC428F0DA81B657Dull, 0xF9297B7F224CBFD4ull, 0x064735606C0C876Aull, /* [2][0x94]*/
+        0x93FE939A36E30A86ull, 0x6C90DD8578A33238ull, 0x59FB29F7F2F4E891ull, 0xA69567E8BCB4D02Full, /* [2][0x98]*/
+        0x465142501FBC6022ull, 0xB93F0C4F51FC589Cull, 0x8C54F83DDBAB8235ull, 0x733AB62295EBBA8Bull, /* [2][0x9c]*/
+        0xE68310D8CF043767ull, 0x19ED5EC781440FD9ull, 0x2C86AAB50B13D570ull, 0xD3E8E4AA4553EDCEull, /* [2][0xa0]*/
+        0x38F8ECCFAA9E42EEull, 0xC796A2D0E4DE7A50ull, 0xF2FD56A26E89A0F9ull, 0x0D9318BD20C99847ull, /* [2][0xa4]*/
+        0x982ABE477A2615ABull, 0x6744F05834662D15ull, 0x522F042ABE31F7BCull, 0xAD414A35F071CF02ull, /* [2][0xa8]*/
+        0x4D856F8D53797F0Full, 0xB2EB21921D3947B1ull, 0x8780D5E0976E9D18ull, 0x78EE9BFFD92EA5A6ull, /* [2][0xac]*/
+        0xED573D0583C1284Aull, 0x1239731ACD8110F4ull, 0x2752876847D6CA5Dull, 0xD83CC9770996F2E3ull, /* [2][0xb0]*/
+        0xD203EA4A5950392Cull, 0x2D6DA45517100192ull, 0x180650279D47DB3Bull, 0xE7681E38D307E385ull, /* [2][0xb4]*/
+        0x72D1B8C289E86E69ull, 0x8DBFF6DDC7A856D7ull, 0xB8D402AF4DFF8C7Eull, 0x47BA4CB003BFB4C0ull, /* [2][0xb8]*/
+        0xA77E6908A0B704CDull, 0x58102717EEF73C73ull, 0x6D7BD36564A0E6DAull, 0x92159D7A2AE0DE64ull, /* [2][0xbc]*/
+        0x07AC3B80700F5388ull, 0xF8C2759F3E4F6B36ull, 0xCDA981EDB418B19Full, 0x32C7CFF2FA588921ull, /* [2][0xc0]*/
+        0x2F50B77533147CB4ull, 0xD03EF96A7D54440Aull, 0xE5550D18F7039EA3ull, 0x1A3B4307B943A61Dull, /* [2][0xc4]*/
+        0x8F82E5FDE3AC2BF1ull, 0x70ECABE2ADEC134Full, 0x45875F9027BBC9E6ull, 0xBAE9118F69FBF158ull, /* [2][0xc8]*/
+        0x5A2D3437CAF34155ull, 0xA5437A2884B379EBull, 0x90288E5A0EE4A342ull, 0x6F46C04540A49BFCull, /* [2][0xcc]*/
+        0xFAFF66BF1A4B1610ull, 0x059128A0540B2EAEull, 0x30FADCD2DE5CF407ull, 0xCF9492CD901CCCB9ull, /* [2][0xd0]*/
+        0xC5ABB1F0C0DA0776ull, 0x3AC5FFEF8E9A3FC8ull, 0x0FAE0B9D04CDE561ull, 0xF0C045824A8DDDDFull, /* [2][0xd4]*/
+        0x6579E37810625033ull, 0x9A17AD675E22688Dull, 0xAF7C5915D475B224ull, 0x5012170A9A358A9Aull, /* [2][0xd8]*/
+        0xB0D632B2393D3A97ull, 0x4FB87CAD777D0229ull, 0x7AD388DFFD2AD880ull, 0x85BDC6C0B36AE03Eull, /* [2][0xdc]*/
+        0x1004603AE9856DD2ull, 0xEF6A2E25A7C5556Cull, 0xDA01DA572D928FC5ull, 0x256F944863D2B77Bull, /* [2][0xe0]*/
+        0xCE7F9C2D8C1F185Bull, 0x3111D232C25F20E5ull, 0x047A26404808FA4Cull, 0xFB14685F0648C2F2ull, /* [2][0xe4]*/
+        0x6EADCEA55CA74F1Eull, 0x91C380BA12E777A0ull, 0xA4A874C898B0AD09ull, 0x5BC63AD7D6F095B7ull, /* [2][0xe8]*/
+        0xBB021F6F75F825BAull, 0x446C51703BB81D04ull, 0x7107A502B1EFC7ADull, 0x8E69EB1DFFAFFF13ull, /* [2][0xec]*/
+        0x1BD04DE7A54072FFull, 0xE4BE03F8EB004A41ull, 0xD1D5F78A615790E8ull, 0x2EBBB9952F17A856ull, /* [2][0xf0]*/
+        0x24849AA87FD16399ull, 0xDBEAD4B731915B27ull, 0xEE8120C5BBC6818Eull, 0x11EF6EDAF586B930ull, /* [2][0xf4]*/
+        0x8456C820AF6934DCull, 0x7B38863FE1290C62ull, 0x4E53724D6B7ED6CBull, 0xB13D3C52253EEE75ull, /* [2][0xf8]*/
+        0x51F919EA86365E78ull, 0xAE9757F5C87666C6ull, 0x9BFCA3874221BC6Full, 0x6492ED980C6184D1ull, /* [2][0xfc]*/
+        0xF12B4B62568E093Dull, 0x0E45057D18CE3183ull, 0x3B2EF10F9299EB2Aull, 0xC440BF10DCD9D394ull  /* [2][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0x8211147CBAF96306ull, 0x30FB0EAA2D655567ull, 0xB2EA1AD6979C3661ull, /* [3][0x04]*/
+        0x61F61D545ACAAACEull, 0xE3E70928E033C9C8ull, 0x510D13FE77AFFFA9ull, 0xD31C0782CD569CAFull, /* [3][0x08]*/
+        0xC3EC3AA8B595559Cull, 0x41FD2ED40F6C369Aull, 0xF317340298F000FBull, 0x7106207E220963FDull, /* [3][0x0c]*/
+        0xA21A27FCEF5FFF52ull, 0x200B338055A69C54ull, 0x92E12956C23AAA35ull, 0x10F03D2A78C3C933ull, /* [3][0x10]*/
+        0xB301530233BD3853ull, 0x3110477E89445B55ull, 0x83FA5DA81ED86D34ull, 0x01EB49D4A4210E32ull, /* [3][0x14]*/
+        0xD2F74E566977929Dull, 0x50E65A2AD38EF19Bull, 0xE20C40FC4412C7FAull, 0x601D5480FEEBA4FCull, /* [3][0x18]*/
+        0x70ED69AA86286DCFull, 0xF2FC7DD63CD10EC9ull, 0x40166700AB4D38A8ull, 0xC207737C11B45BAEull, /* [3][0x1c]*/
+        0x111B74FEDCE2C701ull, 0x930A6082661BA407ull, 0x21E07A54F1879266ull, 0xA3F16E284B7EF160ull, /* [3][0x20]*/
+        0x52DB80573FEDE3CDull, 0xD0CA942B851480CBull, 0x62208EFD1288B6AAull, 0xE0319A81A871D5ACull, /* [3][0x24]*/
+        0x332D9D0365274903ull, 0xB13C897FDFDE2A05ull, 0x03D693A948421C64ull, 0x81C787D5F2BB7F62ull, /* [3][0x28]*/
+        0x9137BAFF8A78B651ull, 0x1326AE833081D557ull, 0xA1CCB455A71DE336ull, 0x23DDA0291DE48030ull, /* [3][0x2c]*/
+        0xF0C1A7ABD0B21C9Full, 0x72D0B3D76A4B7F99ull, 0xC03AA901FDD749F8ull, 0x422BBD7D472E2AFEull, /* [3][0x30]*/
+        0xE1DAD3550C50DB9Eull, 0x63CBC729B6A9B898ull, 0xD121DDFF21358EF9ull, 0x5330C9839BCCEDFFull, /* [3][0x34]*/
+        0x802CCE01569A7150ull, 0x023DDA7DEC631256ull, 0xB0D7C0AB7BFF2437ull, 0x32C6D4D7C1064731ull, /* [3][0x38]*/
+        0x2236E9FDB9C58E02ull, 0xA027FD81033CED04ull, 0x12CDE75794A0DB65ull, 0x90DCF32B2E59B863ull, /* [3][0x3c]*/
+        0x43C0F4A9E30F24CCull, 0xC1D1E0D559F647CAull, 0x733BFA03CE6A71ABull, 0xF12AEE7F749312ADull, /* [3][0x40]*/
+        0xA5B700AE7FDBC79Aull, 0x27A614D2C522A49Cull, 0x954C0E0452BE92FDull, 0x175D1A78E847F1FBull, /* [3][0x44]*/
+        0xC4411DFA25116D54ull, 0x465009869FE80E52ull, 0xF4BA135008743833ull, 0x76AB072CB28D5B35ull, /* [3][0x48]*/
+        0x665B3A06CA4E9206ull, 0xE44A2E7A70B7F100ull, 0x56A034ACE72BC761ull, 0xD4B120D05DD2A467ull, /* [3][0x4c]*/
+        0x07AD2752908438C8ull, 0x85BC332E2A7D5BCEull, 0x375629F8BDE16DAFull, 0xB5473D8407180EA9ull, /* [3][0x50]*/
+        0x16B653AC4C66FFC9ull, 0x94A747D0F69F9CCFull, 0x264D5D066103AAAEull, 0xA45C497ADBFAC9A8ull, /* [3][0x54]*/
+        0x77404EF816AC5507ull, 0xF5515A84AC553601ull, 0x47BB40523BC90060ull, 0xC5AA542E81306366ull, /* [3][0x58]*/
+        0xD55A6904F9F3AA55ull, 0x574B7D78430AC953ull, 0xE5A167AED496FF32ull, 0x67B073D26E6F9C34ull, /* [3][0x5c]*/
+        0xB4AC7450A339009Bull, 0x36BD602C19C0639Dull, 0x84577AFA8E5C55FCull, 0x06466E8634A536FAull, /* [3][0x60]*/
+        0xF76C80F940362457ull, 0x757D9485FACF4751ull, 0xC7978E536D537130ull, 0x45869A2FD7AA1236ull, /* [3][0x64]*/
+        0x969A9DAD1AFC8E99ull, 0x148B89D1A005ED9Full, 0xA66193073799DBFEull, 0x2470877B8D60B8F8ull, /* [3][0x68]*/
+        0x3480BA51F5A371CBull, 0xB691AE2D4F5A12CDull, 0x047BB4FBD8C624ACull, 0x866AA087623F47AAull, /* [3][0x6c]*/
+        0x5576A705AF69DB05ull, 0xD767B3791590B803ull, 0x658DA9AF820C8E62ull, 0xE79CBDD338F5ED64ull, /* [3][0x70]*/
+        0x446DD3FB738B1C04ull, 0xC67CC787C9727F02ull, 0x7496DD515EEE4963ull, 0xF687C92DE4172A65ull, /* [3][0x74]*/
+        0x259BCEAF2941B6CAull, 0xA78ADAD393B8D5CCull, 0x1560C0050424E3ADull, 0x9771D479BEDD80ABull, /* [3][0x78]*/
+        0x8781E953C61E4998ull, 0x0590FD2F7CE72A9Eull, 0xB77AE7F9EB7B1CFFull, 0x356BF38551827FF9ull, /* [3][0x7c]*/
+        0xE677F4079CD4E356ull, 0x6466E07B262D8050ull, 0xD68CFAADB1B1B631ull, 0x549DEED10B48D537ull, /* [3][0x80]*/
+        0x7FB7270FA7201C5Full, 0xFDA633731DD97F59ull, 0x4F4C29A58A454938ull, 0xCD5D3DD930BC2A3Eull, /* [3][0x84]*/
+        0x1E413A5BFDEAB691ull, 0x9C502E274713D597ull, 0x2EBA34F1D08FE3F6ull, 0xACAB208D6A7680F0ull, /* [3][0x88]*/
+        0xBC5B1DA712B549C3ull, 0x3E4A09DBA84C2AC5ull, 0x8CA0130D3FD01CA4ull, 0x0EB1077185297FA2ull, /* [3][0x8c]*/
+        0xDDAD00F3487FE30Dull, 0x5FBC148FF286800Bull, 0xED560E59651AB66Aull, 0x6F471A25DFE3D56Cull, /* [3][0x90]*/
+        0xCCB6740D949D240Cull, 0x4EA760712E64470Aull, 0xFC4D7AA7B9F8716Bull, 0x7E5C6EDB0301126Dull, /* [3][0x94]*/
+        0xAD406959CE578EC2ull, 0x2F517D2574AEEDC4ull, 0x9DBB67F3E332DBA5ull, 0x1FAA738F59CBB8A3ull, /* [3][0x98]*/
+        0x0F5A4EA521087190ull, 0x8D4B5AD99BF11296ull, 0x3FA1400F0C6D24F7ull, 0xBDB05473B69447F1ull, /* [3][0x9c]*/
+        0x6EAC53F17BC2DB5Eull, 0xECBD478DC13BB858ull, 0x5E575D5B56A78E39ull, 0xDC464927EC5EED3Full, /* [3][0xa0]*/
+        0x2D6CA75898CDFF92ull, 0xAF7DB32422349C94ull, 0x1D97A9F2B5A8AAF5ull, 0x9F86BD8E0F51C9F3ull, /* [3][0xa4]*/
+        0x4C9ABA0CC207555Cull, 0xCE8BAE7078FE365Aull, 0x7C61B4A6EF62003Bull, 0xFE70A0DA559B633Dull, /* [3][0xa8]*/
+        0xEE809DF02D58AA0Eull, 0x6C91898C97A1C908ull, 0xDE7B935A003DFF69ull, 0x5C6A8726BAC49C6Full, /* [3][0xac]*/
+        0x8F7680A4779200C0ull, 0x0D6794D8CD6B63C6ull, 0xBF8D8E0E5AF755A7ull, 0x3D9C9A72E00E36A1ull, /* [3][0xb0]*/
+        0x9E6DF45AAB70C7C1ull, 0x1C7CE0261189A4C7ull, 0xAE96FAF0861592A6ull, 0x2C87EE8C3CECF1A0ull, /* [3][0xb4]*/
+        0xFF9BE90EF1BA6D0Full, 0x7D8AFD724B430E09ull, 0xCF60E7A4DCDF3868ull, 0x4D71F3D866265B6Eull, /* [3][0xb8]*/
+        0x5D81CEF21EE5925Dull, 0xDF90DA8EA41CF15Bull, 0x6D7AC0583380C73Aull, 0xEF6BD4248979A43Cull, /* [3][0xbc]*/
+        0x3C77D3A6442F3893ull, 0xBE66C7DAFED65B95ull, 0x0C8CDD0C694A6DF4ull, 0x8E9DC970D3B30EF2ull, /* [3][0xc0]*/
+        0xDA0027A1D8FBDBC5ull, 0x581133DD6202B8C3ull, 0xEAFB290BF59E8EA2ull, 0x68EA3D774F67EDA4ull, /* [3][0xc4]*/
+        0xBBF63AF58231710Bull, 0x39E72E8938C8120Dull, 0x8B0D345FAF54246Cull, 0x091C202315AD476Aull, /* [3][0xc8]*/
+        0x19EC1D096D6E8E59ull, 0x9BFD0975D797ED5Full, 0x291713A3400BDB3Eull, 0xAB0607DFFAF2B838ull, /* [3][0xcc]*/
+        0x781A005D37A42497ull, 0xFA0B14218D5D4791ull, 0x48E10EF71AC171F0ull, 0xCAF01A8BA03812F6ull, /* [3][0xd0]*/
+        0x690174A3EB46E396ull, 0xEB1060DF51BF8090ull, 0x59FA7A09C623B6F1ull, 0xDBEB6E757CDAD5F7ull, /* [3][0xd4]*/
+        0x08F769F7B18C4958ull, 0x8AE67D8B0B752A5Eull, 0x380C675D9CE91C3Full, 0xBA1D732126107F39ull, /* [3][0xd8]*/
+        0xAAED4E0B5ED3B60Aull, 0x28FC5A77E42AD50Cull, 0x9A1640A173B6E36Dull, 0x180754DDC94F806Bull, /* [3][0xdc]*/
+        0xCB1B535F04191CC4ull, 0x490A4723BEE07FC2ull, 0xFBE05DF5297C49A3ull, 0x79F1498993852AA5ull, /* [3][0xe0]*/
+        0x88DBA7F6E7163808ull, 0x0ACAB38A5DEF5B0Eull, 0xB820A95CCA736D6Full, 0x3A31BD20708A0E69ull, /* [3][0xe4]*/
+        0xE92DBAA2BDDC92C6ull, 0x6B3CAEDE0725F1C0ull, 0xD9D6B40890B9C7A1ull, 0x5BC7A0742A40A4A7ull, /* [3][0xe8]*/
+        0x4B379D5E52836D94ull, 0xC9268922E87A0E92ull, 0x7BCC93F47FE638F3ull, 0xF9DD8788C51F5BF5ull, /* [3][0xec]*/
+        0x2AC1800A0849C75Aull, 0xA8D09476B2B0A45Cull, 0x1A3A8EA0252C923Dull, 0x982B9ADC9FD5F13Bull, /* [3][0xf0]*/
+        0x3BDAF4F4D4AB005Bull, 0xB9CBE0886E52635Dull, 0x0B21FA5EF9CE553Cull, 0x8930EE224337363Aull, /* [3][0xf4]*/
+        0x5A2CE9A08E61AA95ull, 0xD83DFDDC3498C993ull, 0x6AD7E70AA304FFF2ull, 0xE8C6F37619FD9CF4ull, /* [3][0xf8]*/
+        0xF836CE5C613E55C7ull, 0x7A27DA20DBC736C1ull, 0xC8CDC0F64C5B00A0ull, 0x4ADCD48AF6A263A6ull, /* [3][0xfc]*/
+        0x99C0D3083BF4FF09ull, 0x1BD1C774810D9C0Full, 0xA93BDDA21691AA6Eull, 0x2B2AC9DEAC68C968ull  /* [3][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0x373D15F784905D1Eull, 0x6E7A2BEF0920BA3Cull, 0x59473E188DB0E722ull, /* [4][0x04]*/
+        0xDCF457DE12417478ull, 0xEBC9422996D12966ull, 0xB28E7C311B61CE44ull, 0x85B369C69FF1935Aull, /* [4][0x08]*/
+        0x8D3189EF7C157B9Bull, 0xBA0C9C18F8852685ull, 0xE34BA2007535C1A7ull, 0xD476B7F7F1A59CB9ull, /* [4][0x0c]*/
+        0x51C5DE316E540FE3ull, 0x66F8CBC6EAC452FDull, 0x3FBFF5DE6774B5DFull, 0x0882E029E3E4E8C1ull, /* [4][0x10]*/
+        0x2EBA358DA0BD645Dull, 0x1987207A242D3943ull, 0x40C01E62A99DDE61ull, 0x77FD0B952D0D837Full, /* [4][0x14]*/
+        0xF24E6253B2FC1025ull, 0xC57377A4366C4D3Bull, 0x9C3449BCBBDCAA19ull, 0xAB095C4B3F4CF707ull, /* [4][0x18]*/
+        0xA38BBC62DCA81FC6ull, 0x94B6A995583842D8ull, 0xCDF1978DD588A5FAull, 0xFACC827A5118F8E4ull, /* [4][0x1c]*/
+        0x7F7FEBBCCEE96BBEull, 0x4842FE4B4A7936A0ull, 0x1105C053C7C9D182ull, 0x2638D5A443598C9Cull, /* [4][0x20]*/
+        0x5D746B1B417AC8BAull, 0x6A497EECC5EA95A4ull, 0x330E40F4485A7286ull, 0x04335503CCCA2F98ull, /* [4][0x24]*/
+        0x81803CC5533BBCC2ull, 0xB6BD2932D7ABE1DCull, 0xEFFA172A5A1B06FEull, 0xD8C702DDDE8B5BE0ull, /* [4][0x28]*/
+        0xD045E2F43D6FB321ull, 0xE778F703B9FFEE3Full, 0xBE3FC91B344F091Dull, 0x8902DCECB0DF5403ull, /* [4][0x2c]*/
+        0x0CB1B52A2F2EC759ull, 0x3B8CA0DDABBE9A47ull, 0x62CB9EC5260E7D65ull, 0x55F68B32A29E207Bull, /* [4][0x30]*/
+        0x73CE5E96E1C7ACE7ull, 0x44F34B616557F1F9ull, 0x1DB47579E8E716DBull, 0x2A89608E6C774BC5ull, /* [4][0x34]*/
+        0xAF3A0948F386D89Full, 0x98071CBF77168581ull, 0xC14022A7FAA662A3ull, 0xF67D37507E363FBDull, /* [4][0x38]*/
+        0xFEFFD7799DD2D77Cull, 0xC9C2C28E19428A62ull, 0x9085FC9694F26D40ull, 0xA7B8E9611062305Eull, /* [4][0x3c]*/
+        0x220B80A78F93A304ull, 0x153695500B03FE1Aull, 0x4C71AB4886B31938ull, 0x7B4CBEBF02234426ull, /* [4][0x40]*/
+        0xBAE8D63682F59174ull, 0x8DD5C3C10665CC6Aull, 0xD492FDD98BD52B48ull, 0xE3AFE82E0F457656ull, /* [4][0x44]*/
+        0x661C81E890B4E50Cull, 0x5121941F1424B812ull, 0x0866AA0799945F30ull, 0x3F5BBFF01D04022Eull, /* [4][0x48]*/
+        0x37D95FD9FEE0EAEFull, 0x00E44A2E7A70B7F1ull, 0x59A37436F7C050D3ull, 0x6E9E61C173500DCDull, /* [4][0x4c]*/
+        0xEB2D0807ECA19E97ull, 0xDC101DF06831C389ull, 0x855723E8E58124ABull, 0xB26A361F611179B5ull, /* [4][0x50]*/
+        0x9452E3BB2248F529ull, 0xA36FF64CA6D8A837ull, 0xFA28C8542B684F15ull, 0xCD15DDA3AFF8120Bull, /* [4][0x54]*/
+        0x48A6B46530098151ull, 0x7F9BA192B499DC4Full, 0x26DC9F8A39293B6Dull, 0x11E18A7DBDB96673ull, /* [4][0x58]*/
+        0x19636A545E5D8EB2ull, 0x2E5E7FA3DACDD3ACull, 0x771941BB577D348Eull, 0x4024544CD3ED6990ull, /* [4][0x5c]*/
+        0xC5973D8A4C1CFACAull, 0xF2AA287DC88CA7D4ull, 0xABED1665453C40F6ull, 0x9CD00392C1AC1DE8ull, /* [4][0x60]*/
+        0xE79CBD2DC38F59CEull, 0xD0A1A8DA471F04D0ull, 0x89E696C2CAAFE3F2ull, 0xBEDB83354E3FBEECull, /* [4][0x64]*/
+        0x3B68EAF3D1CE2DB6ull, 0x0C55FF04555E70A8ull, 0x5512C11CD8EE978Aull, 0x622FD4EB5C7ECA94ull, /* [4][0x68]*/
+        0x6AAD34C2BF9A2255ull, 0x5D9021353B0A7F4Bull, 0x04D71F2DB6BA9869ull, 0x33EA0ADA322AC577ull, /* [4][0x6c]*/
+        0xB659631CADDB562Dull, 0x816476EB294B0B33ull, 0xD82348F3A4FBEC11ull, 0xEF1E5D04206BB10Full, /* [4][0x70]*/
+        0xC92688A063323D93ull, 0xFE1B9D57E7A2608Dull, 0xA75CA34F6A1287AFull, 0x9061B6B8EE82DAB1ull, /* [4][0x74]*/
+        0x15D2DF7E717349EBull, 0x22EFCA89F5E314F5ull, 0x7BA8F4917853F3D7ull, 0x4C95E166FCC3AEC9ull, /* [4][0x78]*/
+        0x4417014F1F274608ull, 0x732A14B89BB71B16ull, 0x2A6D2AA01607FC34ull, 0x1D503F579297A12Aull, /* [4][0x7c]*/
+        0x98E356910D663270ull, 0xAFDE436689F66F6Eull, 0xF6997D7E0446884Cull, 0xC1A4688980D6D552ull, /* [4][0x80]*/
+        0x41088A3E5D7CB183ull, 0x76359FC9D9ECEC9Dull, 0x2F72A1D1545C0BBFull, 0x184FB426D0CC56A1ull, /* [4][0x84]*/
+        0x9DFCDDE04F3DC5FBull, 0xAAC1C817CBAD98E5ull, 0xF386F60F461D7FC7ull, 0xC4BBE3F8C28D22D9ull, /* [4][0x88]*/
+        0xCC3903D12169CA18ull, 0xFB041626A5F99706ull, 0xA243283E28497024ull, 0x957E3DC9ACD92D3Aull, /* [4][0x8c]*/
+        0x10CD540F3328BE60ull, 0x27F041F8B7B8E37Eull, 0x7EB77FE03A08045Cull, 0x498A6A17BE985942ull, /* [4][0x90]*/
+        0x6FB2BFB3FDC1D5DEull, 0x588FAA44795188C0ull, 0x01C8945CF4E16FE2ull, 0x36F581AB707132FCull, /* [4][0x94]*/
+        0xB346E86DEF80A1A6ull, 0x847BFD9A6B10FCB8ull, 0xDD3CC382E6A01B9Aull, 0xEA01D67562304684ull, /* [4][0x98]*/
+        0xE283365C81D4AE45ull, 0xD5BE23AB0544F35Bull, 0x8CF91DB388F41479ull, 0xBBC408440C644967ull, /* [4][0x9c]*/
+        0x3E7761829395DA3Dull, 0x094A747517058723ull, 0x500D4A6D9AB56001ull, 0x67305F9A1E253D1Full, /* [4][0xa0]*/
+        0x1C7CE1251C067939ull, 0x2B41F4D298962427ull, 0x7206CACA1526C305ull, 0x453BDF3D91B69E1Bull, /* [4][0xa4]*/
+        0xC088B6FB0E470D41ull, 0xF7B5A30C8AD7505Full, 0xAEF29D140767B77Dull, 0x99CF88E383F7EA63ull, /* [4][0xa8]*/
+        0x914D68CA601302A2ull, 0xA6707D3DE4835FBCull, 0xFF3743256933B89Eull, 0xC80A56D2EDA3E580ull, /* [4][0xac]*/
+        0x4DB93F14725276DAull, 0x7A842AE3F6C22BC4ull, 0x23C314FB7B72CCE6ull, 0x14FE010CFFE291F8ull, /* [4][0xb0]*/
+        0x32C6D4A8BCBB1D64ull, 0x05FBC15F382B407Aull, 0x5CBCFF47B59BA758ull, 0x6B81EAB0310BFA46ull, /* [4][0xb4]*/
+        0xEE328376AEFA691Cull, 0xD90F96812A6A3402ull, 0x8048A899A7DAD320ull, 0xB775BD6E234A8E3Eull, /* [4][0xb8]*/
+        0xBFF75D47C0AE66FFull, 0x88CA48B0443E3BE1ull, 0xD18D76A8C98EDCC3ull, 0xE6B0635F4D1E81DDull, /* [4][0xbc]*/
+        0x63030A99D2EF1287ull, 0x543E1F6E567F4F99ull, 0x0D792176DBCFA8BBull, 0x3A4434815F5FF5A5ull, /* [4][0xc0]*/
+        0xFBE05C08DF8920F7ull, 0xCCDD49FF5B197DE9ull, 0x959A77E7D6A99ACBull, 0xA2A762105239C7D5ull, /* [4][0xc4]*/
+        0x27140BD6CDC8548Full, 0x10291E2149580991ull, 0x496E2039C4E8EEB3ull, 0x7E5335CE4078B3ADull, /* [4][0xc8]*/
+        0x76D1D5E7A39C5B6Cull, 0x41ECC010270C0672ull, 0x18ABFE08AABCE150ull, 0x2F96EBFF2E2CBC4Eull, /* [4][0xcc]*/
+        0xAA258239B1DD2F14ull, 0x9D1897CE354D720Aull, 0xC45FA9D6B8FD9528ull, 0xF362BC213C6DC836ull, /* [4][0xd0]*/
+        0xD55A69857F3444AAull, 0xE2677C72FBA419B4ull, 0xBB20426A7614FE96ull, 0x8C1D579DF284A388ull, /* [4][0xd4]*/
+        0x09AE3E5B6D7530D2ull, 0x3E932BACE9E56DCCull, 0x67D415B464558AEEull, 0x50E90043E0C5D7F0ull, /* [4][0xd8]*/
+        0x586BE06A03213F31ull, 0x6F56F59D87B1622Full, 0x3611CB850A01850Dull, 0x012CDE728E91D813ull, /* [4][0xdc]*/
+        0x849FB7B411604B49ull, 0xB3A2A24395F01657ull, 0xEAE59C5B1840F175ull, 0xDDD889AC9CD0AC6Bull, /* [4][0xe0]*/
+        0xA69437139EF3E84Dull, 0x91A922E41A63B553ull, 0xC8EE1CFC97D35271ull, 0xFFD3090B13430F6Full, /* [4][0xe4]*/
+        0x7A6060CD8CB29C35ull, 0x4D5D753A0822C12Bull, 0x141A4B2285922609ull, 0x23275ED501027B17ull, /* [4][0xe8]*/
+        0x2BA5BEFCE2E693D6ull, 0x1C98AB0B6676CEC8ull, 0x45DF9513EBC629EAull, 0x72E280E46F5674F4ull, /* [4][0xec]*/
+        0xF751E922F0A7E7AEull, 0xC06CFCD57437BAB0ull, 0x992BC2CDF9875D92ull, 0xAE16D73A7D17008Cull, /* [4][0xf0]*/
+        0x882E029E3E4E8C10ull, 0xBF131769BADED10Eull, 0xE6542971376E362Cull, 0xD1693C86B3FE6B32ull, /* [4][0xf4]*/
+        0x54DA55402C0FF868ull, 0x63E740B7A89FA576ull, 0x3AA07EAF252F4254ull, 0x0D9D6B58A1BF1F4Aull, /* [4][0xf8]*/
+        0x051F8B71425BF78Bull, 0x32229E86C6CBAA95ull, 0x6B65A09E4B7B4DB7ull, 0x5C58B569CFEB10A9ull, /* [4][0xfc]*/
+        0xD9EBDCAF501A83F3ull, 0xEED6C958D48ADEEDull, 0xB791F740593A39CFull, 0x80ACE2B7DDAA64D1ull  /* [4][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0xE9742A79EF04A5D4ull, 0xE63172A0869ED8C3ull, 0x0F4558D9699A7D17ull, /* [5][0x04]*/
+        0xF8BBC31255AA22EDull, 0x11CFE96BBAAE8739ull, 0x1E8AB1B2D334FA2Eull, 0xF7FE9BCB3C305FFAull, /* [5][0x08]*/
+        0xC5AEA077F3C3D6B1ull, 0x2CDA8A0E1CC77365ull, 0x239FD2D7755D0E72ull, 0xCAEBF8AE9A59ABA6ull, /* [5][0x0c]*/
+        0x3D156365A669F45Cull, 0xD461491C496D5188ull, 0xDB2411C520F72C9Full, 0x32503BBCCFF3894Bull, /* [5][0x10]*/
+        0xBF8466BCBF103E09ull, 0x56F04CC550149BDDull, 0x59B5141C398EE6CAull, 0xB0C13E65D68A431Eull, /* [5][0x14]*/
+        0x473FA5AEEABA1CE4ull, 0xAE4B8FD705BEB930ull, 0xA10ED70E6C24C427ull, 0x487AFD77832061F3ull, /* [5][0x18]*/
+        0x7A2AC6CB4CD3E8B8ull, 0x935EECB2A3D74D6Cull, 0x9C1BB46BCA4D307Bull, 0x756F9E12254995AFull, /* [5][0x1c]*/
+        0x829105D91979CA55ull, 0x6BE52FA0F67D6F81ull, 0x64A077799FE71296ull, 0x8DD45D0070E3B742ull, /* [5][0x20]*/
+        0x4BD1EB2A26B7EF79ull, 0xA2A5C153C9B34AADull, 0xADE0998AA02937BAull, 0x4494B3F34F2D926Eull, /* [5][0x24]*/
+        0xB36A2838731DCD94ull, 0x5A1E02419C196840ull, 0x555B5A98F5831557ull, 0xBC2F70E11A87B083ull, /* [5][0x28]*/
+        0x8E7F4B5DD57439C8ull, 0x670B61243A709C1Cull, 0x684E39FD53EAE10Bull, 0x813A1384BCEE44DFull, /* [5][0x2c]*/
+        0x76C4884F80DE1B25ull, 0x9FB0A2366FDABEF1ull, 0x90F5FAEF0640C3E6ull, 0x7981D096E9446632ull, /* [5][0x30]*/
+        0xF4558D9699A7D170ull, 0x1D21A7EF76A374A4ull, 0x1264FF361F3909B3ull, 0xFB10D54FF03DAC67ull, /* [5][0x34]*/
+        0x0CEE4E84CC0DF39Dull, 0xE59A64FD23095649ull, 0xEADF3C244A932B5Eull, 0x03AB165DA5978E8Aull, /* [5][0x38]*/
+        0x31FB2DE16A6407C1ull, 0xD88F07988560A215ull, 0xD7CA5F41ECFADF02ull, 0x3EBE753803FE7AD6ull, /* [5][0x3c]*/
+        0xC940EEF33FCE252Cull, 0x2034C48AD0CA80F8ull, 0x2F719C53B950FDEFull, 0xC605B62A5654583Bull, /* [5][0x40]*/
+        0x97A3D6544D6FDEF2ull, 0x7ED7FC2DA26B7B26ull, 0x7192A4F4CBF10631ull, 0x98E68E8D24F5A3E5ull, /* [5][0x44]*/
+        0x6F18154618C5FC1Full, 0x866C3F3FF7C159CBull, 0x892967E69E5B24DCull, 0x605D4D9F715F8108ull, /* [5][0x48]*/
+        0x520D7623BEAC0843ull, 0xBB795C5A51A8AD97ull, 0xB43C04833832D080ull, 0x5D482EFAD7367554ull, /* [5][0x4c]*/
+        0xAAB6B531EB062AAEull, 0x43C29F4804028F7Aull, 0x4C87C7916D98F26Dull, 0xA5F3EDE8829C57B9ull, /* [5][0x50]*/
+        0x2827B0E8F27FE0FBull, 0xC1539A911D7B452Full, 0xCE16C24874E13838ull, 0x2762E8319BE59DECull, /* [5][0x54]*/
+        0xD09C73FAA7D5C216ull, 0x39E8598348D167C2ull, 0x36AD015A214B1AD5ull, 0xDFD92B23CE4FBF01ull, /* [5][0x58]*/
+        0xED89109F01BC364Aull, 0x04FD3AE6EEB8939Eull, 0x0BB8623F8722EE89ull, 0xE2CC484668264B5Dull, /* [5][0x5c]*/
+        0x1532D38D541614A7ull, 0xFC46F9F4BB12B173ull, 0xF303A12DD288CC64ull, 0x1A778B543D8C69B0ull, /* [5][0x60]*/
+        0xDC723D7E6BD8318Bull, 0x3506170784DC945Full, 0x3A434FDEED46E948ull, 0xD33765A702424C9Cull, /* [5][0x64]*/
+        0x24C9FE6C3E721366ull, 0xCDBDD415D176B6B2ull, 0xC2F88CCCB8ECCBA5ull, 0x2B8CA6B557E86E71ull, /* [5][0x68]*/
+        0x19DC9D09981BE73Aull, 0xF0A8B770771F42EEull, 0xFFEDEFA91E853FF9ull, 0x1699C5D0F1819A2Dull, /* [5][0x6c]*/
+        0xE1675E1BCDB1C5D7ull, 0x0813746222B56003ull, 0x07562CBB4B2F1D14ull, 0xEE2206C2A42BB8C0ull, /* [5][0x70]*/
+        0x63F65BC2D4C80F82ull, 0x8A8271BB3BCCAA56ull, 0x85C729625256D741ull, 0x6CB3031BBD527295ull, /* [5][0x74]*/
+        0x9B4D98D081622D6Full, 0x7239B2A96E6688BBull, 0x7D7CEA7007FCF5ACull, 0x9408C009E8F85078ull, /* [5][0x78]*/
+        0xA658FBB5270BD933ull, 0x4F2CD1CCC80F7CE7ull, 0x40698915A19501F0ull, 0xA91DA36C4E91A424ull, /* [5][0x7c]*/
+        0x5EE338A772A1FBDEull, 0xB79712DE9DA55E0Aull, 0xB8D24A07F43F231Dull, 0x51A6607E1B3B86C9ull, /* [5][0x80]*/
+        0x1B9E8AFBC2482E8Full, 0xF2EAA0822D4C8B5Bull, 0xFDAFF85B44D6F64Cull, 0x14DBD222ABD25398ull, /* [5][0x84]*/
+        0xE32549E997E20C62ull, 0x0A51639078E6A9B6ull, 0x05143B49117CD4A1ull, 0xEC601130FE787175ull, /* [5][0x88]*/
+        0xDE302A8C318BF83Eull, 0x374400F5DE8F5DEAull, 0x3801582CB71520FDull, 0xD175725558118529ull, /* [5][0x8c]*/
+        0x268BE99E6421DAD3ull, 0xCFFFC3E78B257F07ull, 0xC0BA9B3EE2BF0210ull, 0x29CEB1470DBBA7C4ull, /* [5][0x90]*/
+        0xA41AEC477D581086ull, 0x4D6EC63E925CB552ull, 0x422B9EE7FBC6C845ull, 0xAB5FB49E14C26D91ull, /* [5][0x94]*/
+        0x5CA12F5528F2326Bull, 0xB5D5052CC7F697BFull, 0xBA905DF5AE6CEAA8ull, 0x53E4778C41684F7Cull, /* [5][0x98]*/
+        0x61B44C308E9BC637ull, 0x88C06649619F63E3ull, 0x87853E9008051EF4ull, 0x6EF114E9E701BB20ull, /* [5][0x9c]*/
+        0x990F8F22DB31E4DAull, 0x707BA55B3435410Eull, 0x7F3EFD825DAF3C19ull, 0x964AD7FBB2AB99CDull, /* [5][0xa0]*/
+        0x504F61D1E4FFC1F6ull, 0xB93B4BA80BFB6422ull, 0xB67E137162611935ull, 0x5F0A39088D65BCE1ull, /* [5][0xa4]*/
+        0xA8F4A2C3B155E31Bull, 0x418088BA5E5146CFull, 0x4EC5D06337CB3BD8ull, 0xA7B1FA1AD8CF9E0Cull, /* [5][0xa8]*/
+        0x95E1C1A6173C1747ull, 0x7C95EBDFF838B293ull, 0x73D0B30691A2CF84ull, 0x9AA4997F7EA66A50ull, /* [5][0xac]*/
+        0x6D5A02B4429635AAull, 0x842E28CDAD92907Eull, 0x8B6B7014C408ED69ull, 0x621F5A6D2B0C48BDull, /* [5][0xb0]*/
+        0xEFCB076D5BEFFFFFull, 0x06BF2D14B4EB5A2Bull, 0x09FA75CDDD71273Cull, 0xE08E5FB4327582E8ull, /* [5][0xb4]*/
+        0x1770C47F0E45DD12ull, 0xFE04EE06E14178C6ull, 0xF141B6DF88DB05D1ull, 0x18359CA667DFA005ull, /* [5][0xb8]*/
+        0x2A65A71AA82C294Eull, 0xC3118D6347288C9Aull, 0xCC54D5BA2EB2F18Dull, 0x2520FFC3C1B65459ull, /* [5][0xbc]*/
+        0xD2DE6408FD860BA3ull, 0x3BAA4E711282AE77ull, 0x34EF16A87B18D360ull, 0xDD9B3CD1941C76B4ull, /* [5][0xc0]*/
+        0x8C3D5CAF8F27F07Dull, 0x654976D6602355A9ull, 0x6A0C2E0F09B928BEull, 0x83780476E6BD8D6Aull, /* [5][0xc4]*/
+        0x74869FBDDA8DD290ull, 0x9DF2B5C435897744ull, 0x92B7ED1D5C130A53ull, 0x7BC3C764B317AF87ull, /* [5][0xc8]*/
+        0x4993FCD87CE426CCull, 0xA0E7D6A193E08318ull, 0xAFA28E78FA7AFE0Full, 0x46D6A401157E5BDBull, /* [5][0xcc]*/
+        0xB1283FCA294E0421ull, 0x585C15B3C64AA1F5ull, 0x57194D6AAFD0DCE2ull, 0xBE6D671340D47936ull, /* [5][0xd0]*/
+        0x33B93A133037CE74ull, 0xDACD106ADF336BA0ull, 0xD58848B3B6A916B7ull, 0x3CFC62CA59ADB363ull, /* [5][0xd4]*/
+        0xCB02F901659DEC99ull, 0x2276D3788A99494Dull, 0x2D338BA1E303345Aull, 0xC447A1D80C07918Eull, /* [5][0xd8]*/
+        0xF6179A64C3F418C5ull, 0x1F63B01D2CF0BD11ull, 0x1026E8C4456AC006ull, 0xF952C2BDAA6E65D2ull, /* [5][0xdc]*/
+        0x0EAC5976965E3A28ull, 0xE7D8730F795A9FFCull, 0xE89D2BD610C0E2EBull, 0x01E901AFFFC4473Full, /* [5][0xe0]*/
+        0xC7ECB785A9901F04ull, 0x2E989DFC4694BAD0ull, 0x21DDC5252F0EC7C7ull, 0xC8A9EF5CC00A6213ull, /* [5][0xe4]*/
+        0x3F577497FC3A3DE9ull, 0xD6235EEE133E983Dull, 0xD96606377AA4E52Aull, 0x30122C4E95A040FEull, /* [5][0xe8]*/
+        0x024217F25A53C9B5ull, 0xEB363D8BB5576C61ull, 0xE4736552DCCD1176ull, 0x0D074F2B33C9B4A2ull, /* [5][0xec]*/
+        0xFAF9D4E00FF9EB58ull, 0x138DFE99E0FD4E8Cull, 0x1CC8A6408967339Bull, 0xF5BC8C396663964Full, /* [5][0xf0]*/
+        0x7868D1391680210Dull, 0x911CFB40F98484D9ull, 0x9E59A399901EF9CEull, 0x772D89E07F1A5C1Aull, /* [5][0xf4]*/
+        0x80D3122B432A03E0ull, 0x69A73852AC2EA634ull, 0x66E2608BC5B4DB23ull, 0x8F964AF22AB07EF7ull, /* [5][0xf8]*/
+        0xBDC6714EE543F7BCull, 0x54B25B370A475268ull, 0x5BF703EE63DD2F7Full, 0xB28329978CD98AABull, /* [5][0xfc]*/
+        0x457DB25CB0E9D551ull, 0xAC0998255FED7085ull, 0xA34CC0FC36770D92ull, 0x4A38EA85D973A846ull  /* [5][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0xFC5D27F6BF353971ull, 0xCC6369BE26FDE189ull, 0x303E4E4899C8D8F8ull, /* [6][0x04]*/
+        0xAC1FF52F156C5079ull, 0x5042D2D9AA596908ull, 0x607C9C913391B1F0ull, 0x9C21BB678CA48881ull, /* [6][0x08]*/
+        0x6CE6CC0D724F3399ull, 0x90BBEBFBCD7A0AE8ull, 0xA085A5B354B2D210ull, 0x5CD88245EB87EB61ull, /* [6][0x0c]*/
+        0xC0F93922672363E0ull, 0x3CA41ED4D8165A91ull, 0x0C9A509C41DE8269ull, 0xF0C7776AFEEBBB18ull, /* [6][0x10]*/
+        0xD9CD981AE49E6732ull, 0x2590BFEC5BAB5E43ull, 0x15AEF1A4C26386BBull, 0xE9F3D6527D56BFCAull, /* [6][0x14]*/
+        0x75D26D35F1F2374Bull, 0x898F4AC34EC70E3Aull, 0xB9B1048BD70FD6C2ull, 0x45EC237D683AEFB3ull, /* [6][0x18]*/
+        0xB52B541796D154ABull, 0x497673E129E46DDAull, 0x79483DA9B02CB522ull, 0x85151A5F0F198C53ull, /* [6][0x1c]*/
+        0x1934A13883BD04D2ull, 0xE56986CE3C883DA3ull, 0xD557C886A540E55Bull, 0x290AEF701A75DC2Aull, /* [6][0x20]*/
+        0x8742166691AB5D0Full, 0x7B1F31902E9E647Eull, 0x4B217FD8B756BC86ull, 0xB77C582E086385F7ull, /* [6][0x24]*/
+        0x2B5DE34984C70D76ull, 0xD700C4BF3BF23407ull, 0xE73E8AF7A23AECFFull, 0x1B63AD011D0FD58Eull, /* [6][0x28]*/
+        0xEBA4DA6BE3E46E96ull, 0x17F9FD9D5CD157E7ull, 0x27C7B3D5C5198F1Full, 0xDB9A94237A2CB66Eull, /* [6][0x2c]*/
+        0x47BB2F44F6883EEFull, 0xBBE608B249BD079Eull, 0x8BD846FAD075DF66ull, 0x7785610C6F40E617ull, /* [6][0x30]*/
+        0x5E8F8E7C75353A3Dull, 0xA2D2A98ACA00034Cull, 0x92ECE7C253C8DBB4ull, 0x6EB1C034ECFDE2C5ull, /* [6][0x34]*/
+        0xF2907B5360596A44ull, 0x0ECD5CA5DF6C5335ull, 0x3EF312ED46A48BCDull, 0xC2AE351BF991B2BCull, /* [6][0x38]*/
+        0x32694271077A09A4ull, 0xCE346587B84F30D5ull, 0xFE0A2BCF2187E82Dull, 0x02570C399EB2D15Cull, /* [6][0x3c]*/
+        0x9E76B75E121659DDull, 0x622B90A8AD2360ACull, 0x5215DEE034EBB854ull, 0xAE48F9168BDE8125ull, /* [6][0x40]*/
+        0x3A5D0A9E7BC12975ull, 0xC6002D68C4F41004ull, 0xF63E63205D3CC8FCull, 0x0A6344D6E209F18Dull, /* [6][0x44]*/
+        0x9642FFB16EAD790Cull, 0x6A1FD847D198407Dull, 0x5A21960F48509885ull, 0xA67CB1F9F765A1F4ull, /* [6][0x48]*/
+        0x56BBC693098E1AECull, 0xAAE6E165B6BB239Dull, 0x9AD8AF2D2F73FB65ull, 0x668588DB9046C214ull, /* [6][0x4c]*/
+        0xFAA433BC1CE24A95ull, 0x06F9144AA3D773E4ull, 0x36C75A023A1FAB1Cull, 0xCA9A7DF4852A926Dull, /* [6][0x50]*/
+        0xE39092849F5F4E47ull, 0x1FCDB572206A7736ull, 0x2FF3FB3AB9A2AFCEull, 0xD3AEDCCC069796BFull, /* [6][0x54]*/
+        0x4F8F67AB8A331E3Eull, 0xB3D2405D3506274Full, 0x83EC0E15ACCEFFB7ull, 0x7FB129E313FBC6C6ull, /* [6][0x58]*/
+        0x8F765E89ED107DDEull, 0x732B797F522544AFull, 0x43153737CBED9C57ull, 0xBF4810C174D8A526ull, /* [6][0x5c]*/
+        0x2369ABA6F87C2DA7ull, 0xDF348C50474914D6ull, 0xEF0AC218DE81CC2Eull, 0x1357E5EE61B4F55Full, /* [6][0x60]*/
+        0xBD1F1CF8EA6A747Aull, 0x41423B0E555F4D0Bull, 0x717C7546CC9795F3ull, 0x8D2152B073A2AC82ull, /* [6][0x64]*/
+        0x1100E9D7FF062403ull, 0xED5DCE2140331D72ull, 0xDD638069D9FBC58Aull, 0x213EA79F66CEFCFBull, /* [6][0x68]*/
+        0xD1F9D0F5982547E3ull, 0x2DA4F70327107E92ull, 0x1D9AB94BBED8A66Aull, 0xE1C79EBD01ED9F1Bull, /* [6][0x6c]*/
+        0x7DE625DA8D49179Aull, 0x81BB022C327C2EEBull, 0xB1854C64ABB4F613ull, 0x4DD86B921481CF62ull, /* [6][0x70]*/
+        0x64D284E20EF41348ull, 0x988FA314B1C12A39ull, 0xA8B1ED5C2809F2C1ull, 0x54ECCAAA973CCBB0ull, /* [6][0x74]*/
+        0xC8CD71CD1B984331ull, 0x3490563BA4AD7A40ull, 0x04AE18733D65A2B8ull, 0xF8F33F8582509BC9ull, /* [6][0x78]*/
+        0x083448EF7CBB20D1ull, 0xF4696F19C38E19A0ull, 0xC45721515A46C158ull, 0x380A06A7E573F829ull, /* [6][0x7c]*/
+        0xA42BBDC069D770A8ull, 0x58769A36D6E249D9ull, 0x6848D47E4F2A9121ull, 0x9415F388F01FA850ull, /* [6][0x80]*/
+        0x74BA153CF78252EAull, 0x88E732CA48B76B9Bull, 0xB8D97C82D17FB363ull, 0x44845B746E4A8A12ull, /* [6][0x84]*/
+        0xD8A5E013E2EE0293ull, 0x24F8C7E55DDB3BE2ull, 0x14C689ADC413E31Aull, 0xE89BAE5B7B26DA6Bull, /* [6][0x88]*/
+        0x185CD93185CD6173ull, 0xE401FEC73AF85802ull, 0xD43FB08FA33080FAull, 0x286297791C05B98Bull, /* [6][0x8c]*/
+        0xB4432C1E90A1310Aull, 0x481E0BE82F94087Bull, 0x782045A0B65CD083ull, 0x847D62560969E9F2ull, /* [6][0x90]*/
+        0xAD778D26131C35D8ull, 0x512AAAD0AC290CA9ull, 0x6114E49835E1D451ull, 0x9D49C36E8AD4ED20ull, /* [6][0x94]*/
+        0x01687809067065A1ull, 0xFD355FFFB9455CD0ull, 0xCD0B11B7208D8428ull, 0x315636419FB8BD59ull, /* [6][0x98]*/
+        0xC191412B61530641ull, 0x3DCC66DDDE663F30ull, 0x0DF2289547AEE7C8ull, 0xF1AF0F63F89BDEB9ull, /* [6][0x9c]*/
+        0x6D8EB404743F5638ull, 0x91D393F2CB0A6F49ull, 0xA1EDDDBA52C2B7B1ull, 0x5DB0FA4CEDF78EC0ull, /* [6][0xa0]*/
+        0xF3F8035A66290FE5ull, 0x0FA524ACD91C3694ull, 0x3F9B6AE440D4EE6Cull, 0xC3C64D12FFE1D71Dull, /* [6][0xa4]*/
+        0x5FE7F67573455F9Cull, 0xA3BAD183CC7066EDull, 0x93849FCB55B8BE15ull, 0x6FD9B83DEA8D8764ull, /* [6][0xa8]*/
+        0x9F1ECF5714663C7Cull, 0x6343E8A1AB53050Dull, 0x537DA6E9329BDDF5ull, 0xAF20811F8DAEE484ull, /* [6][0xac]*/
+        0x33013A78010A6C05ull, 0xCF5C1D8EBE3F5574ull, 0xFF6253C627F78D8Cull, 0x033F743098C2B4FDull, /* [6][0xb0]*/
+        0x2A359B4082B768D7ull, 0xD668BCB63D8251A6ull, 0xE656F2FEA44A895Eull, 0x1A0BD5081B7FB02Full, /* [6][0xb4]*/
+        0x862A6E6F97DB38AEull, 0x7A77499928EE01DFull, 0x4A4907D1B126D927ull, 0xB61420270E13E056ull, /* [6][0xb8]*/
+        0x46D3574DF0F85B4Eull, 0xBA8E70BB4FCD623Full, 0x8AB03EF3D605BAC7ull, 0x76ED1905693083B6ull, /* [6][0xbc]*/
+        0xEACCA262E5940B37ull, 0x169185945AA13246ull, 0x26AFCBDCC369EABEull, 0xDAF2EC2A7C5CD3CFull, /* [6][0xc0]*/
+        0x4EE71FA28C437B9Full, 0xB2BA3854337642EEull, 0x8284761CAABE9A16ull, 0x7ED951EA158BA367ull, /* [6][0xc4]*/
+        0xE2F8EA8D992F2BE6ull, 0x1EA5CD7B261A1297ull, 0x2E9B8333BFD2CA6Full, 0xD2C6A4C500E7F31Eull, /* [6][0xc8]*/
+        0x2201D3AFFE0C4806ull, 0xDE5CF45941397177ull, 0xEE62BA11D8F1A98Full, 0x123F9DE767C490FEull, /* [6][0xcc]*/
+        0x8E1E2680EB60187Full, 0x724301765455210Eull, 0x427D4F3ECD9DF9F6ull, 0xBE2068C872A8C087ull, /* [6][0xd0]*/
+        0x972A87B868DD1CADull, 0x6B77A04ED7E825DCull, 0x5B49EE064E20FD24ull, 0xA714C9F0F115C455ull, /* [6][0xd4]*/
+        0x3B3572977DB14CD4ull, 0xC7685561C28475A5ull, 0xF7561B295B4CAD5Dull, 0x0B0B3CDFE479942Cull, /* [6][0xd8]*/
+        0xFBCC4BB51A922F34ull, 0x07916C43A5A71645ull, 0x37AF220B3C6FCEBDull, 0xCBF205FD835AF7CCull, /* [6][0xdc]*/
+        0x57D3BE9A0FFE7F4Dull, 0xAB8E996CB0CB463Cull, 0x9BB0D72429039EC4ull, 0x67EDF0D29636A7B5ull, /* [6][0xe0]*/
+        0xC9A509C41DE82690ull, 0x35F82E32A2DD1FE1ull, 0x05C6607A3B15C719ull, 0xF99B478C8420FE68ull, /* [6][0xe4]*/
+        0x65BAFCEB088476E9ull, 0x99E7DB1DB7B14F98ull, 0xA9D995552E799760ull, 0x5584B2A3914CAE11ull, /* [6][0xe8]*/
+        0xA543C5C96FA71509ull, 0x591EE23FD0922C78ull, 0x6920AC77495AF480ull, 0x957D8B81F66FCDF1ull, /* [6][0xec]*/
+        0x095C30E67ACB4570ull, 0xF5011710C5FE7C01ull, 0xC53F59585C36A4F9ull, 0x39627EAEE3039D88ull, /* [6][0xf0]*/
+        0x106891DEF97641A2ull, 0xEC35B628464378D3ull, 0xDC0BF860DF8BA02Bull, 0x2056DF9660BE995Aull, /* [6][0xf4]*/
+        0xBC7764F1EC1A11DBull, 0x402A4307532F28AAull, 0x70140D4FCAE7F052ull, 0x8C492AB975D2C923ull, /* [6][0xf8]*/
+        0x7C8E5DD38B39723Bull, 0x80D37A25340C4B4Aull, 0xB0ED346DADC493B2ull, 0x4CB0139B12F1AAC3ull, /* [6][0xfc]*/
+        0xD091A8FC9E552242ull, 0x2CCC8F0A21601B33ull, 0x1CF2C142B8A8C3CBull, 0xE0AFE6B4079DFABAull  /* [6][0x100]*/
+    },
+    {
+        0x0000000000000000ull, 0x21E9761E252621ACull, 0x43D2EC3C4A4C4358ull, 0x623B9A226F6A62F4ull, /* [7][0x04]*/
+        0x87A5D878949886B0ull, 0xA64CAE66B1BEA71Cull, 0xC4773444DED4C5E8ull, 0xE59E425AFBF2E444ull, /* [7][0x08]*/
+        0x3B9296A271A69E0Bull, 0x1A7BE0BC5480BFA7ull, 0x78407A9E3BEADD53ull, 0x59A90C801ECCFCFFull, /* [7][0x0c]*/
+        0xBC374EDAE53E18BBull, 0x9DDE38C4C0183917ull, 0xFFE5A2E6AF725BE3ull, 0xDE0CD4F88A547A4Full, /* [7][0x10]*/
+        0x77252D44E34D3C16ull, 0x56CC5B5AC66B1DBAull, 0x34F7C178A9017F4Eull, 0x151EB7668C275EE2ull, /* [7][0x14]*/
+        0xF080F53C77D5BAA6ull, 0xD169832252F39B0Aull, 0xB35219003D99F9FEull, 0x92BB6F1E18BFD852ull, /* [7][0x18]*/
+        0x4CB7BBE692EBA21Dull, 0x6D5ECDF8B7CD83B1ull, 0x0F6557DAD8A7E145ull, 0x2E8C21C4FD81C0E9ull, /* [7][0x1c]*/
+        0xCB12639E067324ADull, 0xEAFB158023550501ull, 0x88C08FA24C3F67F5ull, 0xA929F9BC69194659ull, /* [7][0x20]*/
+        0xEE4A5A89C69A782Cull, 0xCFA32C97E3BC5980ull, 0xAD98B6B58CD63B74ull, 0x8C71C0ABA9F01AD8ull, /* [7][0x24]*/
+        0x69EF82F15202FE9Cull, 0x4806F4EF7724DF30ull, 0x2A3D6ECD184EBDC4ull, 0x0BD418D33D689C68ull, /* [7][0x28]*/
+        0xD5D8CC2BB73CE627ull, 0xF431BA35921AC78Bull, 0x960A2017FD70A57Full, 0xB7E35609D85684D3ull, /* [7][0x2c]*/
+        0x527D145323A46097ull, 0x7394624D0682413Bull, 0x11AFF86F69E823CFull, 0x30468E714CCE0263ull, /* [7][0x30]*/
+        0x996F77CD25D7443Aull, 0xB88601D300F16596ull, 0xDABD9BF16F9B0762ull, 0xFB54EDEF4ABD26CEull, /* [7][0x34]*/
+        0x1ECAAFB5B14FC28Aull, 0x3F23D9AB9469E326ull, 0x5D184389FB0381D2ull, 0x7CF13597DE25A07Eull, /* [7][0x38]*/
+        0xA2FDE16F5471DA31ull, 0x831497717157FB9Dull, 0xE12F0D531E3D9969ull, 0xC0C67B4D3B1BB8C5ull, /* [7][0x3c]*/
+        0x25583917C0E95C81ull, 0x04B14F09E5CF7D2Dull, 0x668AD52B8AA51FD9ull, 0x4763A335AF833E75ull, /* [7][0x40]*/
+        0xE84D9340D5A36333ull, 0xC9A4E55EF085429Full, 0xAB9F7F7C9FEF206Bull, 0x8A760962BAC901C7ull, /* [7][0x44]*/
+        0x6FE84B38413BE583ull, 0x4E013D26641DC42Full, 0x2C3AA7040B77A6DBull, 0x0DD3D11A2E518777ull, /* [7][0x48]*/
+        0xD3DF05E2A405FD38ull, 0xF23673FC8123DC94ull, 0x900DE9DEEE49BE60ull, 0xB1E49FC0CB6F9FCCull, /* [7][0x4c]*/
+        0x547ADD9A309D7B88ull, 0x7593AB8415BB5A24ull, 0x17A831A67AD138D0ull, 0x364147B85FF7197Cull, /* [7][0x50]*/
+        0x9F68BE0436EE5F25ull, 0xBE81C81A13C87E89ull, 0xDCBA52387CA21C7Dull, 0xFD53242659843DD1ull, /* [7][0x54]*/
+        0x18CD667CA276D995ull, 0x392410628750F839ull, 0x5B1F8A40E83A9ACDull, 0x7AF6FC5ECD1CBB61ull, /* [7][0x58]*/
+        0xA4FA28A64748C12Eull, 0x85135EB8626EE082ull, 0xE728C49A0D048276ull, 0xC6C1B2842822A3DAull, /* [7][0x5c]*/
+        0x235FF0DED3D0479Eull, 0x02B686C0F6F66632ull, 0x608D1CE2999C04C6ull, 0x41646AFCBCBA256Aull, /* [7][0x60]*/
+        0x0607C9C913391B1Full, 0x27EEBFD7361F3AB3ull, 0x45D525F559755847ull, 0x643C53EB7C5379EBull, /* [7][0x64]*/
+        0x81A211B187A19DAFull, 0xA04B67AFA287BC03ull, 0xC270FD8DCDEDDEF7ull, 0xE3998B93E8CBFF5Bull, /* [7][0x68]*/
+        0x3D955F6B629F8514ull, 0x1C7C297547B9A4B8ull, 0x7E47B35728D3C64Cull, 0x5FAEC5490DF5E7E0ull, /* [7][0x6c]*/
+        0xBA308713F60703A4ull, 0x9BD9F10DD3212208ull, 0xF9E26B2FBC4B40FCull, 0xD80B1D31996D6150ull, /* [7][0x70]*/
+        0x7122E48DF0742709ull, 0x50CB9293D55206A5ull, 0x32F008B1BA386451ull, 0x13197EAF9F1E45FDull, /* [7][0x74]*/
+        0xF6873CF564ECA1B9ull, 0xD76E4AEB41CA8015ull, 0xB555D0C92EA0E2E1ull, 0x94BCA6D70B86C34Dull, /* [7][0x78]*/
+        0x4AB0722F81D2B902ull, 0x6B590431A4F498AEull, 0x09629E13CB9EFA5Aull, 0x288BE80DEEB8DBF6ull, /* [7][0x7c]*/
+        0xCD15AA57154A3FB2ull, 0xECFCDC49306C1E1Eull, 0x8EC7466B5F067CEAull, 0xAF2E30757A205D46ull, /* [7][0x80]*/
+        0xE44200D2F3D1550Dull, 0xC5AB76CCD6F774A1ull, 0xA790ECEEB99D1655ull, 0x86799AF09CBB37F9ull, /* [7][0x84]*/
+        0x63E7D8AA6749D3BDull, 0x420EAEB4426FF211ull, 0x203534962D0590E5ull, 0x01DC42880823B149ull, /* [7][0x88]*/
+        0xDFD096708277CB06ull, 0xFE39E06EA751EAAAull, 0x9C027A4CC83B885Eull, 0xBDEB0C52ED1DA9F2ull, /* [7][0x8c]*/
+        0x58754E0816EF4DB6ull, 0x799C381633C96C1Aull, 0x1BA7A2345CA30EEEull, 0x3A4ED42A79852F42ull, /* [7][0x90]*/
+        0x93672D96109C691Bull, 0xB28E5B8835BA48B7ull, 0xD0B5C1AA5AD02A43ull, 0xF15CB7B47FF60BEFull, /* [7][0x94]*/
+        0x14C2F5EE8404EFABull, 0x352B83F0A122CE07ull, 0x571019D2CE48ACF3ull, 0x76F96FCCEB6E8D5Full, /* [7][0x98]*/
+        0xA8F5BB34613AF710ull, 0x891CCD2A441CD6BCull, 0xEB2757082B76B448ull, 0xCACE21160E5095E4ull, /* [7][0x9c]*/
+        0x2F50634CF5A271A0ull, 0x0EB91552D084500Cull, 0x6C828F70BFEE32F8ull, 0x4D6BF96E9AC81354ull, /* [7][0xa0]*/
+        0x0A085A5B354B2D21ull, 0x2BE12C45106D0C8Dull, 0x49DAB6677F076E79ull, 0x6833C0795A214FD5ull, /* [7][0xa4]*/
+        0x8DAD8223A1D3AB91ull, 0xAC44F43D84F58A3Dull, 0xCE7F6E1FEB9FE8C9ull, 0xEF961801CEB9C965ull, /* [7][0xa8]*/
+        0x319ACCF944EDB32Aull, 0x1073BAE761CB9286ull, 0x724820C50EA1F072ull, 0x53A156DB2B87D1DEull, /* [7][0xac]*/
+        0xB63F1481D075359Aull, 0x97D6629FF5531436ull, 0xF5EDF8BD9A3976C2ull, 0xD4048EA3BF1F576Eull, /* [7][0xb0]*/
+        0x7D2D771FD6061137ull, 0x5CC40101F320309Bull, 0x3EFF9B239C4A526Full, 0x1F16ED3DB96C73C3ull, /* [7][0xb4]*/
+        0xFA88AF67429E9787ull, 0xDB61D97967B8B62Bull, 0xB95A435B08D2D4DFull, 0x98B335452DF4F573ull, /* [7][0xb8]*/
+        0x46BFE1BDA7A08F3Cull, 0x675697A38286AE90ull, 0x056D0D81EDECCC64ull, 0x24847B9FC8CAEDC8ull, /* [7][0xbc]*/
+        0xC11A39C53338098Cull, 0xE0F34FDB161E2820ull, 0x82C8D5F979744AD4ull, 0xA321A3E75C526B78ull, /* [7][0xc0]*/
+        0x0C0F93922672363Eull, 0x2DE6E58C03541792ull, 0x4FDD7FAE6C3E7566ull, 0x6E3409B0491854CAull, /* [7][0xc4]*/
+        0x8BAA4BEAB2EAB08Eull, 0xAA433DF497CC9122ull, 0xC878A7D6F8A6F3D6ull, 0xE991D1C8DD80D27Aull, /* [7][0xc8]*/
+        0x379D053057D4A835ull, 0x1674732E72F28999ull, 0x744FE90C1D98EB6Dull, 0x55A69F1238BECAC1ull, /* [7][0xcc]*/
+        0xB038DD48C34C2E85ull, 0x91D1AB56E66A0F29ull, 0xF3EA317489006DDDull, 0xD203476AAC264C71ull, /* [7][0xd0]*/
+        0x7B2ABED6C53F0A28ull, 0x5AC3C8C8E0192B84ull, 0x38F852EA8F734970ull, 0x191124F4AA5568DCull, /* [7][0xd4]*/
+        0xFC8F66AE51A78C98ull, 0xDD6610B07481AD34ull, 0xBF5D8A921BEBCFC0ull, 0x9EB4FC8C3ECDEE6Cull, /* [7][0xd8]*/
+        0x40B82874B4999423ull, 0x61515E6A91BFB58Full, 0x036AC448FED5D77Bull, 0x2283B256DBF3F6D7ull, /* [7][0xdc]*/
+        0xC71DF00C20011293ull, 0xE6F486120527333Full, 0x84CF1C306A4D51CBull, 0xA5266A2E4F6B7067ull, /* [7][0xe0]*/
+        0xE245C91BE0E84E12ull, 0xC3ACBF05C5CE6FBEull, 0xA1972527AAA40D4Aull, 0x807E53398F822CE6ull, /* [7][0xe4]*/
+        0x65E011637470C8A2ull, 0x4409677D5156E90Eull, 0x2632FD5F3E3C8BFAull, 0x07DB8B411B1AAA56ull, /* [7][0xe8]*/
+        0xD9D75FB9914ED019ull, 0xF83E29A7B468F1B5ull, 0x9A05B385DB029341ull, 0xBBECC59BFE24B2EDull, /* [7][0xec]*/
+        0x5E7287C105D656A9ull, 0x7F9BF1DF20F07705ull, 0x1DA06BFD4F9A15F1ull, 0x3C491DE36ABC345Dull, /* [7][0xf0]*/
+        0x9560E45F03A57204ull, 0xB4899241268353A8ull, 0xD6B2086349E9315Cull, 0xF75B7E7D6CCF10F0ull, /* [7][0xf4]*/
+        0x12C53C27973DF4B4ull, 0x332C4A39B21BD518ull, 0x5117D01BDD71B7ECull, 0x70FEA605F8579640ull, /* [7][0xf8]*/
+        0xAEF272FD7203EC0Full, 0x8F1B04E35725CDA3ull, 0xED209EC1384FAF57ull, 0xCCC9E8DF1D698EFBull, /* [7][0xfc]*/
+        0x2957AA85E69B6ABFull, 0x08BEDC9BC3BD4B13ull, 0x6A8546B9ACD729E7ull, 0x4B6C30A789F1084Bull  /* [7][0x100]*/
+    }};
+
+/** x^(2^k) modulo the polynomial, for shifting a crc over a run of zero bytes */
+static const uint64_t s_crc64nvme_x2n[64] = {
+    0x4000000000000000ull, 0x2000000000000000ull, 0x0800000000000000ull, 0x0080000000000000ull,
+    0x0000800000000000ull, 0x0000000080000000ull, 0x9A6C9329AC4BC9B5ull, 0x10F4BB0F129310D6ull,
+    0x70F05DCEA2EBD226ull, 0x311211205672822Dull, 0x2FC297DB0F46C96Eull, 0xCA4D536FABF7DA84ull,
+    0xFB4CDC3B379EE6EDull, 0xEA261148DF25140Aull, 0x59CCB2C07AA6C9B4ull, 0x20B3674A839AF27Aull,
+    0x2D8E1986DA94D583ull, 0x42CDF4C20337635Dull, 0x1D78724BF0F26839ull, 0xB96C84E0AFB34BD5ull,
+    0x5D2E1FCD2DF0A3EAull, 0xCD9506572332BE42ull, 0x23BDA2427F7D690Full, 0x347A953232374F07ull,
+    0x1C2A807AC2A8CEEAull, 0x9B92AD0E14FE1460ull, 0x2574114889F670B2ull, 0x4A84A6C45E3BF520ull,
+    0x915BBAC21CD1C7FFull, 0xB0290EC579F291F5ull, 0xCF2548505C624E6Eull, 0xB154F27BF08A8207ull,
+    0xCE4E92344BAF7D35ull, 0x51DA8D7E057C5EB3ull, 0x9FB10823F5BE15DFull, 0x73B825B3FF1F71CFull,
+    0x5DB436C5406EBB74ull, 0xFA7ED8F3EC3F2BCAull, 0xC4D58EFDC61B9EF6ull, 0xA7E39E61E855BD45ull,
+    0x97AD46F9DD1BF2F1ull, 0x1A0ABB01F853EE6Bull, 0x3F0827C3348F8215ull, 0x4EB68C4506134607ull,
+    0x4A46F6DE5DF34E0Aull, 0x2D855D6A1C57A8DDull, 0x8688DA58E1115812ull, 0x5232F417FC7C7300ull,
+    0xA4080FB2E767D8DAull, 0xD515A7E17693E562ull, 0x1181F7C862E94226ull, 0x9E23CD058204CA91ull,
+    0x9B8992C57A0AED82ull, 0xB2C0AFB84609B6FFull, 0x2F7160553A5EA018ull, 0x3CD378B5C99F2722ull,
+    0x814054AD61A3B058ull, 0xBF766189FCE806D8ull, 0x85A5E898AC49F86Full, 0x34830D11BC84F346ull,
+    0x9644D95B173C8C1Cull, 0x150401AC9AC759B1ull, 0xEBE1F7F46FB00EBAull, 0x8EE4CE0C2E2BD662ull
+};
+
+/* a * b modulo the polynomial, same bit order and algorithm as aws_checksums_multmodp() */
+static uint64_t s_multmodp(uint64_t a, uint64_t b) {
+    uint64_t m = (uint64_t)1 << 63;
+    uint64_t p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ CRC64NVME_POLYNOMIAL : b >> 1;
+    }
+    return p;
+}
+
+uint64_t cli_crc64nvme_update(const uint8_t *data, size_t length, uint64_t previous) {
+    const uint64_t(*table)[256] = s_crc64nvme_table;
+
+    uint64_t crc = ~previous;
+    while (length >= 8) {
+        uint64_t word = crc ^ ((uint64_t)data[0] | (uint64_t)data[1] << 8 | (uint64_t)data[2] << 16 |
+                               (uint64_t)data[3] << 24 | (uint64_t)data[4] << 32 | (uint64_t)data[5] << 40 |
+                               (uint64_t)data[6] << 48 | (uint64_t)data[7] << 56);
+        crc = table[7][word & 0xff] ^ table[6][(word >> 8) & 0xff] ^ table[5][(word >> 16) & 0xff] ^
+              table[4][(word >> 24) & 0xff] ^ table[3][(word >> 32) & 0xff] ^ table[2][(word >> 40) & 0xff] ^
+              table[1][(word >> 48) & 0xff] ^ table[0][word >> 56];
+        data += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+    }
+    return ~crc;
+}
+
+uint64_t cli_crc64nvme_combine(uint64_t crc_a, uint64_t crc_b, uint64_t length_b) {
+    /* x^(8 * length_b), the shift of crc_a over length_b zero bytes */
+    uint64_t shift = (uint64_t)1 << 63;
+    for (int k = 3; length_b; length_b >>= 1, ++k) {
+        if (length_b & 1) {
+            shift = s_multmodp(s_crc64nvme_x2n[k & 63], shift);
+        }
+    }
+    return s_multmodp(shift, crc_a) ^ crc_b;
+}
@@ -0,0 +1,404 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "cli.h"
+
+#include <aws/checksums/file.h>
+
+#include <aws/common/clock.h>
+#include <aws/common/file.h>
+#include <aws/common/system_info.h>
+#include <aws/common/thread.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#    include <fcntl.h>
+#    include <io.h>
+#endif
+
+/* bytes per read */
+#define CLI_READ_BUFFER_SIZE (1024 * 1024)
+
+typedef uint32_t(crc32_fn)(const uint8_t *input, int length, uint32_t previous_crc);
+
+/* the library kernels take an int length */
+static uint64_t s_update_crc32_kernel(crc32_fn *fn, const uint8_t *data, size_t length, uint64_t previous) {
+    uint32_t crc = (uint32_t)previous;
+    while (length > INT_MAX) {
+        crc = fn(data, INT_MAX, crc);
+        data += INT_MAX;
+        length -= INT_MAX;
+    }
+    return fn(data, (int)length, crc);
+}
+
+static uint64_t s_crc32_update(const uint8_t *data, size_t length, uint64_t previous) {
+    return s_update_crc32_kernel(aws_checksums_crc32, data, length, previous);
+}
+
+static uint64_t s_crc32c_update(const uint8_t *data, size_t length, uint64_t previous) {
+    return s_update_crc32_kernel(aws_checksums_crc32c, data, length, previous);
+}
+
+static uint64_t s_crc32_combine(uint64_t crc_a, uint64_t crc_b, uint64_t length_b) {
+    return aws_checksums_crc32_combine((uint32_t)crc_a, (uint32_t)crc_b, length_b);
+}
+
+static uint64_t s_crc32c_combine(uint64_t crc_a, uint64_t crc_b, uint64_t length_b) {
+    return aws_checksums_crc32c_combine((uint32_t)crc_a, (uint32_t)crc_b, length_b);
+}
+
+const struct cli_algorithm g_cli_algorithms[] = {
+    {"crc32", 4, s_crc32_update, s_crc32_combine, true, AWS_CHECKSUMS_CRC32},
+    {"crc32c", 4, s_crc32c_update, s_crc32c_combine, true, AWS_CHECKSUMS_CRC32C},
+    {"crc64nvme", 8, cli_crc64nvme_update, cli_crc64nvme_combine, false, AWS_CHECKSUMS_CRC_ALGORITHM_COUNT},
+};
+
+const size_t g_cli_algorithm_count = AWS_ARRAY_SIZE(g_cli_algorithms);
+
+/* the crc of the whole input from the crcs of its consecutive parts, without reading it again */
+static uint64_t s_combine_parts(const struct cli_algorithm *algorithm, const struct cli_part *parts, size_t count) {
+    uint64_t crc = count ? parts[0].crc : 0;
+    for (size_t i = 1; i < count; ++i) {
+        crc = algorithm->combine(crc, parts[i].crc, parts[i].length);
+    }
+    return crc;
+}
+
+/* one thread's share of a regular file: a contiguous run of units, read through its own FILE */
+struct cli_worker {
+    const struct cli_options *options;
+    const char *path;
+    struct cli_part *units;
+    size_t unit_count;
+    int error;
+    struct aws_thread thread;
+    bool on_worker;
+};
+
+static void s_worker_main(void *arg) {
+    struct cli_worker *worker = arg;
+    const struct cli_algorithm *algorithm = worker->options->algorithm;
+
+    FILE *file = aws_fopen(worker->path, "rb");
+    if (!file) {
+        worker->error = aws_last_error();
+        return;
+    }
+
+    uint8_t *buffer = aws_mem_acquire(worker->options->allocator, CLI_READ_BUFFER_SIZE);
+    if (!buffer) {
+        worker->error = aws_last_error();
+        fclose(file);
+        return;
+    }
+
+    if (worker->unit_count && aws_fseek(file, (int64_t)worker->units[0].offset, SEEK_SET)) {
+        worker->error = aws_last_error();
+    }
+
+    for (size_t i = 0; i < worker->unit_count && !worker->error; ++i) {
+        struct cli_part *unit = &worker->units[i];
+        uint64_t remaining = unit->length;
+        uint64_t crc = 0;
+        while (remaining) {
+            size_t want = remaining < CLI_READ_BUFFER_SIZE ? (size_t)remaining : CLI_READ_BUFFER_SIZE;
+            size_t read = fread(buffer, 1, want, file);
+            if (read == 0) {
+                /* an error, or the file got shorter since its length was taken */
+                if (ferror(file)) {
+                    aws_translate_and_raise_io_error(errno);
+                    worker->error = aws_last_error();
+                } else {
+                    worker->error = AWS_ERROR_FILE_READ_FAILURE;
+                }
+                break;
+            }
+            crc = algorithm->update(buffer, read, crc);
+            remaining -= read;
+        }
+        unit->crc = crc;
+    }
+
+    aws_mem_release(worker->options->allocator, buffer);
+    fclose(file);
+}
+
+/* same defaults and per thread minimum as aws_checksums_file_crc() */
+static size_t s_thread_count(const struct cli_options *options, uint64_t length) {
+    size_t thread_count = options->thread_count;
+    if (!thread_count) {
+        thread_count = aws_system_info_processor_count();
+        if (thread_count > AWS_CHECKSUMS_FILE_DEFAULT_MAX_THREADS) {
+            thread_count = AWS_CHECKSUMS_FILE_DEFAULT_MAX_THREADS;
+        }
+    }
+    uint64_t max_threads = length / AWS_CHECKSUMS_FILE_DEFAULT_MIN_BYTES_PER_THREAD;
+    if (thread_count > max_threads) {
+        thread_count = max_threads ? (size_t)max_threads : 1;
+    }
+    return thread_count;
+}
+
+/*
+ * Splits a regular file of the given length into units, parts of part_size or one range per thread without parts,
+ * and hands each thread a contiguous run of them. The calling thread takes the first run; a worker that fails to
+ * launch has its run read on the calling thread instead.
+ */
+static int s_digest_regular(
+    const struct cli_options *options,
+    const char *path,
+    uint64_t length,
+    struct cli_digest *digest) {
+
+    struct aws_allocator *allocator = options->allocator;
+    size_t thread_count = s_thread_count(options, length);
+
+    uint64_t unit_size = options->part_size;
+    if (!unit_size) {
+        unit_size = length / thread_count + (length % thread_count != 0);
+    }
+    /* an empty input is still one (empty) part, like an S3 upload of an empty object */
+    uint64_t unit_count = length ? length / unit_size + (length % unit_size != 0) : 1;
+    if (unit_count > SIZE_MAX / sizeof(struct cli_part)) {
+        return aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+    }
+    if (thread_count > unit_count) {
+        thread_count = (size_t)unit_count;
+    }
+
+    struct cli_part *units = aws_mem_calloc(allocator, (size_t)unit_count, sizeof(struct cli_part));
+    struct cli_worker *workers = aws_mem_calloc(allocator, thread_count, sizeof(struct cli_worker));
+    if (!units || !workers) {
+        aws_mem_release(allocator, units);
+        aws_mem_release(allocator, workers);
+        return AWS_OP_ERR;
+    }
+
+    for (size_t i = 0; i < (size_t)unit_count; ++i) {
+        units[i].offset = i * unit_size;
+        units[i].length = i + 1 == (size_t)unit_count ? length - units[i].offset : unit_size;
+    }
+
+    for (size_t i = 0; i < thread_count; ++i) {
+        size_t first = (size_t)(unit_count * i / thread_count);
+        size_t last = (size_t)(unit_count * (i + 1) / thread_count);
+        workers[i].options = options;
+        workers[i].path = path;
+        workers[i].units = units + first;
+        workers[i].unit_count = last - first;
+    }
+
+    uint64_t start = 0;
+    aws_high_res_clock_get_ticks(&start);
+
+    for (size_t i = 1; i < thread_count; ++i) {
+        aws_thread_init(&workers[i].thread, allocator);
+        if (aws_thread_launch(&workers[i].thread, s_worker_main, &workers[i], aws_default_thread_options())) {
+            aws_thread_clean_up(&workers[i].thread);
+            s_worker_main(&workers[i]);
+        } else {
+            workers[i].on_worker = true;
+        }
+    }
+
+    s_worker_main(&workers[0]);
+    int error = workers[0].error;
+    for (size_t i = 1; i < thread_count; ++i) {
+        if (workers[i].on_worker) {
+            aws_thread_join(&workers[i].thread);
+            aws_thread_clean_up(&workers[i].thread);
+        }
+        if (!error) {
+            error = workers[i].error;
+        }
+    }
+
+    uint64_t end = 0;
+    aws_high_res_clock_get_ticks(&end);
+    aws_mem_release(allocator, workers);
+
+    if (error) {
+        aws_mem_release(allocator, units);
+        return aws_raise_error(error);
+    }
+
+    digest->crc = s_combine_parts(options->algorithm, units, (size_t)unit_count);
+    digest->bytes = length;
+    digest->threads = thread_count;
+    digest->elapsed_ns = end - start;
+    if (options->part_size) {
+        digest->parts = units;
+        digest->part_count = (size_t)unit_count;
+    } else {
+        aws_mem_release(allocator, units);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* the library's own mapped and threaded path, for whole file crc32 / crc32c */
+static int s_digest_file_api(
+    const struct cli_options *options,
+    const char *path,
+    uint64_t length,
+    struct cli_digest *digest) {
+
+    struct aws_checksums_file_options file_options = {
+        .thread_count = options->thread_count,
+    };
+
+    uint64_t start = 0;
+    aws_high_res_clock_get_ticks(&start);
+
+    uint32_t crc = 0;
+    if (aws_checksums_file_crc(options->allocator, path, options->algorithm->library_algorithm, &file_options, &crc)) {
+        return AWS_OP_ERR;
+    }
+
+    uint64_t end = 0;
+    aws_high_res_clock_get_ticks(&end);
+
+    digest->crc = crc;
+    digest->bytes = length;
+    digest->threads = s_thread_count(options, length);
+    digest->elapsed_ns = end - start;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_append_part(
+    struct aws_allocator *allocator,
+    struct cli_digest *digest,
+    size_t *capacity,
+    const struct cli_part *part) {
+
+    if (digest->part_count == *capacity) {
+        size_t new_capacity = *capacity ? *capacity * 2 : 64;
+        if (aws_mem_realloc(
+                allocator,
+                (void **)&digest->parts,
+                *capacity * sizeof(struct cli_part),
+                new_capacity * sizeof(struct cli_part))) {
+            return AWS_OP_ERR;
+        }
+        *capacity = new_capacity;
+    }
+    digest->parts[digest->part_count++] = *part;
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Pipes and other inputs without a length, read front to back on the calling thread. With parts every byte is hashed
+ * once, into its part's crc, and the crc of the whole input is combined from those.
+ */
+static int s_digest_stream(const struct cli_options *options, FILE *file, struct cli_digest *digest) {
+    struct aws_allocator *allocator = options->allocator;
+    const struct cli_algorithm *algorithm = options->algorithm;
+
+    uint8_t *buffer = aws_mem_acquire(allocator, CLI_READ_BUFFER_SIZE);
+    if (!buffer) {
+        return AWS_OP_ERR;
+    }
+
+    uint64_t start = 0;
+    aws_high_res_clock_get_ticks(&start);
+
+    size_t capacity = 0;
+    struct cli_part part = {0};
+    uint64_t crc = 0;
+    int result = AWS_OP_SUCCESS;
+    size_t read = 0;
+    while (result == AWS_OP_SUCCESS && (read = fread(buffer, 1, CLI_READ_BUFFER_SIZE, file)) > 0) {
+        digest->bytes += read;
+        if (!options->part_size) {
+            crc = algorithm->update(buffer, read, crc);
+            continue;
+        }
+
+        const uint8_t *data = buffer;
+        while (read && result == AWS_OP_SUCCESS) {
+            uint64_t space = options->part_size - part.length;
+            size_t take = read < space ? read : (size_t)space;
+            part.crc = algorithm->update(data, take, part.crc);
+            part.length += take;
+            data += take;
+            read -= take;
+            if (part.length == options->part_size) {
+                result = s_append_part(allocator, digest, &capacity, &part);
+                part.offset += part.length;
+                part.length = 0;
+                part.crc = 0;
+            }
+        }
+    }
+    /* ferror() doesn't always come with an errno, a failed read is still a failure without one */
+    bool read_failed = ferror(file) != 0;
+    int read_errno = errno;
+
+    /* the last, shorter part, or the single empty part of an empty input */
+    if (result == AWS_OP_SUCCESS && options->part_size && (part.length || !digest->part_count)) {
+        result = s_append_part(allocator, digest, &capacity, &part);
+    }
+    if (options->part_size) {
+        crc = s_combine_parts(algorithm, digest->parts, digest->part_count);
+    }
+
+    uint64_t end = 0;
+    aws_high_res_clock_get_ticks(&end);
+    aws_mem_release(allocator, buffer);
+
+    if (result == AWS_OP_SUCCESS && read_failed) {
+        result = read_errno ? aws_translate_and_raise_io_error(read_errno)
+                            : aws_raise_error(AWS_ERROR_FILE_READ_FAILURE);
+    }
+    if (result != AWS_OP_SUCCESS) {
+        /* the caller only cleans up a digest it got */
+        cli_digest_clean_up(allocator, digest);
+        return AWS_OP_ERR;
+    }
+
+    digest->crc = crc;
+    digest->threads = 1;
+    digest->elapsed_ns = end - start;
+    return AWS_OP_SUCCESS;
+}
+
+int cli_digest_path(const struct cli_options *options, const char *path, struct cli_digest *digest) {
+    AWS_ZERO_STRUCT(*digest);
+
+    if (!strcmp(path, "-")) {
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        return s_digest_stream(options, stdin, digest);
+    }
+
+    FILE *file = aws_fopen(path, "rb");
+    if (!file) {
+        return AWS_OP_ERR;
+    }
+
+    int64_t length = 0;
+    if (aws_file_get_length(file, &length) || length < 0) {
+        /* no length to split on, e.g. a pipe */
+        int result = s_digest_stream(options, file, digest);
+        fclose(file);
+        return result;
+    }
+    fclose(file);
+
+    if (!options->part_size && options->algorithm->has_library_algorithm) {
+        return s_digest_file_api(options, path, (uint64_t)length, digest);
+    }
+    return s_digest_regular(options, path, (uint64_t)length, digest);
+}
+
+void cli_digest_clean_up(struct aws_allocator *allocator, struct cli_digest *digest) {
+    aws_mem_release(allocator, digest->parts);
+    AWS_ZERO_STRUCT(*digest);
+}
@@ -0,0 +1,292 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "cli.h"
+
+#include <aws/checksums/header.h>
+#include <aws/checksums/multipart.h>
+
+#include <aws/common/byte_buf.h>
+#include <aws/common/command_line_parser.h>
+#include <aws/common/encoding.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void s_usage(int exit_code) {
+    fprintf(stderr, "usage: aws-checksums-cli [options] [FILE...]\n");
+    fprintf(stderr, "\n Checksums each FILE, or stdin when there is none or FILE is -.\n");
+    fprintf(stderr, "\n Options:\n\n");
+    fprintf(stderr, "  -a, --algorithm NAME: crc32, crc32c or crc64nvme (default: crc32c).\n");
+    fprintf(stderr, "  -t, --threads N: threads reading a regular file (default: one per cpu, up to 8).\n");
+    fprintf(stderr, "  -p, --part-size BYTES[K|M|G]: also print the checksum of every part of this size and, for\n");
+    fprintf(stderr, "      crc32 and crc32c, the S3 multipart composite checksum (checksum of the part checksums,\n");
+    fprintf(stderr, "      suffixed -N).\n");
+    fprintf(stderr, "  -b, --base64: print the base64 x-amz-checksum-* header form instead of hex.\n");
+    fprintf(stderr, "  -s, --stats: print bytes, time and throughput of every input on stderr.\n");
+    fprintf(stderr, "  -h, --help: Display this message and quit.\n");
+    exit(exit_code);
+}
+
+static struct aws_cli_option s_long_options[] = {
+    {"algorithm", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'a'},
+    {"threads", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 't'},
+    {"part-size", AWS_CLI_OPTIONS_REQUIRED_ARGUMENT, NULL, 'p'},
+    {"base64", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'b'},
+    {"stats", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 's'},
+    {"help", AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 'h'},
+    /* Per getopt(3) the last element of the array has to be filled with all zeros */
+    {NULL, AWS_CLI_OPTIONS_NO_ARGUMENT, NULL, 0},
+};
+
+/* a byte count with an optional binary K, M or G suffix, 0 if it doesn't parse */
+static uint64_t s_parse_size(const char *text) {
+    /* strtoull() would take leading spaces and a sign */
+    if (*text < '0' || *text > '9') {
+        return 0;
+    }
+    char *end = NULL;
+    errno = 0;
+    uint64_t value = strtoull(text, &end, 10);
+    if (errno == ERANGE) {
+        return 0;
+    }
+    unsigned shift = 0;
+    switch (*end) {
+        case '\0':
+            break;
+        case 'k':
+        case 'K':
+            shift = 10;
+            break;
+        case 'm':
+        case 'M':
+            shift = 20;
+            break;
+        case 'g':
+        case 'G':
+            shift = 30;
+            break;
+        default:
+            return 0;
+    }
+    if (*end && end[1] != '\0') {
+        return 0;
+    }
+    if (value > (UINT64_MAX >> shift)) {
+        return 0;
+    }
+    return value << shift;
+}
+
+/* a positive count of decimal digits only, 0 if it doesn't parse */
+static size_t s_parse_count(const char *text) {
+    /* strtoull() would take leading spaces and a sign */
+    if (*text < '0' || *text > '9') {
+        return 0;
+    }
+    char *end = NULL;
+    errno = 0;
+    unsigned long long value = strtoull(text, &end, 10);
+    if (*end != '\0' || errno == ERANGE || value > SIZE_MAX) {
+        return 0;
+    }
+    return (size_t)value;
+}
+
+/* fills paths with the positional arguments and returns how many there were */
+static size_t s_parse_options(int argc, char **argv, struct cli_options *options, const char **paths) {
+    size_t path_count = 0;
+    while (true) {
+        int option_index = 0;
+        int c = aws_cli_getopt_long(argc, argv, "a:t:p:bsh", s_long_options, &option_index);
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+            case 0:
+                /* getopt_long() returns 0 if an option.flag is non-null */
+                break;
+            case 0x02:
+                /* getopt_long() returns 0x02 (START_OF_TEXT) if a positional arg was encountered */
+                paths[path_count++] = aws_cli_positional_arg;
+                break;
+            case 'a':
+                options->algorithm = NULL;
+                for (size_t i = 0; i < g_cli_algorithm_count; ++i) {
+                    if (!strcmp(aws_cli_optarg, g_cli_algorithms[i].name)) {
+                        options->algorithm = &g_cli_algorithms[i];
+                    }
+                }
+                if (!options->algorithm) {
+                    fprintf(stderr, "unknown --algorithm %s\n", aws_cli_optarg);
+                    s_usage(1);
+                }
+                break;
+            case 't':
+                options->thread_count = s_parse_count(aws_cli_optarg);
+                if (!options->thread_count) {
+                    fprintf(stderr, "--threads must be a positive count\n");
+                    s_usage(1);
+                }
+                break;
+            case 'p':
+                options->part_size = s_parse_size(aws_cli_optarg);
+                if (!options->part_size) {
+                    fprintf(stderr, "--part-size must be a positive byte count\n");
+                    s_usage(1);
+                }
+                break;
+            case 'b':
+                options->base64 = true;
+                break;
+            case 's':
+                options->stats = true;
+                break;
+            case 'h':
+                s_usage(0);
+                break;
+            default:
+                fprintf(stderr, "Unknown option\n");
+                s_usage(1);
+        }
+    }
+    return path_count;
+}
+
+/* hex, or the x-amz-checksum-* header value (base64 of the big-endian bytes) */
+static void s_format_checksum(const struct cli_options *options, uint64_t crc, char *out, size_t out_size) {
+    const struct cli_algorithm *algorithm = options->algorithm;
+    if (!options->base64) {
+        snprintf(out, out_size, "%0*" PRIx64, (int)(algorithm->width * 2), crc);
+        return;
+    }
+
+    struct aws_byte_buf buffer = aws_byte_buf_from_empty_array(out, out_size - 1);
+    if (algorithm->has_library_algorithm) {
+        aws_checksums_header_value_encode((uint32_t)crc, &buffer);
+    } else {
+        /* the header value helpers are 32 bit only */
+        uint8_t bytes[8];
+        for (size_t i = 0; i < algorithm->width; ++i) {
+            bytes[i] = (uint8_t)(crc >> (8 * (algorithm->width - 1 - i)));
+        }
+        struct aws_byte_cursor cursor = aws_byte_cursor_from_array(bytes, algorithm->width);
+        aws_base64_encode(&cursor, &buffer);
+    }
+    out[buffer.len] = '\0';
+}
+
+/* the checksum S3 reports for a multipart upload, computed by the library from the part checksums */
+static int s_composite(const struct cli_options *options, const struct cli_digest *digest, uint32_t *out_crc) {
+    struct aws_checksums_part *parts =
+        aws_mem_calloc(options->allocator, digest->part_count, sizeof(struct aws_checksums_part));
+    if (!parts) {
+        return AWS_OP_ERR;
+    }
+    for (size_t i = 0; i < digest->part_count; ++i) {
+        parts[i].crc = (uint32_t)digest->parts[i].crc;
+        parts[i].length = digest->parts[i].length;
+    }
+
+    struct aws_checksums_multipart_crc multipart;
+    int result = aws_checksums_multipart_crc_compute(
+        options->algorithm->library_algorithm, parts, digest->part_count, &multipart);
+    aws_mem_release(options->allocator, parts);
+    if (result == AWS_OP_SUCCESS) {
+        *out_crc = multipart.composite_crc;
+    }
+    return result;
+}
+
+static void s_print_digest(const struct cli_options *options, const char *path, const struct cli_digest *digest) {
+    char checksum[32];
+
+    s_format_checksum(options, digest->crc, checksum, sizeof(checksum));
+    fprintf(stdout, "%s  %s\n", checksum, path);
+
+    if (options->part_size) {
+        for (size_t i = 0; i < digest->part_count; ++i) {
+            const struct cli_part *part = &digest->parts[i];
+            s_format_checksum(options, part->crc, checksum, sizeof(checksum));
+            fprintf(
+                stdout,
+                "%s  %s part %zu offset %" PRIu64 " length %" PRIu64 "\n",
+                checksum,
+                path,
+                i + 1,
+                part->offset,
+                part->length);
+        }
+        /* S3 only takes the full object checksum for crc64nvme, there is no composite of it */
+        uint32_t composite = 0;
+        if (options->algorithm->has_library_algorithm && !s_composite(options, digest, &composite)) {
+            if (options->base64) {
+                struct aws_byte_buf buffer = aws_byte_buf_from_empty_array(checksum, sizeof(checksum) - 1);
+                aws_checksums_header_value_encode_composite(composite, digest->part_count, &buffer);
+                checksum[buffer.len] = '\0';
+            } else {
+                s_format_checksum(options, composite, checksum, sizeof(checksum));
+                snprintf(checksum + strlen(checksum), sizeof(checksum) - strlen(checksum), "-%zu", digest->part_count);
+            }
+            fprintf(stdout, "%s  %s composite\n", checksum, path);
+        }
+    }
+    fflush(stdout);
+
+    if (options->stats) {
+        double seconds = (double)digest->elapsed_ns / 1e9;
+        fprintf(
+            stderr,
+            "%s: %s %" PRIu64 " bytes in %.3f s, %.3f GB/s, %zu thread%s\n",
+            path,
+            options->algorithm->name,
+            digest->bytes,
+            seconds,
+            digest->elapsed_ns ? (double)digest->bytes / (double)digest->elapsed_ns : 0.0,
+            digest->threads,
+            digest->threads == 1 ? "" : "s");
+    }
+}
+
+static int s_run_path(const struct cli_options *options, const char *path) {
+    struct cli_digest digest;
+    if (cli_digest_path(options, path, &digest)) {
+        fprintf(stderr, "aws-checksums-cli: %s: %s\n", path, aws_error_str(aws_last_error()));
+        return 1;
+    }
+
+    s_print_digest(options, path, &digest);
+    cli_digest_clean_up(options->allocator, &digest);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    struct aws_allocator *allocator = aws_default_allocator();
+    aws_common_library_init(allocator);
+
+    struct cli_options options = {
+        .allocator = allocator,
+        .algorithm = &g_cli_algorithms[1], /* crc32c */
+    };
+    const char **paths = aws_mem_calloc(allocator, (size_t)argc, sizeof(const char *));
+    size_t path_count = s_parse_options(argc, argv, &options, paths);
+
+    int exit_code = 0;
+    if (!path_count) {
+        exit_code = s_run_path(&options, "-");
+    }
+    for (size_t i = 0; i < path_count; ++i) {
+        exit_code |= s_run_path(&options, paths[i]);
+    }
+
+    aws_mem_release(allocator, paths);
+    aws_common_library_clean_up();
+    return exit_code;
+}
@@ -0,0 +1,133 @@
+#ifndef AWS_CHECKSUMS_BLOCK_INDEX_H
+#define AWS_CHECKSUMS_BLOCK_INDEX_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/byte_buf.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+struct aws_allocator;
+
+/*
+ * Block index: the crc of every block_size bytes of an object plus the crc of the whole object, kept next to the
+ * object (a sidecar file, an xattr, a metadata column) so a ranged read can be checked without the rest of the
+ * object. The index is a fixed header followed by one 4 byte crc per block, the last block being shorter when
+ * block_size doesn't divide the object length. Every field has a fixed offset, so an index can be used in place from
+ * a mapped file or a received buffer without parsing it into anything. All integers are little-endian:
+ *
+ *   header  4 bytes  "ACKI"
+ *           1 byte   version (1)
+ *           1 byte   algorithm (enum aws_checksums_crc_algorithm)
+ *           2 bytes  reserved, 0
+ *           4 bytes  block_size
+ *           4 bytes  crc of the whole object
+ *           8 bytes  object length
+ *           4 bytes  reserved, 0
+ *           4 bytes  crc32c of the 28 header bytes above
+ *   entries 4 bytes  crc of block i, for i in 0 .. ceil(object length / block_size) - 1
+ */
+#define AWS_CHECKSUMS_BLOCK_INDEX_VERSION 1
+#define AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE 32
+
+/* A parsed index. entries points into the bytes the index was parsed from, which must outlive it. */
+struct aws_checksums_block_index {
+    enum aws_checksums_crc_algorithm algorithm;
+    uint32_t block_size;
+    uint32_t object_crc;
+    uint64_t object_length;
+    uint64_t block_count;
+    const uint8_t *entries;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Computes the size in bytes of the index of an object_length byte object. Raises AWS_ERROR_INVALID_ARGUMENT if
+ * block_size is 0 or larger than INT_MAX and AWS_ERROR_OVERFLOW_DETECTED if the index doesn't fit in a size_t.
+ */
+AWS_CHECKSUMS_API int aws_checksums_block_index_compute_size(
+    uint64_t object_length,
+    uint32_t block_size,
+    size_t *out_size);
+
+/**
+ * Builds the index of the length bytes at data in a single pass, appending it to output. Each block is checksummed
+ * once and the whole object crc is merged from the block crcs, so the data is read exactly once. Raises
+ * AWS_ERROR_SHORT_BUFFER if output doesn't have aws_checksums_block_index_compute_size() bytes left, and
+ * AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm or a bad block_size.
+ */
+AWS_CHECKSUMS_API int aws_checksums_block_index_build(
+    enum aws_checksums_crc_algorithm algorithm,
+    const uint8_t *data,
+    size_t length,
+    uint32_t block_size,
+    struct aws_byte_buf *output);
+
+/**
+ * Builds the index of the file at path, reading it once front to back. out_index is initialized with allocator to
+ * exactly the index size; release it with aws_byte_buf_clean_up(). Raises the errors of
+ * aws_checksums_block_index_build(), the translated I/O error if the file can't be opened or read,
+ * AWS_ERROR_UNSUPPORTED_OPERATION for files without a length (pipes), and AWS_ERROR_FILE_READ_FAILURE if the file
+ * gets shorter while it is read.
+ */
+AWS_CHECKSUMS_API int aws_checksums_block_index_build_file(
+    struct aws_allocator *allocator,
+    const char *path,
+    enum aws_checksums_crc_algorithm algorithm,
+    uint32_t block_size,
+    struct aws_byte_buf *out_index);
+
+/**
+ * Validates the header of the index in input, checks that input holds all of its entries, and fills out without
+ * copying them. Raises AWS_ERROR_SHORT_BUFFER if input is shorter than the index, and AWS_ERROR_INVALID_ARGUMENT if it
+ * isn't an index, has a version or algorithm this library doesn't know, or its header fails the integrity check.
+ */
+AWS_CHECKSUMS_API int aws_checksums_block_index_parse(
+    struct aws_byte_cursor input,
+    struct aws_checksums_block_index *out);
+
+/**
+ * Returns the stored crc of block block_number, which must be below index->block_count.
+ */
+AWS_CHECKSUMS_API uint32_t aws_checksums_block_index_get_block_crc(
+    const struct aws_checksums_block_index *index,
+    uint64_t block_number);
+
+/**
+ * Computes what the crc of the length bytes of the object starting at offset is according to the index. data holds
+ * those length bytes, but only the partial blocks at either end of the range are read and hashed: every block the
+ * range covers entirely contributes its stored crc through GF(2) combine. A range of whole blocks reads no data at all
+ * (data may then be NULL). Raises AWS_ERROR_INVALID_ARGUMENT if the range isn't inside the object.
+ */
+AWS_CHECKSUMS_API int aws_checksums_block_index_range_crc(
+    const struct aws_checksums_block_index *index,
+    uint64_t offset,
+    uint64_t length,
+    const uint8_t *data,
+    uint32_t *out_crc);
+
+/**
+ * Checks the length bytes at offset as they were received or read, data, against the index: every block of the range
+ * is hashed and compared to its own stored crc, so damage anywhere in data is caught. out_matches is set to whether
+ * all of them agree.
+ *
+ * Only whole blocks can be checked, a part of a block has nothing in the index to compare with: the range must start
+ * on a block boundary and end on one or at the end of the object, so widen ranged reads that are to be verified to
+ * block boundaries. Raises AWS_ERROR_INVALID_ARGUMENT if the range isn't block aligned or isn't inside the object.
+ */
+AWS_CHECKSUMS_API int aws_checksums_block_index_verify_range(
+    const struct aws_checksums_block_index *index,
+    uint64_t offset,
+    uint64_t length,
+    const uint8_t *data,
+    bool *out_matches);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_BLOCK_INDEX_H */
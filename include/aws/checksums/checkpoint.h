@@ -0,0 +1,87 @@
+#ifndef AWS_CHECKSUMS_CHECKPOINT_H
+#define AWS_CHECKSUMS_CHECKPOINT_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/byte_buf.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+/*
+ * Persisted form of a running crc, so an interrupted upload can resume from the bytes already sent and shards
+ * checksummed on different hosts can be merged. Fixed size, all integers big-endian:
+ *
+ *   4 bytes  "ACKP"
+ *   1 byte   version (1)
+ *   1 byte   algorithm (enum aws_checksums_crc_algorithm)
+ *   2 bytes  reserved, 0
+ *   8 bytes  bytes processed
+ *   4 bytes  running crc
+ *   4 bytes  crc32c of the 20 bytes above, so a torn or corrupted checkpoint is rejected instead of resumed from
+ */
+#define AWS_CHECKSUMS_CHECKPOINT_VERSION 1
+#define AWS_CHECKSUMS_CHECKPOINT_SIZE 24
+
+/* the crc of the first length bytes of a stream (or of a shard of it, checksummed from 0) */
+struct aws_checksums_checkpoint {
+    enum aws_checksums_crc_algorithm algorithm;
+    uint32_t crc;
+    uint64_t length;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Starts an empty checkpoint for algorithm. Raises AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm.
+ */
+AWS_CHECKSUMS_API int aws_checksums_checkpoint_init(
+    struct aws_checksums_checkpoint *checkpoint,
+    enum aws_checksums_crc_algorithm algorithm);
+
+/**
+ * Continues the checkpoint's crc over the next length bytes of the stream. Raises AWS_ERROR_OVERFLOW_DETECTED if the
+ * total length would no longer fit in 64 bits.
+ */
+AWS_CHECKSUMS_API int aws_checksums_checkpoint_update(
+    struct aws_checksums_checkpoint *checkpoint,
+    const uint8_t *input,
+    size_t length);
+
+/**
+ * Appends the AWS_CHECKSUMS_CHECKPOINT_SIZE byte encoding of checkpoint to output. Raises AWS_ERROR_SHORT_BUFFER if
+ * there is not enough room and AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm.
+ */
+AWS_CHECKSUMS_API int aws_checksums_checkpoint_encode(
+    const struct aws_checksums_checkpoint *checkpoint,
+    struct aws_byte_buf *output);
+
+/**
+ * Consumes one encoded checkpoint from input. Raises AWS_ERROR_SHORT_BUFFER on a truncated one and
+ * AWS_ERROR_INVALID_ARGUMENT if it isn't a checkpoint, has a version or algorithm this library doesn't know, or fails
+ * its integrity check; input is left untouched on failure.
+ */
+AWS_CHECKSUMS_API int aws_checksums_checkpoint_decode(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_checkpoint *checkpoint);
+
+/**
+ * Merges two checkpoints of the same algorithm, where second covers the bytes right after the ones first covers,
+ * into the checkpoint of both: out->length = first->length + second->length, and out->crc combines the crcs with
+ * aws_checksums_crc32_combine() / aws_checksums_crc32c_combine() without the data. out may be first or second.
+ *
+ * Raises AWS_ERROR_INVALID_ARGUMENT if the algorithms differ and AWS_ERROR_OVERFLOW_DETECTED if the total length
+ * doesn't fit in 64 bits.
+ */
+AWS_CHECKSUMS_API int aws_checksums_checkpoint_merge(
+    const struct aws_checksums_checkpoint *first,
+    const struct aws_checksums_checkpoint *second,
+    struct aws_checksums_checkpoint *out);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_CHECKPOINT_H */
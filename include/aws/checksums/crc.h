@@ -7,9 +7,22 @@
 
 #include <aws/checksums/exports.h>
 #include <aws/common/macros.h>
+#include <stddef.h>
 #include <stdint.h>
 
 AWS_PUSH_SANE_WARNING_LEVEL
+
+/**
+ * The CRC algorithms implemented by this library.
+ */
+enum aws_checksums_crc_algorithm {
+    /* CRC32 (Ethernet, gzip), see aws_checksums_crc32() */
+    AWS_CHECKSUMS_CRC32,
+    /* Castagnoli CRC32c (iSCSI), see aws_checksums_crc32c() */
+    AWS_CHECKSUMS_CRC32C,
+    AWS_CHECKSUMS_CRC_ALGORITHM_COUNT,
+};
+
 AWS_EXTERN_C_BEGIN
 
 /**
@@ -28,6 +41,85 @@ AWS_CHECKSUMS_API uint32_t aws_checksums_crc32(const uint8_t *input, int length,
  */
 AWS_CHECKSUMS_API uint32_t aws_checksums_crc32c(const uint8_t *input, int length, uint32_t previousCrc32);
 
+/**
+ * Returns the CRC32 of A followed by B, given crcA = aws_checksums_crc32(A, lenA, 0), crcB =
+ * aws_checksums_crc32(B, lenB, 0) and lenB. Pieces checksummed independently (by different threads, or as the parts
+ * of a multipart upload) can be merged without reading the data again. Costs O(log lenB) and no table.
+ */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB);
+
+/**
+ * Returns the CRC32c of A followed by B, see aws_checksums_crc32_combine().
+ */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32c_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB);
+
+/**
+ * Returns the CRC32 of a total_len byte buffer after the n bytes at offset changed from old_bytes to new_bytes, given
+ * old_crc, its CRC32 before the change. Only the changed bytes are read: the crc is linear over GF(2), so the update
+ * is the crc of old_bytes ^ new_bytes shifted over the rest of the buffer, O(n + log total_len) instead of rehashing
+ * total_len bytes. offset + n must not exceed total_len: the result is undefined if it does, and only debug builds
+ * check it (AWS_PRECONDITION).
+ */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32_patch(
+    uint32_t old_crc,
+    uint64_t total_len,
+    uint64_t offset,
+    const uint8_t *old_bytes,
+    const uint8_t *new_bytes,
+    size_t n);
+
+/**
+ * Returns the CRC32c of a buffer after an in-place change, see aws_checksums_crc32_patch().
+ */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32c_patch(
+    uint32_t old_crc,
+    uint64_t total_len,
+    uint64_t offset,
+    const uint8_t *old_bytes,
+    const uint8_t *new_bytes,
+    size_t n);
+
+/**
+ * Hashes count keys of key_size bytes each, stored back to back starting at keys, with the Castagnoli CRC32c:
+ * hashes[i] = aws_checksums_crc32c(keys + i * key_size, key_size, seed). Meant for hash tables and hash joins over
+ * short fixed-width keys (8 and 16 bytes being the common case), where one call per key costs more than the crc
+ * itself; with crc instructions several keys are hashed in parallel. key_size must fit in an int.
+ */
+AWS_CHECKSUMS_API void aws_checksums_crc32c_hash_keys(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes);
+
+/**
+ * Verifies count records at once: record i is the lengths[i] bytes at buffers[i], expected to have CRC32 (computed
+ * from 0) expected_crcs[i]. Bit i of mismatch_bitmap (byte i / 8, bit i % 8) is set if it doesn't; the bitmap must
+ * hold (count + 7) / 8 bytes and is written entirely, unused bits of the last byte cleared. Returns the number of
+ * mismatches. Records go straight to the kernel aws_checksums_crc32() selects, without counting in the crc statistics,
+ * trace or probes; one longer than INT_MAX bytes is done in pieces.
+ */
+AWS_CHECKSUMS_API size_t aws_checksums_crc32_verify_batch(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    const uint32_t *expected_crcs,
+    size_t count,
+    uint8_t *mismatch_bitmap);
+
+/**
+ * Verifies count records against their CRC32c, see aws_checksums_crc32_verify_batch(). Where the cpu has crc32c
+ * instructions the records run four side by side in independent lanes, as in aws_checksums_crc32c_hash_keys(),
+ * whichever kernel aws_checksums_crc32c() selects for single inputs; a batch of small records then costs about as much
+ * as the crc of their bytes rather than a call and a dependency chain per record. Otherwise each record goes through
+ * that kernel on its own.
+ */
+AWS_CHECKSUMS_API size_t aws_checksums_crc32c_verify_batch(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    const uint32_t *expected_crcs,
+    size_t count,
+    uint8_t *mismatch_bitmap);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
@@ -0,0 +1,202 @@
+#ifndef AWS_CHECKSUMS_CRC_HPP
+#define AWS_CHECKSUMS_CRC_HPP
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/*
+ * Optional C++ interface, header only, C++14 or newer. Nothing here is compiled into the library: CRC32 and CRC32c
+ * at runtime go through aws_checksums_crc32() and aws_checksums_crc32c(), so the C API stays the one implementation
+ * of those. What the header adds is compile-time evaluation (constant protocol strings, header magic) and other
+ * polynomials, such as CRC64/NVME, through tables generated by the compiler.
+ *
+ *     static_assert(Aws::Checksums::Crc32c::Literal("123456789") == 0xE3069283, "");
+ *
+ *     Aws::Checksums::Crc32cHasher hasher;
+ *     hasher.Update(header, header_len).Update(body, body_len);
+ *     uint32_t crc = hasher.Value();
+ *
+ * All values follow the C API: pass the previous result to continue a running crc, 0 to start a new one.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#if !(__cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L))
+#    error "aws/checksums/crc.hpp requires C++14 or newer"
+#endif
+
+namespace Aws {
+namespace Checksums {
+
+/*
+ * A polynomial is a type with the register width as ValueType and the bit-reflected polynomial as Reflected. The
+ * crc is reflected, starts from all ones and is inverted at the end, like every algorithm in this library.
+ */
+
+/* CRC32 (Ethernet, gzip), computed at runtime by aws_checksums_crc32() */
+struct Crc32Polynomial {
+    using ValueType = uint32_t;
+    static constexpr ValueType Reflected = 0xEDB88320u;
+};
+
+/* Castagnoli CRC32c (iSCSI), computed at runtime by aws_checksums_crc32c() */
+struct Crc32cPolynomial {
+    using ValueType = uint32_t;
+    static constexpr ValueType Reflected = 0x82F63B78u;
+};
+
+/* CRC64/NVME (the S3 full object crc64), computed at runtime with slice-by-8 tables from this header */
+struct Crc64NvmePolynomial {
+    using ValueType = uint64_t;
+    static constexpr ValueType Reflected = 0x9A6C9329AC4BC9B5ull;
+};
+
+namespace Detail {
+
+/* tables[s][n] is the crc register after byte n followed by s zero bytes, slice-by-8 layout */
+template <typename T> struct SliceTables {
+    T entries[8][256];
+};
+
+template <typename T> constexpr SliceTables<T> MakeSliceTables(T reflected) {
+    SliceTables<T> tables{};
+    for (unsigned n = 0; n < 256; ++n) {
+        T crc = static_cast<T>(n);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? static_cast<T>((crc >> 1) ^ reflected) : static_cast<T>(crc >> 1);
+        }
+        tables.entries[0][n] = crc;
+    }
+    for (unsigned n = 0; n < 256; ++n) {
+        for (int slice = 1; slice < 8; ++slice) {
+            T previous = tables.entries[slice - 1][n];
+            tables.entries[slice][n] = static_cast<T>((previous >> 8) ^ tables.entries[0][previous & 0xff]);
+        }
+    }
+    return tables;
+}
+
+template <typename Poly> struct Tables {
+    static constexpr SliceTables<typename Poly::ValueType> Value =
+        MakeSliceTables<typename Poly::ValueType>(Poly::Reflected);
+};
+
+/* C++17 makes static constexpr members implicitly inline, the out-of-class definition is only needed (and is
+ * deprecated) before that */
+#if __cplusplus < 201703L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename Poly> constexpr SliceTables<typename Poly::ValueType> Tables<Poly>::Value;
+#endif
+
+/*
+ * Runtime kernel per polynomial, picked at compile time. The default runs the generated tables eight bytes at a time
+ * on the non-inverted register; the specializations below hand the library's own polynomials to the C API, which
+ * dispatches to crc instructions and carry-less multiply kernels.
+ */
+template <typename Poly> struct Kernel {
+    using ValueType = typename Poly::ValueType;
+
+    static ValueType Update(const uint8_t *data, size_t length, ValueType previous) {
+        const auto &t = Tables<Poly>::Value.entries;
+        ValueType crc = static_cast<ValueType>(~previous);
+        while (length >= 8) {
+            uint64_t word = 0;
+            for (int i = 7; i >= 0; --i) {
+                word = (word << 8) | data[i];
+            }
+            word ^= static_cast<uint64_t>(crc);
+            crc = static_cast<ValueType>(
+                t[7][word & 0xff] ^ t[6][(word >> 8) & 0xff] ^ t[5][(word >> 16) & 0xff] ^
+                t[4][(word >> 24) & 0xff] ^ t[3][(word >> 32) & 0xff] ^ t[2][(word >> 40) & 0xff] ^
+                t[1][(word >> 48) & 0xff] ^ t[0][word >> 56]);
+            data += 8;
+            length -= 8;
+        }
+        while (length-- > 0) {
+            crc = static_cast<ValueType>((crc >> 8) ^ t[0][(crc ^ *data++) & 0xff]);
+        }
+        return static_cast<ValueType>(~crc);
+    }
+};
+
+/* the C entry points take an int length, longer inputs go in INT_MAX sized pieces */
+template <uint32_t (*Fn)(const uint8_t *, int, uint32_t)> struct CKernel {
+    static uint32_t Update(const uint8_t *data, size_t length, uint32_t previous) {
+        while (length > static_cast<size_t>(INT_MAX)) {
+            previous = Fn(data, INT_MAX, previous);
+            data += INT_MAX;
+            length -= static_cast<size_t>(INT_MAX);
+        }
+        return Fn(data, static_cast<int>(length), previous);
+    }
+};
+
+template <> struct Kernel<Crc32Polynomial> : CKernel<aws_checksums_crc32> {};
+template <> struct Kernel<Crc32cPolynomial> : CKernel<aws_checksums_crc32c> {};
+
+} // namespace Detail
+
+template <typename Poly> class Crc {
+  public:
+    using ValueType = typename Poly::ValueType;
+
+    /* Same result as Checksum(), usable in constant expressions. Byte at a time, meant for short constant data. */
+    static constexpr ValueType Constexpr(const char *data, size_t length, ValueType previous = 0) {
+        ValueType crc = static_cast<ValueType>(~previous);
+        for (size_t i = 0; i < length; ++i) {
+            crc = static_cast<ValueType>(
+                (crc >> 8) ^ Detail::Tables<Poly>::Value.entries[0][(crc ^ static_cast<uint8_t>(data[i])) & 0xff]);
+        }
+        return static_cast<ValueType>(~crc);
+    }
+
+    /* crc of a string literal, without its terminating nul, at compile time */
+    template <size_t N> static constexpr ValueType Literal(const char (&literal)[N], ValueType previous = 0) {
+        return Constexpr(literal, N - 1, previous);
+    }
+
+    /* crc of data at runtime with the kernel picked for Poly */
+    static ValueType Checksum(const uint8_t *data, size_t length, ValueType previous = 0) {
+        return Detail::Kernel<Poly>::Update(data, length, previous);
+    }
+};
+
+/*
+ * Streaming hasher: holds only the running crc, every Update() is a direct call into the kernel. The value is always
+ * the crc of everything passed so far, so it can be read at any point and updating may continue afterwards.
+ */
+template <typename Poly> class CrcHasher {
+  public:
+    using ValueType = typename Poly::ValueType;
+
+    explicit CrcHasher(ValueType previous = 0) noexcept : m_crc(previous) {}
+
+    CrcHasher &Update(const void *data, size_t length) {
+        m_crc = Crc<Poly>::Checksum(static_cast<const uint8_t *>(data), length, m_crc);
+        return *this;
+    }
+
+    ValueType Value() const noexcept { return m_crc; }
+
+    void Reset(ValueType previous = 0) noexcept { m_crc = previous; }
+
+  private:
+    ValueType m_crc;
+};
+
+using Crc32 = Crc<Crc32Polynomial>;
+using Crc32c = Crc<Crc32cPolynomial>;
+using Crc64Nvme = Crc<Crc64NvmePolynomial>;
+
+using Crc32Hasher = CrcHasher<Crc32Polynomial>;
+using Crc32cHasher = CrcHasher<Crc32cPolynomial>;
+using Crc64NvmeHasher = CrcHasher<Crc64NvmePolynomial>;
+
+} // namespace Checksums
+} // namespace Aws
+
+#endif /* AWS_CHECKSUMS_CRC_HPP */
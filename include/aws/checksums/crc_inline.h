@@ -0,0 +1,245 @@
+#ifndef AWS_CHECKSUMS_CRC_INLINE_H
+#define AWS_CHECKSUMS_CRC_INLINE_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <string.h>
+
+/*
+ * Header-only crc kernels for code compiled for a fixed instruction set (e.g. -msse4.2 or -march=armv8-a+crc, usually
+ * together with a library built with AWS_CHECKSUMS_FIXED_ISA). When the including translation unit is compiled with
+ * crc instructions enabled these are plain instruction loops the compiler can inline and specialize on a constant
+ * length; otherwise they call the dispatching entry points in crc.h. Results are identical either way.
+ */
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__SSE4_2__)
+#    include <nmmintrin.h>
+#    define AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32) && !defined(__AARCH64EB__)
+#    include <arm_acle.h>
+#    define AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS
+#    define AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS
+#endif
+
+/* x86 has no crc32 (gzip) instruction, but fixed widths reduce with a couple of carry-less multiplies */
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__PCLMUL__) && !defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS)
+#    include <wmmintrin.h>
+#    define AWS_CHECKSUMS_INLINE_CRC32_CLMUL
+#endif
+
+AWS_PUSH_SANE_WARNING_LEVEL
+AWS_EXTERN_C_BEGIN
+
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_load_u32(const uint8_t *input) {
+    uint32_t value = 0;
+    memcpy(&value, input, sizeof(value));
+    return value;
+}
+
+AWS_STATIC_IMPL uint64_t aws_checksums_inline_load_u64(const uint8_t *input) {
+    uint64_t value = 0;
+    memcpy(&value, input, sizeof(value));
+    return value;
+}
+
+/*
+ * Single step helpers on the non-inverted crc register: append 4 or 8 little-endian bytes to crc. Only defined where
+ * the fixed-width functions below use them.
+ */
+#if defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32c_step_u32(uint32_t crc, uint32_t value) {
+#    if defined(__aarch64__)
+    return __crc32cw(crc, value);
+#    else
+    return _mm_crc32_u32(crc, value);
+#    endif
+}
+
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32c_step_u64(uint32_t crc, uint64_t value) {
+#    if defined(__aarch64__)
+    return __crc32cd(crc, value);
+#    else
+    return (uint32_t)_mm_crc32_u64(crc, value);
+#    endif
+}
+#endif /* AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS */
+
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS)
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32_step_u32(uint32_t crc, uint32_t value) {
+    return __crc32w(crc, value);
+}
+
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32_step_u64(uint32_t crc, uint64_t value) {
+    return __crc32d(crc, value);
+}
+#elif defined(AWS_CHECKSUMS_INLINE_CRC32_CLMUL)
+/*
+ * Barrett reduction: returns the crc register after appending 4 zero bytes to the low half of value, xor-ed with the
+ * high half. The constants are the reflected CRC32 polynomial with its x^32 term and floor(x^64 / p), reflected.
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32_barrett(uint64_t value) {
+    const __m128i constants = _mm_set_epi64x(0x1F7011641LL, 0x1DB710641LL);
+    const __m128i low_half = _mm_set_epi32(0, 0, 0, -1);
+    __m128i x = _mm_cvtsi64_si128((long long)value);
+    __m128i t = _mm_clmulepi64_si128(_mm_and_si128(x, low_half), constants, 0x10);
+    t = _mm_clmulepi64_si128(_mm_and_si128(t, low_half), constants, 0x00);
+    return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(_mm_xor_si128(x, t), 4));
+}
+
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32_step_u32(uint32_t crc, uint32_t value) {
+    return aws_checksums_inline_crc32_barrett(crc ^ value);
+}
+
+AWS_STATIC_IMPL uint32_t aws_checksums_inline_crc32_step_u64(uint32_t crc, uint64_t value) {
+    return aws_checksums_inline_crc32_barrett(aws_checksums_inline_crc32_barrett(value ^ crc));
+}
+#endif
+
+/**
+ * Same result as aws_checksums_crc32c(). Inlined crc32 instructions on x86-64 with SSE4.2 and on ARMv8 with the crc
+ * extension, a call to aws_checksums_crc32c() otherwise.
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32c_inline(const uint8_t *input, int length, uint32_t previousCrc32c) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+    uint32_t crc = ~previousCrc32c;
+    while (length >= 8) {
+        crc = aws_checksums_inline_crc32c_step_u64(crc, aws_checksums_inline_load_u64(input));
+        input += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+#    if defined(__aarch64__)
+        crc = __crc32cb(crc, *input++);
+#    else
+        crc = _mm_crc32_u8(crc, *input++);
+#    endif
+    }
+    return ~crc;
+#else
+    return aws_checksums_crc32c(input, length, previousCrc32c);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32(). Inlined crc32 instructions on ARMv8 with the crc extension (x86 has no crc32
+ * instruction for this polynomial), a call to aws_checksums_crc32() otherwise.
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32_inline(const uint8_t *input, int length, uint32_t previousCrc32) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS)
+    uint32_t crc = ~previousCrc32;
+    while (length >= 8) {
+        crc = aws_checksums_inline_crc32_step_u64(crc, aws_checksums_inline_load_u64(input));
+        input += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = __crc32b(crc, *input++);
+    }
+    return ~crc;
+#else
+    return aws_checksums_crc32(input, length, previousCrc32);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32c(input, 4, previousCrc32c), for callers that checksum fixed-width fields (message
+ * preludes, hash keys). The _u32, _u64, _u96 and _u128 variants cover 4, 8, 12 and 16 bytes and compile to one or two
+ * crc32 instructions, with no call, dispatch or length check, where the including file targets SSE4.2 or ARMv8 crc.
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32c_u32(const uint8_t *input, uint32_t previousCrc32c) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+    return ~aws_checksums_inline_crc32c_step_u32(~previousCrc32c, aws_checksums_inline_load_u32(input));
+#else
+    return aws_checksums_crc32c(input, 4, previousCrc32c);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32c(input, 8, previousCrc32c), see aws_checksums_crc32c_u32().
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32c_u64(const uint8_t *input, uint32_t previousCrc32c) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+    return ~aws_checksums_inline_crc32c_step_u64(~previousCrc32c, aws_checksums_inline_load_u64(input));
+#else
+    return aws_checksums_crc32c(input, 8, previousCrc32c);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32c(input, 12, previousCrc32c), see aws_checksums_crc32c_u32().
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32c_u96(const uint8_t *input, uint32_t previousCrc32c) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+    uint32_t crc = aws_checksums_inline_crc32c_step_u64(~previousCrc32c, aws_checksums_inline_load_u64(input));
+    return ~aws_checksums_inline_crc32c_step_u32(crc, aws_checksums_inline_load_u32(input + 8));
+#else
+    return aws_checksums_crc32c(input, 12, previousCrc32c);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32c(input, 16, previousCrc32c), see aws_checksums_crc32c_u32().
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32c_u128(const uint8_t *input, uint32_t previousCrc32c) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+    uint32_t crc = aws_checksums_inline_crc32c_step_u64(~previousCrc32c, aws_checksums_inline_load_u64(input));
+    return ~aws_checksums_inline_crc32c_step_u64(crc, aws_checksums_inline_load_u64(input + 8));
+#else
+    return aws_checksums_crc32c(input, 16, previousCrc32c);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32(input, 4, previousCrc32), see aws_checksums_crc32c_u32(). On x86 with PCLMUL each
+ * 4 byte step is a Barrett reduction of two carry-less multiplies, on ARMv8 crc it is one crc32 instruction.
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32_u32(const uint8_t *input, uint32_t previousCrc32) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS) || defined(AWS_CHECKSUMS_INLINE_CRC32_CLMUL)
+    return ~aws_checksums_inline_crc32_step_u32(~previousCrc32, aws_checksums_inline_load_u32(input));
+#else
+    return aws_checksums_crc32(input, 4, previousCrc32);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32(input, 8, previousCrc32), see aws_checksums_crc32_u32().
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32_u64(const uint8_t *input, uint32_t previousCrc32) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS) || defined(AWS_CHECKSUMS_INLINE_CRC32_CLMUL)
+    return ~aws_checksums_inline_crc32_step_u64(~previousCrc32, aws_checksums_inline_load_u64(input));
+#else
+    return aws_checksums_crc32(input, 8, previousCrc32);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32(input, 12, previousCrc32), see aws_checksums_crc32_u32().
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32_u96(const uint8_t *input, uint32_t previousCrc32) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS) || defined(AWS_CHECKSUMS_INLINE_CRC32_CLMUL)
+    uint32_t crc = aws_checksums_inline_crc32_step_u64(~previousCrc32, aws_checksums_inline_load_u64(input));
+    return ~aws_checksums_inline_crc32_step_u32(crc, aws_checksums_inline_load_u32(input + 8));
+#else
+    return aws_checksums_crc32(input, 12, previousCrc32);
+#endif
+}
+
+/**
+ * Same result as aws_checksums_crc32(input, 16, previousCrc32), see aws_checksums_crc32_u32().
+ */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32_u128(const uint8_t *input, uint32_t previousCrc32) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_INSTRUCTIONS) || defined(AWS_CHECKSUMS_INLINE_CRC32_CLMUL)
+    uint32_t crc = aws_checksums_inline_crc32_step_u64(~previousCrc32, aws_checksums_inline_load_u64(input));
+    return ~aws_checksums_inline_crc32_step_u64(crc, aws_checksums_inline_load_u64(input + 8));
+#else
+    return aws_checksums_crc32(input, 16, previousCrc32);
+#endif
+}
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_CRC_INLINE_H */
@@ -0,0 +1,88 @@
+#ifndef AWS_CHECKSUMS_EVENT_STREAM_H
+#define AWS_CHECKSUMS_EVENT_STREAM_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/byte_buf.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+/*
+ * The crcs of an event-stream (application/vnd.amazon.eventstream) message. All integers are big-endian:
+ *
+ *   prelude  4 bytes  total length of the message, these 16 bytes of framing included
+ *            4 bytes  headers length
+ *            4 bytes  prelude crc: crc32 of the 8 bytes above
+ *   headers  headers length bytes
+ *   payload  total length - headers length - 16 bytes
+ *   trailer  4 bytes  message crc: crc32 of every byte before it, the prelude crc included
+ *
+ * The message crc starts with the same 8 bytes as the prelude crc, so both come out of one pass: the prelude crc is
+ * the running crc after 8 bytes and the message crc carries on from it.
+ */
+#define AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE 12
+#define AWS_CHECKSUMS_EVENT_STREAM_TRAILER_SIZE 4
+#define AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE                                                                    \
+    (AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE + AWS_CHECKSUMS_EVENT_STREAM_TRAILER_SIZE)
+
+/* A received message: its layout, pointing into the bytes it was validated from, and whether its crcs check out. */
+struct aws_checksums_event_stream_frame {
+    uint32_t total_length;
+    uint32_t headers_length;
+    struct aws_byte_cursor headers;
+    struct aws_byte_cursor payload;
+    /* the crcs computed from the message */
+    uint32_t prelude_crc;
+    uint32_t message_crc;
+    /* whether the crcs stored in the message match; the message crc is only checked if the prelude crc matches */
+    bool prelude_crc_matches;
+    bool message_crc_matches;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Computes the prelude and message crcs of the length byte message at message in a single pass, e.g. to fill them in
+ * when building it. The crc fields of message aren't read, so they can be unset: the computed prelude crc stands in
+ * for them. Raises AWS_ERROR_INVALID_ARGUMENT if length is below AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE.
+ */
+AWS_CHECKSUMS_API int aws_checksums_event_stream_compute_crcs(
+    const uint8_t *message,
+    size_t length,
+    uint32_t *out_prelude_crc,
+    uint32_t *out_message_crc);
+
+/**
+ * Validates the message at the start of input and fills out_frame. The prelude crc is checked before the lengths are
+ * trusted; if it matches, the lengths are checked, the message crc is computed carrying on from the prelude crc and
+ * input is advanced past the message. If it doesn't, input is left as it was since the message can't be delimited.
+ *
+ * A crc mismatch isn't an error, it is reported in out_frame. Raises AWS_ERROR_SHORT_BUFFER, leaving input untouched,
+ * if input doesn't hold the whole message, and AWS_ERROR_INVALID_ARGUMENT if its lengths are inconsistent.
+ */
+AWS_CHECKSUMS_API int aws_checksums_event_stream_validate(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_event_stream_frame *out_frame);
+
+/**
+ * Validates the messages at the start of input back to back, as received on a connection, recording up to
+ * frame_capacity of them in frames and advancing input past each. Stops at the end of input, before a message that
+ * isn't completely in input (the rest is left in input for when more arrives), when frames is full, or after a message
+ * whose crcs don't match (recorded, so check the last frame). out_frame_count receives the number of frames recorded.
+ * Raises AWS_ERROR_INVALID_ARGUMENT if a message has inconsistent lengths, with input and out_frame_count covering
+ * the messages before it.
+ */
+AWS_CHECKSUMS_API int aws_checksums_event_stream_validate_batch(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_event_stream_frame *frames,
+    size_t frame_capacity,
+    size_t *out_frame_count);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_EVENT_STREAM_H */
@@ -0,0 +1,113 @@
+#ifndef AWS_CHECKSUMS_FILE_H
+#define AWS_CHECKSUMS_FILE_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <stdbool.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+struct aws_allocator;
+
+/* default for aws_checksums_file_options.min_bytes_per_thread */
+#define AWS_CHECKSUMS_FILE_DEFAULT_MIN_BYTES_PER_THREAD (16 * 1024 * 1024)
+
+/* default cap on the worker count when aws_checksums_file_options.thread_count is 0 */
+#define AWS_CHECKSUMS_FILE_DEFAULT_MAX_THREADS 8
+
+struct aws_checksums_file_options {
+    /* Threads checksumming the file, including the calling one. 0 picks one per processor, up to
+     * AWS_CHECKSUMS_FILE_DEFAULT_MAX_THREADS, which is where a single socket's memory bandwidth usually runs out. */
+    size_t thread_count;
+    /* Smallest range worth handing to a thread, 0 for AWS_CHECKSUMS_FILE_DEFAULT_MIN_BYTES_PER_THREAD. Files up to
+     * this size are checksummed on the calling thread alone. */
+    uint64_t min_bytes_per_thread;
+    /* Read the file through a buffer on the calling thread instead of mapping it. */
+    bool force_buffered;
+};
+
+/* defaults for aws_checksums_file_stream_options */
+#define AWS_CHECKSUMS_FILE_STREAM_DEFAULT_QUEUE_DEPTH 8
+#define AWS_CHECKSUMS_FILE_STREAM_DEFAULT_BLOCK_SIZE (1024 * 1024)
+
+struct aws_checksums_file_stream_options {
+    /* Reads kept in flight, 0 for AWS_CHECKSUMS_FILE_STREAM_DEFAULT_QUEUE_DEPTH. */
+    size_t queue_depth;
+    /* Bytes per read, rounded up to a multiple of 4 KiB; 0 for AWS_CHECKSUMS_FILE_STREAM_DEFAULT_BLOCK_SIZE. At most
+     * 1 GiB. queue_depth * block_size bytes of buffers are allocated. */
+    size_t block_size;
+    /* Read through the page cache instead of with O_DIRECT. */
+    bool disable_direct_io;
+    /* Use the pread thread pool even where io_uring is available. */
+    bool disable_io_uring;
+};
+
+/*
+ * Where the time of a streaming checksum went. checksum_ns is the calling thread running the crc kernels and
+ * read_wait_ns is it blocked on reads that hadn't completed yet: the I/O the pipeline managed to overlap with
+ * checksumming is what read_wait_ns doesn't account for. read_wait_ns close to 0 means the run was bound by the
+ * kernels, checksum_ns close to 0 means it was bound by the device.
+ */
+struct aws_checksums_file_stream_stats {
+    uint64_t bytes;
+    /* reads issued, including resubmissions of short reads */
+    uint64_t reads;
+    uint64_t elapsed_ns;
+    uint64_t checksum_ns;
+    uint64_t read_wait_ns;
+    /* what the run actually used, see aws_checksums_file_stream_options */
+    bool direct_io;
+    bool io_uring;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Computes the crc of the whole file at path, the same value as aws_checksums_crc32() / aws_checksums_crc32c() over
+ * its contents with a previous crc of 0, and stores it in out_crc. options may be NULL for the defaults.
+ *
+ * Regular files are memory mapped with sequential access (and, where available, huge page) hints, split into one
+ * contiguous range per thread, and the per-range crcs are merged with aws_checksums_crc32_combine() /
+ * aws_checksums_crc32c_combine(), so there is no copy and no ordering between threads. Files that can't be mapped
+ * (pipes, devices, empty files, platforms without mmap support) are read through a buffer on the calling thread.
+ * As with any mapped read, a file truncated by another process while it is being checksummed faults the caller.
+ *
+ * Raises AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm, and the translated I/O error if the file can't be
+ * opened or read.
+ */
+AWS_CHECKSUMS_API int aws_checksums_file_crc(
+    struct aws_allocator *allocator,
+    const char *path,
+    enum aws_checksums_crc_algorithm algorithm,
+    const struct aws_checksums_file_options *options,
+    uint32_t *out_crc);
+
+/**
+ * Computes the crc of the file or block device at path, like aws_checksums_file_crc(), with a read pipeline instead of
+ * a mapping: aligned O_DIRECT reads of block_size bytes, queue_depth of them in flight on io_uring (Linux 5.6+) or a
+ * pread thread pool, and each block is checksummed on the calling thread while the reads after it are pending. Meant
+ * for cold data on fast devices, where page faults and the page cache cost more than the checksum. options may be
+ * NULL for the defaults and out_stats NULL when the breakdown isn't needed.
+ *
+ * O_DIRECT falls back to cached reads on file systems that refuse it, and io_uring to the thread pool where it is
+ * missing or blocked; out_stats says which were used. Raises AWS_ERROR_UNSUPPORTED_OPERATION for pipes and other
+ * files without a size (use aws_checksums_file_crc()) and on Windows, AWS_ERROR_FILE_READ_FAILURE if the file gets
+ * shorter while it is read, AWS_ERROR_OVERFLOW_DETECTED if queue_depth blocks of block_size don't fit in memory, and
+ * the translated I/O error if opening or reading fails.
+ */
+AWS_CHECKSUMS_API int aws_checksums_file_crc_stream(
+    struct aws_allocator *allocator,
+    const char *path,
+    enum aws_checksums_crc_algorithm algorithm,
+    const struct aws_checksums_file_stream_options *options,
+    uint32_t *out_crc,
+    struct aws_checksums_file_stream_stats *out_stats);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_FILE_H */
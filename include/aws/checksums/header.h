@@ -0,0 +1,113 @@
+#ifndef AWS_CHECKSUMS_HEADER_H
+#define AWS_CHECKSUMS_HEADER_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/byte_buf.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+/*
+ * The x-amz-checksum-crc32 / x-amz-checksum-crc32c header (and trailer) value: the crc as 4 big-endian bytes, base64
+ * encoded, so always 8 characters ending in "==" (e.g. "yZRlqg=="). These helpers go straight between the crc and
+ * those 8 characters with fixed table lookups, without the intermediate byte buffer and generic base64 calls.
+ */
+#define AWS_CHECKSUMS_HEADER_VALUE_SIZE 8
+
+/*
+ * The composite checksum of a multipart upload (struct aws_checksums_multipart_crc) is reported as the header value of
+ * composite_crc, "-" and the decimal part count (e.g. "Y2MQzg==-3"). This is the longest such value, a 64 bit count.
+ */
+#define AWS_CHECKSUMS_HEADER_COMPOSITE_VALUE_MAX_SIZE (AWS_CHECKSUMS_HEADER_VALUE_SIZE + 1 + 20)
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Returns the header name carrying a crc of algorithm ("x-amz-checksum-crc32c" etc.), or an empty cursor for an
+ * unknown algorithm. The cursor points at static storage.
+ */
+AWS_CHECKSUMS_API struct aws_byte_cursor aws_checksums_header_name(enum aws_checksums_crc_algorithm algorithm);
+
+/**
+ * Appends the AWS_CHECKSUMS_HEADER_VALUE_SIZE character header value of crc to output. Raises AWS_ERROR_SHORT_BUFFER
+ * if output doesn't have room for it.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_encode(uint32_t crc, struct aws_byte_buf *output);
+
+/**
+ * Decodes a header value into the crc it carries. Spaces and tabs around the value are ignored. Raises
+ * AWS_ERROR_INVALID_BASE64_STR unless the rest is exactly the 8 character canonical encoding of 4 bytes.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_decode(struct aws_byte_cursor value, uint32_t *out_crc);
+
+/**
+ * Appends the composite header value of a multipart upload of part_count parts whose composite crc is crc to output:
+ * the header value of crc, "-" and part_count in decimal. Raises AWS_ERROR_INVALID_ARGUMENT if part_count is zero and
+ * AWS_ERROR_SHORT_BUFFER, leaving output untouched, if output doesn't have room for it.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_encode_composite(
+    uint32_t crc,
+    size_t part_count,
+    struct aws_byte_buf *output);
+
+/**
+ * Decodes a header value that may be a composite one. out_part_count receives the part count after the "-", or zero
+ * if the value has no suffix (a plain or full object checksum). Spaces and tabs around the value are ignored. Raises
+ * AWS_ERROR_INVALID_BASE64_STR if the checksum is malformed or the suffix isn't a part count (a decimal number from 1,
+ * without leading zeros, that fits in a size_t).
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_decode_composite(
+    struct aws_byte_cursor value,
+    uint32_t *out_crc,
+    size_t *out_part_count);
+
+/**
+ * Computes the crc of length bytes at input with the algorithm's kernel and appends its header value to output.
+ * Raises AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm and AWS_ERROR_SHORT_BUFFER if output is too small; output
+ * is left untouched on failure.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_compute(
+    enum aws_checksums_crc_algorithm algorithm,
+    const uint8_t *input,
+    size_t length,
+    struct aws_byte_buf *output);
+
+/**
+ * Checks a received header value against the length bytes at input: the value is decoded and compared to the crc, so
+ * nothing is encoded. out_matches is set to whether they agree. Raises AWS_ERROR_INVALID_ARGUMENT for an unknown
+ * algorithm and the errors of aws_checksums_header_value_decode() for a malformed value.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_verify(
+    enum aws_checksums_crc_algorithm algorithm,
+    const uint8_t *input,
+    size_t length,
+    struct aws_byte_cursor value,
+    bool *out_matches);
+
+/**
+ * Appends the header values of count crcs to output back to back, AWS_CHECKSUMS_HEADER_VALUE_SIZE characters each
+ * (value i at offset i * AWS_CHECKSUMS_HEADER_VALUE_SIZE), e.g. for the parts of a multipart upload. Raises
+ * AWS_ERROR_SHORT_BUFFER, leaving output untouched, unless all of them fit.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_encode_batch(
+    const uint32_t *crcs,
+    size_t count,
+    struct aws_byte_buf *output);
+
+/**
+ * Decodes count header values into out_crcs. Raises AWS_ERROR_INVALID_BASE64_STR if any of them is malformed, in
+ * which case out_crcs holds the values before it.
+ */
+AWS_CHECKSUMS_API int aws_checksums_header_value_decode_batch(
+    const struct aws_byte_cursor *values,
+    size_t count,
+    uint32_t *out_crcs);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_HEADER_H */
@@ -0,0 +1,53 @@
+#ifndef AWS_CHECKSUMS_MULTIPART_H
+#define AWS_CHECKSUMS_MULTIPART_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+/* one part of a multipart upload: its crc (computed from 0) and its length in bytes */
+struct aws_checksums_part {
+    uint32_t crc;
+    uint64_t length;
+};
+
+/*
+ * The two object level checksums S3 accepts for a multipart upload.
+ *
+ * composite_crc is the crc of the part crcs, each as 4 big-endian bytes, concatenated in part order. S3 reports it as
+ * the base64 of those 4 bytes suffixed with "-" and the part count (e.g. "Y2MQzg==-3").
+ *
+ * full_object_crc is the crc of the whole object, the same value a single pass over all the data would produce.
+ */
+struct aws_checksums_multipart_crc {
+    uint32_t composite_crc;
+    uint32_t full_object_crc;
+    uint64_t total_length;
+    size_t part_count;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Computes both multipart checksums of an object from the crcs and lengths of its part_count parts, in order, without
+ * reading the data again. The full object crc merges the parts with aws_checksums_crc32_combine() /
+ * aws_checksums_crc32c_combine(), O(part_count * log(part length)), and runs of parts of the same length (every part
+ * but the last, in the usual upload) share one shift, so most parts cost a single GF(2) multiply.
+ *
+ * Zero parts give zero crcs and length. Raises AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm, a NULL out or NULL
+ * parts with a non-zero count.
+ */
+AWS_CHECKSUMS_API int aws_checksums_multipart_crc_compute(
+    enum aws_checksums_crc_algorithm algorithm,
+    const struct aws_checksums_part *parts,
+    size_t part_count,
+    struct aws_checksums_multipart_crc *out);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_MULTIPART_H */
@@ -0,0 +1,170 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC32C_LANES_H
+#define AWS_CHECKSUMS_PRIVATE_CRC32C_LANES_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+#include <aws/checksums/private/crc_priv.h>
+
+#include <limits.h>
+#include <string.h>
+
+/*
+ * The lane loops behind aws_checksums_crc32c_hash_keys_hw() and aws_checksums_crc32c_multi_hw(), shared by the crc
+ * instruction kernels of every ISA. Each crc32 instruction has a latency of 3 cycles but the unit takes a new one
+ * every cycle, so four independent chains keep it busy where a single input would stall on its own result.
+ *
+ * Only the crc step differs between ISAs. A kernel file defines, before including this header:
+ *
+ *   AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc, word)  the uint32_t register crc after the 8 bytes of the uint64_t word
+ *   AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc, byte)   the same after one byte
+ *
+ * and implements the two entry points with aws_checksums_crc32c_lanes_hash_keys() and
+ * aws_checksums_crc32c_lanes_multi(). Whatever doesn't fill a group of four lanes goes through its
+ * aws_checksums_crc32c_hw().
+ */
+
+AWS_STATIC_IMPL uint64_t aws_checksums_crc32c_lane_load(const uint8_t *input) {
+    uint64_t word;
+    memcpy(&word, input, sizeof(word));
+    return word;
+}
+
+/* four consecutive keys of key_size bytes side by side */
+AWS_STATIC_IMPL void aws_checksums_crc32c_lanes_hash_4_keys(
+    const uint8_t *keys,
+    size_t key_size,
+    uint32_t seed,
+    uint32_t *hashes) {
+
+    const uint8_t *k0 = keys;
+    const uint8_t *k1 = keys + key_size;
+    const uint8_t *k2 = keys + 2 * key_size;
+    const uint8_t *k3 = keys + 3 * key_size;
+    uint32_t crc0 = ~seed;
+    uint32_t crc1 = ~seed;
+    uint32_t crc2 = ~seed;
+    uint32_t crc3 = ~seed;
+    size_t offset = 0;
+
+    for (; offset + 8 <= key_size; offset += 8) {
+        crc0 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc0, aws_checksums_crc32c_lane_load(k0 + offset));
+        crc1 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc1, aws_checksums_crc32c_lane_load(k1 + offset));
+        crc2 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc2, aws_checksums_crc32c_lane_load(k2 + offset));
+        crc3 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc3, aws_checksums_crc32c_lane_load(k3 + offset));
+    }
+    for (; offset < key_size; ++offset) {
+        crc0 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc0, k0[offset]);
+        crc1 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc1, k1[offset]);
+        crc2 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc2, k2[offset]);
+        crc3 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc3, k3[offset]);
+    }
+
+    hashes[0] = ~crc0;
+    hashes[1] = ~crc1;
+    hashes[2] = ~crc2;
+    hashes[3] = ~crc3;
+}
+
+AWS_STATIC_IMPL void aws_checksums_crc32c_lanes_hash_keys(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+
+    size_t i = 0;
+    /* the common widths get their own copies so the per key loops unroll completely */
+    if (key_size == 8) {
+        for (; i + 4 <= count; i += 4) {
+            aws_checksums_crc32c_lanes_hash_4_keys(keys + i * 8, 8, seed, hashes + i);
+        }
+    } else if (key_size == 16) {
+        for (; i + 4 <= count; i += 4) {
+            aws_checksums_crc32c_lanes_hash_4_keys(keys + i * 16, 16, seed, hashes + i);
+        }
+    } else {
+        for (; i + 4 <= count; i += 4) {
+            aws_checksums_crc32c_lanes_hash_4_keys(keys + i * key_size, key_size, seed, hashes + i);
+        }
+    }
+
+    for (; i < count; ++i) {
+        hashes[i] = aws_checksums_crc32c_hw(keys + i * key_size, (int)key_size, seed);
+    }
+}
+
+/* the single buffer kernel over a record of any length, in chunks of at most INT_MAX bytes */
+AWS_STATIC_IMPL uint32_t aws_checksums_crc32c_lanes_tail(const uint8_t *input, size_t length, uint32_t previous_crc) {
+    while (length > INT_MAX) {
+        previous_crc = aws_checksums_crc32c_hw(input, INT_MAX, previous_crc);
+        input += INT_MAX;
+        length -= INT_MAX;
+    }
+    return aws_checksums_crc32c_hw(input, (int)length, previous_crc);
+}
+
+/*
+ * Four records side by side over the length they all have; whatever is left of the longer ones goes through the
+ * single buffer kernel, carrying on from their lane.
+ */
+AWS_STATIC_IMPL void aws_checksums_crc32c_lanes_4_buffers(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    uint32_t *crcs) {
+
+    const uint8_t *b0 = buffers[0];
+    const uint8_t *b1 = buffers[1];
+    const uint8_t *b2 = buffers[2];
+    const uint8_t *b3 = buffers[3];
+    size_t common = lengths[0];
+    for (int i = 1; i < 4; ++i) {
+        common = lengths[i] < common ? lengths[i] : common;
+    }
+    uint32_t crc0 = 0xFFFFFFFF;
+    uint32_t crc1 = 0xFFFFFFFF;
+    uint32_t crc2 = 0xFFFFFFFF;
+    uint32_t crc3 = 0xFFFFFFFF;
+    size_t offset = 0;
+
+    for (; offset + 8 <= common; offset += 8) {
+        crc0 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc0, aws_checksums_crc32c_lane_load(b0 + offset));
+        crc1 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc1, aws_checksums_crc32c_lane_load(b1 + offset));
+        crc2 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc2, aws_checksums_crc32c_lane_load(b2 + offset));
+        crc3 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc3, aws_checksums_crc32c_lane_load(b3 + offset));
+    }
+    for (; offset < common; ++offset) {
+        crc0 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc0, b0[offset]);
+        crc1 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc1, b1[offset]);
+        crc2 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc2, b2[offset]);
+        crc3 = AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc3, b3[offset]);
+    }
+
+    const uint32_t lane_crcs[4] = {~crc0, ~crc1, ~crc2, ~crc3};
+    for (int i = 0; i < 4; ++i) {
+        if (lengths[i] == offset) {
+            crcs[i] = lane_crcs[i];
+        } else {
+            crcs[i] = aws_checksums_crc32c_lanes_tail(buffers[i] + offset, lengths[i] - offset, lane_crcs[i]);
+        }
+    }
+}
+
+AWS_STATIC_IMPL void aws_checksums_crc32c_lanes_multi(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        aws_checksums_crc32c_lanes_4_buffers(buffers + i, lengths + i, crcs + i);
+    }
+    for (; i < count; ++i) {
+        crcs[i] = aws_checksums_crc32c_lanes_tail(buffers[i], lengths[i], 0);
+    }
+}
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC32C_LANES_H */
@@ -0,0 +1,38 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_FILE_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_FILE_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Interface between aws_checksums_file_crc() (source/crc_file.c: splitting, threads, combining) and the platform
+ * file mapping in source/posix or source/windows (AWS_CHECKSUMS_PLATFORM_SOURCE).
+ */
+
+struct aws_checksums_file_mapping {
+    const uint8_t *data;
+    size_t length;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Maps the whole file read-only, hinting sequential access. Raises AWS_ERROR_UNSUPPORTED_OPERATION when the file
+ * can't be mapped but may still be readable (not a regular file, empty, mapping refused or not implemented); the
+ * caller then reads it through a buffer. Any other error means the file can't be opened at all.
+ */
+int aws_checksums_file_map(const char *path, struct aws_checksums_file_mapping *mapping);
+
+void aws_checksums_file_unmap(struct aws_checksums_file_mapping *mapping);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_FILE_H */
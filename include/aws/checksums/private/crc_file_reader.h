@@ -0,0 +1,86 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_FILE_READER_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_FILE_READER_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Asynchronous positional reads for aws_checksums_file_crc_stream() (source/crc_file.c, which owns the buffers
+ * and the order the data is checksummed in). The reader is platform code: source/posix runs the reads on io_uring
+ * (source/linux) when it can and on a pread thread pool otherwise; source/windows doesn't implement it yet.
+ */
+
+struct aws_allocator;
+struct aws_checksums_file_reader;
+
+/* buffer, offset and length alignment O_DIRECT reads need */
+#define AWS_CHECKSUMS_DIRECT_IO_ALIGNMENT 4096
+
+struct aws_checksums_read {
+    uint8_t *buffer;
+    uint64_t offset;
+    size_t length;
+    /* set on completion: bytes read (0 past the end of the file), or a negated errno */
+    int64_t result;
+    /* owned by the reader while the read is in flight */
+    struct aws_checksums_read *next;
+};
+
+struct aws_checksums_file_reader_options {
+    /* most reads submitted and not yet waited for */
+    size_t queue_depth;
+    bool direct_io;
+    bool io_uring;
+};
+
+/* what the reader ended up using, each option falls back silently when the file or platform doesn't support it */
+struct aws_checksums_file_reader_info {
+    uint64_t size;
+    bool direct_io;
+    bool io_uring;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Opens path (a regular file or a block device). Raises AWS_ERROR_UNSUPPORTED_OPERATION for files without a size
+ * (pipes, sockets) and on platforms without a reader.
+ */
+struct aws_checksums_file_reader *aws_checksums_file_reader_new(
+    struct aws_allocator *allocator,
+    const char *path,
+    const struct aws_checksums_file_reader_options *options,
+    struct aws_checksums_file_reader_info *info);
+
+/* Starts read. It must stay alive, untouched, until wait returns it. */
+int aws_checksums_file_reader_submit(struct aws_checksums_file_reader *reader, struct aws_checksums_read *read);
+
+/* Blocks until a submitted read completes, in any order, and returns it in completed. */
+int aws_checksums_file_reader_wait(struct aws_checksums_file_reader *reader, struct aws_checksums_read **completed);
+
+/* Closes the file. Every submitted read must have been waited for. */
+void aws_checksums_file_reader_destroy(struct aws_checksums_file_reader *reader);
+
+#if defined(AWS_CHECKSUMS_HAVE_IO_URING)
+/* io_uring backend of the posix reader, source/linux */
+struct aws_checksums_uring;
+
+/* NULL (without raising) when the kernel has no io_uring, it is blocked, or it can't do IORING_OP_READ */
+struct aws_checksums_uring *aws_checksums_uring_new(struct aws_allocator *allocator, int fd, size_t queue_depth);
+int aws_checksums_uring_submit(struct aws_checksums_uring *ring, struct aws_checksums_read *read);
+int aws_checksums_uring_wait(struct aws_checksums_uring *ring, struct aws_checksums_read **completed);
+void aws_checksums_uring_destroy(struct aws_checksums_uring *ring);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_FILE_READER_H */
@@ -0,0 +1,64 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_FOLD_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_FOLD_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Interface between the portable half of the carry-less multiply folding kernel (source/crc_fold.c: constants,
+ * dispatch, finishing the crc) and the per-ISA fold functions in source/intel/intrin, which are built with their own
+ * instruction set flags.
+ *
+ * The fold functions work on any reflected crc32 polynomial. The input crc is xor-ed into the first 4 bytes, and
+ * every 16 byte block is then folded forward onto the blocks after it, which keeps the value of the whole input mod p.
+ * What is left is one 16 byte block, written to remainder, that has the same non-inverted crc (starting from 0) as
+ * the consumed input had starting from crc. The return value is the number of bytes consumed, always a multiple of
+ * 16; the caller runs the remainder and then the unconsumed tail through a byte-wise kernel.
+ */
+
+/*
+ * Folding a 128 bit block forward by d bits multiplies its low qword by x^(d + 63) mod p and its high qword by
+ * x^(d - 1) mod p (the extra x^-1 absorbs the shift a reflected carry-less multiply introduces). Each pair holds the
+ * two remainders in the high dword of its qwords, ready to be loaded as one 128 bit operand.
+ */
+struct aws_checksums_fold_constants {
+    uint64_t fold_128[2];
+    uint64_t fold_256[2];
+    uint64_t fold_384[2];
+    uint64_t fold_512[2];
+    uint64_t fold_2048[2];
+};
+
+/* shortest input the fold functions accept */
+#define AWS_CHECKSUMS_FOLD_CLMUL_MIN_LENGTH 64
+#define AWS_CHECKSUMS_FOLD_AVX512_MIN_LENGTH 256
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* PCLMULQDQ, four 128 bit accumulators. length must be at least AWS_CHECKSUMS_FOLD_CLMUL_MIN_LENGTH. */
+size_t aws_checksums_crc_fold_clmul(
+    const uint8_t *input,
+    size_t length,
+    uint32_t crc,
+    const struct aws_checksums_fold_constants *constants,
+    uint8_t remainder[16]);
+
+/* AVX-512 VPCLMULQDQ, four 512 bit accumulators. length must be at least AWS_CHECKSUMS_FOLD_AVX512_MIN_LENGTH. */
+size_t aws_checksums_crc_fold_avx512(
+    const uint8_t *input,
+    size_t length,
+    uint32_t crc,
+    const struct aws_checksums_fold_constants *constants,
+    uint8_t remainder[16]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_FOLD_H */
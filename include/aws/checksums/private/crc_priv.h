@@ -8,6 +8,9 @@
 #define AWS_CRC32_SIZE_BYTES 4
 
 #include <aws/checksums/exports.h>
+
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -26,6 +29,68 @@ AWS_CHECKSUMS_API uint32_t aws_checksums_crc32c_hw(const uint8_t *data, int leng
 /* Computes CRC32 (Ethernet, gzip, et. al.) using crc instructions. */
 AWS_CHECKSUMS_API uint32_t aws_checksums_crc32_hw(const uint8_t *data, int length, uint32_t previousCrc32);
 
+/* aws_checksums_crc32c_hash_keys() one key at a time with the reference implementation. */
+AWS_CHECKSUMS_API void aws_checksums_crc32c_hash_keys_sw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes);
+
+/* aws_checksums_crc32c_hash_keys() with crc instructions, running independent keys side by side. */
+AWS_CHECKSUMS_API void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes);
+
+/* crcs[i] = aws_checksums_crc32c_sw(buffers[i], lengths[i], 0), one buffer at a time. */
+AWS_CHECKSUMS_API void aws_checksums_crc32c_multi_sw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs);
+
+/* aws_checksums_crc32c_multi_sw() with crc instructions, running independent buffers side by side. */
+AWS_CHECKSUMS_API void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs);
+
+/* True if the pshufb kernels below are compiled in and the cpu has SSSE3. */
+AWS_CHECKSUMS_API bool aws_checksums_pshufb_is_available(void);
+
+/* Computes CRC32 (Ethernet, gzip, et. al.) with SSSE3/AVX2 pshufb nibble tables, or the reference implementation
+ * where that isn't available. */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32_pshufb(const uint8_t *input, int length, uint32_t previousCrc32);
+
+/* Computes the Castagnoli CRC32c (iSCSI) with SSSE3/AVX2 pshufb nibble tables, or the reference implementation
+ * where that isn't available. */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32c_pshufb(const uint8_t *input, int length, uint32_t previousCrc32);
+
+/* True if the carry-less multiply folding kernels below are compiled in and the cpu has PCLMULQDQ. */
+AWS_CHECKSUMS_API bool aws_checksums_clmul_fold_is_available(void);
+
+/* True if the folding kernels below are compiled in with their AVX-512 tier and the cpu has AVX-512 VPCLMULQDQ. */
+AWS_CHECKSUMS_API bool aws_checksums_avx512_fold_is_available(void);
+
+/* Computes CRC32 (Ethernet, gzip, et. al.) by folding with PCLMULQDQ or AVX-512 VPCLMULQDQ, or the reference
+ * implementation where that isn't available. */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32_clmul(const uint8_t *input, int length, uint32_t previousCrc32);
+
+/*
+ * crc32c inputs shorter than this go straight to the crc32 instruction kernel where the cpu has one: folding them
+ * still runs a 16 byte remainder and the tail through that kernel, which costs more than it saves.
+ */
+#define AWS_CHECKSUMS_CRC32C_HW_FOLD_MIN_LENGTH 256
+
+/* Computes the Castagnoli CRC32c (iSCSI) by folding with PCLMULQDQ or AVX-512 VPCLMULQDQ, or the reference
+ * implementation where that isn't available. Where the cpu has SSE4.2, inputs shorter than
+ * AWS_CHECKSUMS_CRC32C_HW_FOLD_MIN_LENGTH and the tail after the fold take aws_checksums_crc32c_hw() instead. */
+AWS_CHECKSUMS_API uint32_t aws_checksums_crc32c_clmul(const uint8_t *input, int length, uint32_t previousCrc32);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,61 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_PROBES_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_PROBES_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/*
+ * USDT static probes, compiled in with -DAWS_CHECKSUMS_USE_SDT=ON (requires sys/sdt.h). Each probe is a single nop
+ * until a tracer attaches, e.g.:
+ *
+ *   bpftrace -e 'usdt:/usr/lib/libaws-checksums.so:aws_checksums:crc_entry { @start[tid] = nsecs; }
+ *                usdt:/usr/lib/libaws-checksums.so:aws_checksums:crc_return /@start[tid]/ {
+ *                    @ns[arg0] = hist(nsecs - @start[tid]); delete(@start[tid]); }'
+ *
+ * Provider aws_checksums:
+ *   crc_entry(algorithm, length, alignment, kernel)  on entry to aws_checksums_crc32() / aws_checksums_crc32c();
+ *       algorithm is enum aws_checksums_crc_algorithm, alignment is the input address modulo 64 and kernel is the
+ *       enum aws_checksums_kernel tier the call is dispatched to.
+ *   crc_return(algorithm, length, crc)               when those entry points return.
+ *   kernel_tier(algorithm, tier, bytes)              when a kernel hands bytes to one of its inner loops; tier is
+ *       enum aws_checksums_probe_tier. Fires once per tier per call, not per block.
+ */
+
+#include <aws/checksums/crc.h>
+
+enum aws_checksums_probe_tier {
+    /* byte at a time (alignment preamble, tail) */
+    AWS_CHECKSUMS_PROBE_TIER_BYTE,
+    /* one 8-byte crc instruction at a time */
+    AWS_CHECKSUMS_PROBE_TIER_QWORD,
+    /* unrolled 64-byte blocks of crc instructions */
+    AWS_CHECKSUMS_PROBE_TIER_BLOCK_64,
+    /* 3 interleaved crc32q stripes folded with pclmulqdq, by block size */
+    AWS_CHECKSUMS_PROBE_TIER_CLMUL_256,
+    AWS_CHECKSUMS_PROBE_TIER_CLMUL_1024,
+    AWS_CHECKSUMS_PROBE_TIER_CLMUL_3072,
+};
+
+#ifdef AWS_CHECKSUMS_USE_SDT
+#    include <stdint.h>
+#    include <sys/sdt.h>
+
+#    define AWS_CHECKSUMS_PROBE_CRC_ENTRY(algorithm, input, length, kernel)                                            \
+        DTRACE_PROBE4(aws_checksums, crc_entry, (int)(algorithm), (length), ((uintptr_t)(input)) & 63, (int)(kernel))
+#    define AWS_CHECKSUMS_PROBE_CRC_RETURN(algorithm, length, crc)                                                     \
+        DTRACE_PROBE3(aws_checksums, crc_return, (int)(algorithm), (length), (crc))
+#    define AWS_CHECKSUMS_PROBE_KERNEL_TIER(algorithm, tier, bytes)                                                    \
+        do {                                                                                                           \
+            if (bytes) {                                                                                               \
+                DTRACE_PROBE3(aws_checksums, kernel_tier, (int)(algorithm), (int)(tier), (bytes));                     \
+            }                                                                                                          \
+        } while (0)
+#else
+/* compiled out: arguments are not evaluated */
+#    define AWS_CHECKSUMS_PROBE_CRC_ENTRY(algorithm, input, length, kernel) ((void)0)
+#    define AWS_CHECKSUMS_PROBE_CRC_RETURN(algorithm, length, crc) ((void)0)
+#    define AWS_CHECKSUMS_PROBE_KERNEL_TIER(algorithm, tier, bytes) ((void)0)
+#endif /* AWS_CHECKSUMS_USE_SDT */
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_PROBES_H */
@@ -0,0 +1,48 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_PSHUFB_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_PSHUFB_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <stdint.h>
+
+/*
+ * Interface between the portable half of the pshufb kernel (source/crc_pshufb.c: tables, dispatch, merging lanes)
+ * and the per-ISA block functions in source/intel/intrin, which are built with their own instruction set flags.
+ *
+ * A block is AWS_CHECKSUMS_PSHUFB_LANE_BYTES of input for each of 16 (SSSE3) or 32 (AVX2) lanes, lane i starting
+ * at input + i * AWS_CHECKSUMS_PSHUFB_LANE_BYTES. Every lane runs an independent, non-inverted crc: lane_crcs holds
+ * the starting register of each lane on entry and its final register on return.
+ */
+#define AWS_CHECKSUMS_PSHUFB_LANE_BYTES 256
+
+/*
+ * The byte-wise crc table split into nibbles and byte planes so that pshufb can do 16 lookups at once: lo[j][n] is
+ * byte j of T[n] and hi[j][n] is byte j of T[n << 4], where T is the usual 256 entry table. T is linear, so
+ * T[i] = T[i & 0xf] ^ T[i & 0xf0].
+ */
+struct aws_checksums_nibble_tables {
+    uint8_t lo[4][16];
+    uint8_t hi[4][16];
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void aws_checksums_crc_pshufb_ssse3_block(
+    const uint8_t *input,
+    uint32_t lane_crcs[16],
+    const struct aws_checksums_nibble_tables *tables);
+
+void aws_checksums_crc_pshufb_avx2_block(
+    const uint8_t *input,
+    uint32_t lane_crcs[32],
+    const struct aws_checksums_nibble_tables *tables);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_PSHUFB_H */
@@ -0,0 +1,29 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_STATS_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_STATS_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/stats.h>
+
+#ifdef AWS_CHECKSUMS_ENABLE_STATS
+
+#    ifdef __cplusplus
+extern "C" {
+#    endif
+
+/* Bumps the calling thread's counters for one call. */
+void aws_checksums_stats_record(enum aws_checksums_crc_algorithm algorithm, enum aws_checksums_kernel kernel, int length);
+
+#    ifdef __cplusplus
+}
+#    endif
+
+#    define AWS_CHECKSUMS_STATS_RECORD(algorithm, kernel, length) aws_checksums_stats_record(algorithm, kernel, length)
+#else
+/* compiled out: no call, no thread local lookup, no branch */
+#    define AWS_CHECKSUMS_STATS_RECORD(algorithm, kernel, length) ((void)0)
+#endif /* AWS_CHECKSUMS_ENABLE_STATS */
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_STATS_H */
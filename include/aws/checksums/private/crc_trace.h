@@ -0,0 +1,28 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_TRACE_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_TRACE_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/trace.h>
+
+#ifdef AWS_CHECKSUMS_ENABLE_TRACE
+
+#    ifdef __cplusplus
+extern "C" {
+#    endif
+
+/* Appends a record for one call if a trace is running. */
+void aws_checksums_trace_record_call(enum aws_checksums_crc_algorithm algorithm, const uint8_t *input, int length);
+
+#    ifdef __cplusplus
+}
+#    endif
+
+#    define AWS_CHECKSUMS_TRACE_CALL(algorithm, input, length) aws_checksums_trace_record_call(algorithm, input, length)
+#else
+#    define AWS_CHECKSUMS_TRACE_CALL(algorithm, input, length) ((void)0)
+#endif /* AWS_CHECKSUMS_ENABLE_TRACE */
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_TRACE_H */
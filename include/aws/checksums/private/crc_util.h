@@ -0,0 +1,59 @@
+#ifndef AWS_CHECKSUMS_PRIVATE_CRC_UTIL_H
+#define AWS_CHECKSUMS_PRIVATE_CRC_UTIL_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* The Ethernet, gzip, et.al CRC32 polynomial (reverse of 0x04C11DB7) */
+#define CRC32_POLYNOMIAL 0xEDB88320
+
+/* The Castagnoli, iSCSI CRC32c polynomial (reverse of 0x1EDC6F41) */
+#define CRC32C_POLYNOMIAL 0x82F63B78
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * GF(2) polynomial arithmetic modulo a crc polynomial, in the reflected bit order the crcs themselves use: the top
+ * bit holds the x^0 coefficient and poly is the reversed generator polynomial (e.g. CRC32_POLYNOMIAL). These are
+ * bit-serial and meant for table generation and combining crcs, not for per-byte work.
+ */
+
+/* Returns a * b modulo poly. */
+uint32_t aws_checksums_multmodp(uint32_t a, uint32_t b, uint32_t poly);
+
+/* Returns x^n modulo poly. Multiplying a crc by x^(8 * len) shifts it over len zero bytes. */
+uint32_t aws_checksums_x2nmodp(uint64_t n, uint32_t poly);
+
+/* A crc kernel: the crc of length bytes at input, carrying on from previous_crc (0 to start). */
+typedef uint32_t(aws_checksums_crc_fn)(const uint8_t *input, int length, uint32_t previous_crc);
+
+/*
+ * Looks up the public entry point and reversed polynomial of algorithm, aws_checksums_crc32() and CRC32_POLYNOMIAL
+ * or aws_checksums_crc32c() and CRC32C_POLYNOMIAL. out_poly may be NULL. Raises AWS_ERROR_INVALID_ARGUMENT for an
+ * unknown algorithm.
+ */
+int aws_checksums_crc_select(
+    enum aws_checksums_crc_algorithm algorithm,
+    aws_checksums_crc_fn **out_crc,
+    uint32_t *out_poly);
+
+/* Runs length bytes at input through crc, carrying on from previous_crc, in calls of at most INT_MAX bytes. */
+uint32_t aws_checksums_crc_update(
+    aws_checksums_crc_fn *crc,
+    const uint8_t *input,
+    size_t length,
+    uint32_t previous_crc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_CHECKSUMS_PRIVATE_CRC_UTIL_H */
@@ -0,0 +1,98 @@
+#ifndef AWS_CHECKSUMS_ROLLING_H
+#define AWS_CHECKSUMS_ROLLING_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <stdbool.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+struct aws_allocator;
+
+/*
+ * Rolling crc: the crc of the last window_size bytes of a stream, updated in O(1) per byte. Sliding one byte is a
+ * table step for the byte coming in and a table lookup for the byte leaving the window (its contribution shifted over
+ * window_size bytes, precomputed per instance), so the window crc can drive content-defined chunking directly and the
+ * chunks get their crcs in the same scan instead of a separate rolling hash followed by a second pass.
+ */
+struct aws_checksums_rolling_crc;
+
+struct aws_checksums_rolling_crc_options {
+    enum aws_checksums_crc_algorithm algorithm;
+    /* bytes in the window, at least 1 */
+    uint32_t window_size;
+    /* a chunk ends after a byte where (window crc & boundary_mask) == 0; e.g. 0x1FFF for ~8 KiB average chunks */
+    uint32_t boundary_mask;
+    /* no boundary is taken before a chunk has this many bytes */
+    uint64_t min_chunk_size;
+    /* a chunk is cut at this many bytes if no boundary came up, 0 for no limit */
+    uint64_t max_chunk_size;
+};
+
+/* one chunk of the stream: where it starts, its length and its crc (from 0, same as aws_checksums_crc32c() etc.) */
+struct aws_checksums_chunk {
+    uint64_t offset;
+    uint64_t length;
+    uint32_t crc;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Creates a rolling crc, its window initially holding window_size zero bytes. Returns NULL and raises
+ * AWS_ERROR_INVALID_ARGUMENT for an unknown algorithm, a window_size of 0, or max_chunk_size below min_chunk_size.
+ */
+AWS_CHECKSUMS_API struct aws_checksums_rolling_crc *aws_checksums_rolling_crc_new(
+    struct aws_allocator *allocator,
+    const struct aws_checksums_rolling_crc_options *options);
+
+AWS_CHECKSUMS_API void aws_checksums_rolling_crc_destroy(struct aws_checksums_rolling_crc *rolling);
+
+/**
+ * Starts a new stream: zero window, no bytes seen, no chunk in progress.
+ */
+AWS_CHECKSUMS_API void aws_checksums_rolling_crc_reset(struct aws_checksums_rolling_crc *rolling);
+
+/**
+ * Slides the window over length bytes and returns the crc of the window afterwards: once at least window_size bytes
+ * went through, aws_checksums_crc32() / aws_checksums_crc32c() of the last window_size of them. Chunking state isn't
+ * advanced, use either this or aws_checksums_rolling_crc_find_chunks() on a stream.
+ */
+AWS_CHECKSUMS_API uint32_t aws_checksums_rolling_crc_update(
+    struct aws_checksums_rolling_crc *rolling,
+    const uint8_t *input,
+    size_t length);
+
+/**
+ * Slides the window over the next bytes of the stream and records every chunk that ends in them, with its crc, in
+ * chunks, up to chunk_capacity of them. Stops after the byte that completes the last chunk there is room for and
+ * returns how many bytes of input it consumed (length unless chunks filled up); feed the rest in the next call.
+ * out_chunk_count receives the number of chunks recorded.
+ *
+ * Each chunk crc is computed with the regular kernels over the chunk's bytes while they are still in cache, and
+ * carried across calls when a chunk spans several.
+ */
+AWS_CHECKSUMS_API size_t aws_checksums_rolling_crc_find_chunks(
+    struct aws_checksums_rolling_crc *rolling,
+    const uint8_t *input,
+    size_t length,
+    struct aws_checksums_chunk *chunks,
+    size_t chunk_capacity,
+    size_t *out_chunk_count);
+
+/**
+ * Ends the stream: if bytes after the last boundary are pending, stores them as the final chunk in out_chunk and
+ * returns true, otherwise returns false. The rolling crc is then reset, see aws_checksums_rolling_crc_reset().
+ */
+AWS_CHECKSUMS_API bool aws_checksums_rolling_crc_finish(
+    struct aws_checksums_rolling_crc *rolling,
+    struct aws_checksums_chunk *out_chunk);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_ROLLING_H */
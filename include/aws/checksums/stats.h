@@ -0,0 +1,64 @@
+#ifndef AWS_CHECKSUMS_STATS_H
+#define AWS_CHECKSUMS_STATS_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+/**
+ * The kernel tier that served a call to aws_checksums_crc32() or aws_checksums_crc32c().
+ */
+enum aws_checksums_kernel {
+    /* table driven software implementation */
+    AWS_CHECKSUMS_KERNEL_SW,
+    /* crc instructions (SSE4.2 crc32, ARMv8 crc32) */
+    AWS_CHECKSUMS_KERNEL_HW,
+    /* SSSE3/AVX2 pshufb nibble tables, x86 without crc instructions */
+    AWS_CHECKSUMS_KERNEL_PSHUFB,
+    /* PCLMULQDQ / AVX-512 VPCLMULQDQ folding, x86 crc32 */
+    AWS_CHECKSUMS_KERNEL_CLMUL,
+    AWS_CHECKSUMS_KERNEL_COUNT,
+};
+
+/**
+ * Size class k counts calls with a length in [2^(k-1), 2^k); class 0 counts zero length calls.
+ */
+#define AWS_CHECKSUMS_STATS_SIZE_CLASSES 33
+
+struct aws_checksums_kernel_stats {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t size_class_calls[AWS_CHECKSUMS_STATS_SIZE_CLASSES];
+};
+
+/**
+ * Counters aggregated over every thread that has called into the library, indexed by
+ * [enum aws_checksums_crc_algorithm][enum aws_checksums_kernel].
+ */
+struct aws_checksums_stats {
+    struct aws_checksums_kernel_stats kernels[AWS_CHECKSUMS_CRC_ALGORITHM_COUNT][AWS_CHECKSUMS_KERNEL_COUNT];
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Sums the per-thread counters into out. Counters only cover the aws_checksums_crc32() and aws_checksums_crc32c()
+ * entry points and are only collected when the library is built with AWS_CHECKSUMS_ENABLE_STATS; otherwise this
+ * raises AWS_ERROR_UNSUPPORTED_OPERATION. Threads update their counters without synchronization, so a snapshot taken
+ * while other threads are checksumming may be a few calls behind.
+ */
+AWS_CHECKSUMS_API int aws_checksums_stats_snapshot(struct aws_checksums_stats *out);
+
+/**
+ * Returns a printable name for the kernel tier.
+ */
+AWS_CHECKSUMS_API const char *aws_checksums_kernel_name(enum aws_checksums_kernel kernel);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_STATS_H */
@@ -0,0 +1,81 @@
+#ifndef AWS_CHECKSUMS_TRACE_H
+#define AWS_CHECKSUMS_TRACE_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+
+#include <aws/common/byte_buf.h>
+
+AWS_PUSH_SANE_WARNING_LEVEL
+
+/*
+ * Call trace format. A trace is a header followed by back to back records:
+ *
+ *   header: the 4 bytes "ACKT", then a version byte (1)
+ *   record: 1 byte  (algorithm << 6) | (input address % 64)
+ *           varint  length in bytes
+ *           varint  nanoseconds since the previous record (since trace start for the first one)
+ *
+ * Varints are unsigned LEB128 (7 bits per byte, least significant group first), so a typical small call costs
+ * 3-5 bytes of trace.
+ */
+#define AWS_CHECKSUMS_TRACE_VERSION 1
+#define AWS_CHECKSUMS_TRACE_HEADER_SIZE 5
+#define AWS_CHECKSUMS_TRACE_RECORD_MAX_SIZE (1 + 5 + 10)
+
+struct aws_checksums_trace_record {
+    enum aws_checksums_crc_algorithm algorithm;
+    /* input address modulo 64 */
+    uint8_t alignment;
+    uint32_t length;
+    uint64_t inter_arrival_ns;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Starts recording every aws_checksums_crc32() / aws_checksums_crc32c() call to the file at path (truncating it).
+ * Recording is only compiled in with AWS_CHECKSUMS_ENABLE_TRACE; otherwise this raises
+ * AWS_ERROR_UNSUPPORTED_OPERATION. Calls are serialized through a lock while a trace is running.
+ */
+AWS_CHECKSUMS_API int aws_checksums_trace_start(const char *path);
+
+/**
+ * Stops recording, flushes and closes the trace file.
+ */
+AWS_CHECKSUMS_API int aws_checksums_trace_stop(void);
+
+/**
+ * Writes the trace header into output. Raises AWS_ERROR_SHORT_BUFFER if there is not enough room.
+ */
+AWS_CHECKSUMS_API int aws_checksums_trace_encode_header(struct aws_byte_buf *output);
+
+/**
+ * Appends one encoded record to output. Raises AWS_ERROR_SHORT_BUFFER if there is not enough room; reserving
+ * AWS_CHECKSUMS_TRACE_RECORD_MAX_SIZE bytes is always enough.
+ */
+AWS_CHECKSUMS_API int aws_checksums_trace_encode_record(
+    const struct aws_checksums_trace_record *record,
+    struct aws_byte_buf *output);
+
+/**
+ * Consumes and validates the trace header. Raises AWS_ERROR_INVALID_ARGUMENT if this isn't a trace, or a version
+ * this library can't read.
+ */
+AWS_CHECKSUMS_API int aws_checksums_trace_decode_header(struct aws_byte_cursor *input);
+
+/**
+ * Consumes one record from input. Raises AWS_ERROR_SHORT_BUFFER on a truncated record and
+ * AWS_ERROR_INVALID_ARGUMENT on a malformed one; input is left untouched on failure.
+ */
+AWS_CHECKSUMS_API int aws_checksums_trace_decode_record(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_trace_record *record);
+
+AWS_EXTERN_C_END
+AWS_POP_SANE_WARNING_LEVEL
+
+#endif /* AWS_CHECKSUMS_TRACE_H */
@@ -6,6 +6,7 @@
 /* No instrics defined for 32-bit MSVC */
 #if (defined(_M_ARM64) || defined(__aarch64__) || defined(__arm__))
 #    include <aws/checksums/private/crc_priv.h>
+#    include <aws/checksums/private/crc_probes.h>
 #    ifdef _M_ARM64
 #        include <arm64_neon.h>
 #        define PREFETCH(p) __prefetch(p)
@@ -24,6 +25,7 @@ uint32_t aws_checksums_crc32c_hw(const uint8_t *data, int length, uint32_t previ
         length--;
     }
 
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_BLOCK_64, length & ~63);
     while (length >= 64) {
         PREFETCH(data + 384);
         uint64_t *d = (uint64_t *)data;
@@ -39,12 +41,14 @@ uint32_t aws_checksums_crc32c_hw(const uint8_t *data, int length, uint32_t previ
         length -= 64;
     }
 
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_QWORD, length & ~7);
     while (length >= 8) {
         crc = __crc32cd(crc, *(uint64_t *)data);
         data += 8;
         length -= 8;
     }
 
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_BYTE, length);
     while (length > 0) {
         crc = __crc32cb(crc, *(uint8_t *)data);
         data++;
@@ -64,6 +68,7 @@ uint32_t aws_checksums_crc32_hw(const uint8_t *data, int length, uint32_t previo
         length--;
     }
 
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32, AWS_CHECKSUMS_PROBE_TIER_BLOCK_64, length & ~63);
     while (length >= 64) {
         PREFETCH(data + 384);
         uint64_t *d = (uint64_t *)data;
@@ -79,12 +84,14 @@ uint32_t aws_checksums_crc32_hw(const uint8_t *data, int length, uint32_t previo
         length -= 64;
     }
 
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32, AWS_CHECKSUMS_PROBE_TIER_QWORD, length & ~7);
     while (length >= 8) {
         crc = __crc32d(crc, *(uint64_t *)data);
         data += 8;
         length -= 8;
     }
 
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32, AWS_CHECKSUMS_PROBE_TIER_BYTE, length);
     while (length > 0) {
         crc = __crc32b(crc, *(uint8_t *)data);
         data++;
@@ -94,4 +101,27 @@ uint32_t aws_checksums_crc32_hw(const uint8_t *data, int length, uint32_t previo
     return ~crc;
 }
 
+#    define AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc, word) __crc32cd((crc), (word))
+#    define AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc, byte) __crc32cb((crc), (byte))
+#    include <aws/checksums/private/crc32c_lanes.h>
+
+void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+
+    aws_checksums_crc32c_lanes_hash_keys(keys, key_size, count, seed, hashes);
+}
+
+void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+
+    aws_checksums_crc32c_lanes_multi(buffers, lengths, count, crcs);
+}
+
 #endif
@@ -4,30 +4,331 @@
  */
 #include <aws/checksums/crc.h>
 #include <aws/checksums/private/crc_priv.h>
+#include <aws/checksums/private/crc_probes.h>
+#include <aws/checksums/private/crc_stats.h>
+#include <aws/checksums/private/crc_trace.h>
+#include <aws/checksums/private/crc_util.h>
 
 #include <aws/common/cpuid.h>
 
+#ifdef AWS_CHECKSUMS_FIXED_ISA
+
+/*
+ * Fixed ISA build: the library is compiled for one instruction set (see AWS_CHECKSUMS_FIXED_ISA in CMakeLists.txt),
+ * so the kernels are bound here at compile time from the compiler's target macros. The entry points call them
+ * directly, without function pointers or cpu feature probes.
+ */
+#    if defined(__ARM_FEATURE_CRC32)
+#        define CRC32_KERNEL AWS_CHECKSUMS_KERNEL_HW
+#        define CRC32_FN aws_checksums_crc32_hw
+#    elif defined(AWS_CHECKSUMS_HAVE_CLMUL_FOLD) && defined(__PCLMUL__) && defined(__SSE4_1__)
+#        define CRC32_KERNEL AWS_CHECKSUMS_KERNEL_CLMUL
+#        define CRC32_FN aws_checksums_crc32_clmul
+#    elif defined(AWS_CHECKSUMS_HAVE_PSHUFB) && defined(__SSSE3__)
+#        define CRC32_KERNEL AWS_CHECKSUMS_KERNEL_PSHUFB
+#        define CRC32_FN aws_checksums_crc32_pshufb
+#    else
+#        define CRC32_KERNEL AWS_CHECKSUMS_KERNEL_SW
+#        define CRC32_FN aws_checksums_crc32_sw
+#    endif
+
+#    if defined(__ARM_FEATURE_CRC32)
+#        define CRC32C_KERNEL AWS_CHECKSUMS_KERNEL_HW
+#        define CRC32C_FN aws_checksums_crc32c_hw
+#    elif defined(AWS_CHECKSUMS_HAVE_CLMUL_FOLD) && defined(AWS_CHECKSUMS_HAVE_AVX512_FOLD) &&                         \
+        defined(__AVX512F__) && defined(__AVX512VL__) && defined(__VPCLMULQDQ__)
+#        define CRC32C_KERNEL AWS_CHECKSUMS_KERNEL_CLMUL
+#        define CRC32C_FN aws_checksums_crc32c_clmul
+#    elif defined(__SSE4_2__)
+#        define CRC32C_KERNEL AWS_CHECKSUMS_KERNEL_HW
+#        define CRC32C_FN aws_checksums_crc32c_hw
+#    elif defined(AWS_CHECKSUMS_HAVE_CLMUL_FOLD) && defined(__PCLMUL__) && defined(__SSE4_1__)
+#        define CRC32C_KERNEL AWS_CHECKSUMS_KERNEL_CLMUL
+#        define CRC32C_FN aws_checksums_crc32c_clmul
+#    elif defined(AWS_CHECKSUMS_HAVE_PSHUFB) && defined(__SSSE3__)
+#        define CRC32C_KERNEL AWS_CHECKSUMS_KERNEL_PSHUFB
+#        define CRC32C_FN aws_checksums_crc32c_pshufb
+#    else
+#        define CRC32C_KERNEL AWS_CHECKSUMS_KERNEL_SW
+#        define CRC32C_FN aws_checksums_crc32c_sw
+#    endif
+
+/* the batch entry points run records side by side with the crc instructions whichever kernel single calls take */
+#    if defined(__ARM_FEATURE_CRC32) || defined(__SSE4_2__)
+#        define CRC32C_HAS_INSTRUCTIONS true
+#    else
+#        define CRC32C_HAS_INSTRUCTIONS false
+#    endif
+
+#else
+
 static uint32_t (*s_crc32c_fn_ptr)(const uint8_t *input, int length, uint32_t previousCrc32) = 0;
 static uint32_t (*s_crc32_fn_ptr)(const uint8_t *input, int length, uint32_t previousCrc32) = 0;
 
+/* the tier behind each function pointer, for the instrumentation and the crc32c short input check */
+static enum aws_checksums_kernel s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_SW;
+static enum aws_checksums_kernel s_crc32_kernel = AWS_CHECKSUMS_KERNEL_SW;
+/* whether the cpu has crc32c instructions, which the batch entry points use whichever kernel single calls take */
+static bool s_crc32c_has_instructions = false;
+
+#    define CRC32_KERNEL s_crc32_kernel
+#    define CRC32_FN s_crc32_fn_ptr
+#    define CRC32C_KERNEL s_crc32c_kernel
+#    define CRC32C_FN s_crc32c_fn_ptr
+#    define CRC32C_HAS_INSTRUCTIONS s_crc32c_has_instructions
+
+static void s_select_crc32_kernel(void) {
+    if (aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC)) {
+        s_crc32_kernel = AWS_CHECKSUMS_KERNEL_HW;
+        s_crc32_fn_ptr = aws_checksums_crc32_hw;
+    } else if (aws_checksums_clmul_fold_is_available()) {
+        /* there is no x86 crc32 (gzip) instruction, folding with carry-less multiplies is the fastest option */
+        s_crc32_kernel = AWS_CHECKSUMS_KERNEL_CLMUL;
+        s_crc32_fn_ptr = aws_checksums_crc32_clmul;
+    } else if (aws_checksums_pshufb_is_available()) {
+        s_crc32_kernel = AWS_CHECKSUMS_KERNEL_PSHUFB;
+        s_crc32_fn_ptr = aws_checksums_crc32_pshufb;
+    } else {
+        s_crc32_kernel = AWS_CHECKSUMS_KERNEL_SW;
+        s_crc32_fn_ptr = aws_checksums_crc32_sw;
+    }
+}
+
+static void s_select_crc32c_kernel(void) {
+    s_crc32c_has_instructions =
+        aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC) || aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2);
+    if (aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC)) {
+        s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_HW;
+        s_crc32c_fn_ptr = aws_checksums_crc32c_hw;
+    } else if (aws_checksums_avx512_fold_is_available()) {
+        /*
+         * the AVX-512 fold runs about three times as fast as the SSE4.2 crc32 instruction kernel on long inputs, and
+         * hands short inputs and its tail to that kernel; the 128 bit fold doesn't beat the instruction kernel
+         */
+        s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_CLMUL;
+        s_crc32c_fn_ptr = aws_checksums_crc32c_clmul;
+    } else if (aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2)) {
+        s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_HW;
+        s_crc32c_fn_ptr = aws_checksums_crc32c_hw;
+    } else if (aws_checksums_clmul_fold_is_available()) {
+        s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_CLMUL;
+        s_crc32c_fn_ptr = aws_checksums_crc32c_clmul;
+    } else if (aws_checksums_pshufb_is_available()) {
+        s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_PSHUFB;
+        s_crc32c_fn_ptr = aws_checksums_crc32c_pshufb;
+    } else {
+        s_crc32c_kernel = AWS_CHECKSUMS_KERNEL_SW;
+        s_crc32c_fn_ptr = aws_checksums_crc32c_sw;
+    }
+}
+
+#endif /* AWS_CHECKSUMS_FIXED_ISA */
+
 uint32_t aws_checksums_crc32(const uint8_t *input, int length, uint32_t previousCrc32) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
     if (AWS_UNLIKELY(!s_crc32_fn_ptr)) {
-        if (aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC)) {
-            s_crc32_fn_ptr = aws_checksums_crc32_hw;
-        } else {
-            s_crc32_fn_ptr = aws_checksums_crc32_sw;
-        }
+        s_select_crc32_kernel();
     }
-    return s_crc32_fn_ptr(input, length, previousCrc32);
+#endif
+    AWS_CHECKSUMS_TRACE_CALL(AWS_CHECKSUMS_CRC32, input, length);
+    AWS_CHECKSUMS_STATS_RECORD(AWS_CHECKSUMS_CRC32, CRC32_KERNEL, length);
+    AWS_CHECKSUMS_PROBE_CRC_ENTRY(AWS_CHECKSUMS_CRC32, input, length, CRC32_KERNEL);
+    uint32_t crc = CRC32_FN(input, length, previousCrc32);
+    AWS_CHECKSUMS_PROBE_CRC_RETURN(AWS_CHECKSUMS_CRC32, length, crc);
+    return crc;
 }
 
 uint32_t aws_checksums_crc32c(const uint8_t *input, int length, uint32_t previousCrc32) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
+    if (AWS_UNLIKELY(!s_crc32c_fn_ptr)) {
+        s_select_crc32c_kernel();
+    }
+#endif
+    enum aws_checksums_kernel kernel = CRC32C_KERNEL;
+    uint32_t (*crc_fn)(const uint8_t *, int, uint32_t) = CRC32C_FN;
+    /* the fold would only pass short inputs on to the crc32 instruction kernel, skip the extra call */
+    if (kernel == AWS_CHECKSUMS_KERNEL_CLMUL && CRC32C_HAS_INSTRUCTIONS &&
+        length < AWS_CHECKSUMS_CRC32C_HW_FOLD_MIN_LENGTH) {
+        kernel = AWS_CHECKSUMS_KERNEL_HW;
+        crc_fn = aws_checksums_crc32c_hw;
+    }
+    AWS_CHECKSUMS_TRACE_CALL(AWS_CHECKSUMS_CRC32C, input, length);
+    AWS_CHECKSUMS_STATS_RECORD(AWS_CHECKSUMS_CRC32C, kernel, length);
+    AWS_CHECKSUMS_PROBE_CRC_ENTRY(AWS_CHECKSUMS_CRC32C, input, length, kernel);
+    uint32_t crc = crc_fn(input, length, previousCrc32);
+    AWS_CHECKSUMS_PROBE_CRC_RETURN(AWS_CHECKSUMS_CRC32C, length, crc);
+    return crc;
+}
+
+/* shifting crcA over lenB zero bytes is a multiplication by x^(8 * lenB), the inversions of the two crcs cancel */
+uint32_t aws_checksums_crc32_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB) {
+    return aws_checksums_multmodp(aws_checksums_x2nmodp(lenB << 3, CRC32_POLYNOMIAL), crcA, CRC32_POLYNOMIAL) ^ crcB;
+}
+
+uint32_t aws_checksums_crc32c_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB) {
+    return aws_checksums_multmodp(aws_checksums_x2nmodp(lenB << 3, CRC32C_POLYNOMIAL), crcA, CRC32C_POLYNOMIAL) ^ crcB;
+}
+
+/* bytes of the xor delta hashed per kernel call when patching */
+#define CRC_PATCH_CHUNK_SIZE 256
+
+/*
+ * The crc is affine over GF(2): crc(M ^ D) = crc(M) ^ crc(D) ^ crc(zeros), and crc(D) ^ crc(zeros) is the crc of D
+ * without the initial and final inversions. D is zero outside the n patched bytes, so that is the uninverted crc of
+ * the delta bytes, shifted over the total_len - offset - n bytes after them. The delta goes straight to the selected
+ * kernel: it isn't a checksum of caller data, so it stays out of the stats, trace and entry probes.
+ */
+static uint32_t s_crc_patch(
+    uint32_t (*crc_fn)(const uint8_t *, int, uint32_t),
+    uint32_t poly,
+    uint32_t old_crc,
+    uint64_t total_len,
+    uint64_t offset,
+    const uint8_t *old_bytes,
+    const uint8_t *new_bytes,
+    size_t n) {
+
+    AWS_PRECONDITION(offset <= total_len && n <= total_len - offset);
+
+    uint8_t delta[CRC_PATCH_CHUNK_SIZE];
+    /* running crc register of the delta, started from 0 and never inverted */
+    uint32_t delta_crc = 0;
+    size_t done = 0;
+    while (done < n) {
+        size_t chunk = n - done < sizeof(delta) ? n - done : sizeof(delta);
+        for (size_t i = 0; i < chunk; ++i) {
+            delta[i] = old_bytes[done + i] ^ new_bytes[done + i];
+        }
+        /* the kernels invert on entry and exit, pre- and post-inverting cancels both */
+        delta_crc = ~crc_fn(delta, (int)chunk, ~delta_crc);
+        done += chunk;
+    }
+
+    uint64_t trailing = total_len - offset - n;
+    return old_crc ^ aws_checksums_multmodp(aws_checksums_x2nmodp(trailing << 3, poly), delta_crc, poly);
+}
+
+uint32_t aws_checksums_crc32_patch(
+    uint32_t old_crc,
+    uint64_t total_len,
+    uint64_t offset,
+    const uint8_t *old_bytes,
+    const uint8_t *new_bytes,
+    size_t n) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
+    if (AWS_UNLIKELY(!s_crc32_fn_ptr)) {
+        s_select_crc32_kernel();
+    }
+#endif
+    return s_crc_patch(CRC32_FN, CRC32_POLYNOMIAL, old_crc, total_len, offset, old_bytes, new_bytes, n);
+}
+
+uint32_t aws_checksums_crc32c_patch(
+    uint32_t old_crc,
+    uint64_t total_len,
+    uint64_t offset,
+    const uint8_t *old_bytes,
+    const uint8_t *new_bytes,
+    size_t n) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
+    if (AWS_UNLIKELY(!s_crc32c_fn_ptr)) {
+        s_select_crc32c_kernel();
+    }
+#endif
+    return s_crc_patch(CRC32C_FN, CRC32C_POLYNOMIAL, old_crc, total_len, offset, old_bytes, new_bytes, n);
+}
+
+void aws_checksums_crc32c_hash_keys(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
     if (AWS_UNLIKELY(!s_crc32c_fn_ptr)) {
-        if (aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) || aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC)) {
-            s_crc32c_fn_ptr = aws_checksums_crc32c_hw;
-        } else {
-            s_crc32c_fn_ptr = aws_checksums_crc32c_sw;
+        s_select_crc32c_kernel();
+    }
+#endif
+    if (CRC32C_HAS_INSTRUCTIONS) {
+        aws_checksums_crc32c_hash_keys_hw(keys, key_size, count, seed, hashes);
+    } else {
+        /* the table and pshufb kernels have nothing to gain from batching keys this short */
+        aws_checksums_crc32c_hash_keys_sw(keys, key_size, count, seed, hashes);
+    }
+}
+
+/* records are checked this many at a time, their crcs staged on the stack; a multiple of 8, one bitmap byte each */
+#define VERIFY_BATCH 64
+
+typedef void(multi_crc_fn)(const uint8_t *const *buffers, const size_t *lengths, size_t count, uint32_t *crcs);
+
+/* one record after another through the kernel the entry point has selected */
+static void s_crc32_multi(const uint8_t *const *buffers, const size_t *lengths, size_t count, uint32_t *crcs) {
+    for (size_t i = 0; i < count; ++i) {
+        crcs[i] = aws_checksums_crc_update(CRC32_FN, buffers[i], lengths[i], 0);
+    }
+}
+
+static void s_crc32c_multi(const uint8_t *const *buffers, const size_t *lengths, size_t count, uint32_t *crcs) {
+    for (size_t i = 0; i < count; ++i) {
+        crcs[i] = aws_checksums_crc_update(CRC32C_FN, buffers[i], lengths[i], 0);
+    }
+}
+
+static size_t s_verify_batch(
+    multi_crc_fn *multi_crc,
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    const uint32_t *expected_crcs,
+    size_t count,
+    uint8_t *mismatch_bitmap) {
+
+    uint32_t crcs[VERIFY_BATCH];
+    size_t mismatches = 0;
+    for (size_t start = 0; start < count; start += VERIFY_BATCH) {
+        size_t batch = count - start < VERIFY_BATCH ? count - start : VERIFY_BATCH;
+        multi_crc(buffers + start, lengths + start, batch, crcs);
+
+        for (size_t byte = 0; byte * 8 < batch; ++byte) {
+            uint8_t bits = 0;
+            for (size_t bit = 0; bit < 8 && byte * 8 + bit < batch; ++bit) {
+                size_t i = byte * 8 + bit;
+                uint8_t mismatch = crcs[i] != expected_crcs[start + i];
+                bits |= (uint8_t)(mismatch << bit);
+                mismatches += mismatch;
+            }
+            mismatch_bitmap[start / 8 + byte] = bits;
         }
     }
-    return s_crc32c_fn_ptr(input, length, previousCrc32);
+    return mismatches;
+}
+
+size_t aws_checksums_crc32_verify_batch(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    const uint32_t *expected_crcs,
+    size_t count,
+    uint8_t *mismatch_bitmap) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
+    if (AWS_UNLIKELY(!s_crc32_fn_ptr)) {
+        s_select_crc32_kernel();
+    }
+#endif
+    return s_verify_batch(s_crc32_multi, buffers, lengths, expected_crcs, count, mismatch_bitmap);
+}
+
+size_t aws_checksums_crc32c_verify_batch(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    const uint32_t *expected_crcs,
+    size_t count,
+    uint8_t *mismatch_bitmap) {
+#ifndef AWS_CHECKSUMS_FIXED_ISA
+    if (AWS_UNLIKELY(!s_crc32c_fn_ptr)) {
+        s_select_crc32c_kernel();
+    }
+#endif
+    /* as for hash_keys, only the crc instructions gain from running records side by side */
+    multi_crc_fn *multi_crc = CRC32C_HAS_INSTRUCTIONS ? aws_checksums_crc32c_multi_hw : s_crc32c_multi;
+    return s_verify_batch(multi_crc, buffers, lengths, expected_crcs, count, mismatch_bitmap);
 }
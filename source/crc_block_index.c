@@ -0,0 +1,345 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/block_index.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/common.h>
+#include <aws/common/file.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+
+static const uint8_t s_index_magic[4] = {'A', 'C', 'K', 'I'};
+
+/* header bytes covered by the header's integrity crc */
+#define INDEX_HEADER_BODY_SIZE (AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE - 4)
+
+/* the file builder reads whole blocks, at least this many bytes at a time */
+#define INDEX_FILE_READ_SIZE (1024 * 1024)
+
+static void s_write_le32(uint8_t *out, uint32_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)(value >> 16);
+    out[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t s_read_le32(const uint8_t *in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+static uint64_t s_block_count(uint64_t object_length, uint32_t block_size) {
+    return object_length / block_size + (object_length % block_size != 0);
+}
+
+int aws_checksums_block_index_compute_size(uint64_t object_length, uint32_t block_size, size_t *out_size) {
+    if (block_size == 0 || block_size > INT_MAX) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    uint64_t block_count = s_block_count(object_length, block_size);
+    if (block_count > (SIZE_MAX - AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE) / 4) {
+        return aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+    }
+    *out_size = AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE + (size_t)block_count * 4;
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Fills the entries of an index one or more blocks at a time, in order, and merges the block crcs into the object
+ * crc. Every block but the last has the same length, so the shift of the object crc over a block is computed once.
+ */
+struct index_builder {
+    aws_checksums_crc_fn *crc;
+    uint32_t poly;
+    uint32_t block_size;
+    uint32_t block_shift;
+    uint32_t object_crc;
+    uint64_t length;
+    uint8_t *next_entry;
+};
+
+static void s_builder_init(
+    struct index_builder *builder,
+    aws_checksums_crc_fn *crc,
+    uint32_t poly,
+    uint32_t block_size,
+    uint8_t *entries) {
+
+    builder->crc = crc;
+    builder->poly = poly;
+    builder->block_size = block_size;
+    builder->block_shift = aws_checksums_x2nmodp((uint64_t)block_size << 3, poly);
+    builder->object_crc = 0;
+    builder->length = 0;
+    builder->next_entry = entries;
+}
+
+/* length is a multiple of block_size, except for the input's last call */
+static void s_builder_add(struct index_builder *builder, const uint8_t *data, size_t length) {
+    while (length) {
+        uint32_t block_length = length < builder->block_size ? (uint32_t)length : builder->block_size;
+        uint32_t block_crc = builder->crc(data, (int)block_length, 0);
+        uint32_t shift = block_length == builder->block_size
+                             ? builder->block_shift
+                             : aws_checksums_x2nmodp((uint64_t)block_length << 3, builder->poly);
+
+        builder->object_crc = aws_checksums_multmodp(shift, builder->object_crc, builder->poly) ^ block_crc;
+        builder->length += block_length;
+        s_write_le32(builder->next_entry, block_crc);
+        builder->next_entry += 4;
+        data += block_length;
+        length -= block_length;
+    }
+}
+
+static void s_write_header(
+    uint8_t *header,
+    enum aws_checksums_crc_algorithm algorithm,
+    uint32_t block_size,
+    uint32_t object_crc,
+    uint64_t object_length) {
+
+    memcpy(header, s_index_magic, sizeof(s_index_magic));
+    header[4] = AWS_CHECKSUMS_BLOCK_INDEX_VERSION;
+    header[5] = (uint8_t)algorithm;
+    header[6] = 0;
+    header[7] = 0;
+    s_write_le32(header + 8, block_size);
+    s_write_le32(header + 12, object_crc);
+    s_write_le32(header + 16, (uint32_t)object_length);
+    s_write_le32(header + 20, (uint32_t)(object_length >> 32));
+    s_write_le32(header + 24, 0);
+    s_write_le32(header + 28, aws_checksums_crc32c(header, INDEX_HEADER_BODY_SIZE, 0));
+}
+
+int aws_checksums_block_index_build(
+    enum aws_checksums_crc_algorithm algorithm,
+    const uint8_t *data,
+    size_t length,
+    uint32_t block_size,
+    struct aws_byte_buf *output) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    uint32_t poly = 0;
+    size_t index_size = 0;
+    if (aws_checksums_crc_select(algorithm, &crc, &poly) ||
+        aws_checksums_block_index_compute_size(length, block_size, &index_size)) {
+        return AWS_OP_ERR;
+    }
+    if (output->capacity - output->len < index_size) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    uint8_t *header = output->buffer + output->len;
+    struct index_builder builder;
+    s_builder_init(&builder, crc, poly, block_size, header + AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE);
+    s_builder_add(&builder, data, length);
+    s_write_header(header, algorithm, block_size, builder.object_crc, length);
+
+    output->len += index_size;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_block_index_build_file(
+    struct aws_allocator *allocator,
+    const char *path,
+    enum aws_checksums_crc_algorithm algorithm,
+    uint32_t block_size,
+    struct aws_byte_buf *out_index) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    uint32_t poly = 0;
+    if (!path || aws_checksums_crc_select(algorithm, &crc, &poly)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    FILE *file = aws_fopen(path, "rb");
+    if (!file) {
+        return AWS_OP_ERR;
+    }
+
+    int64_t file_length = 0;
+    size_t index_size = 0;
+    if (aws_file_get_length(file, &file_length) || file_length < 0) {
+        fclose(file);
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+    if (aws_checksums_block_index_compute_size((uint64_t)file_length, block_size, &index_size)) {
+        fclose(file);
+        return AWS_OP_ERR;
+    }
+
+    /* whole blocks per read, so only the file's last read can end inside a block */
+    size_t read_size = block_size >= INDEX_FILE_READ_SIZE ? block_size : INDEX_FILE_READ_SIZE / block_size * block_size;
+    uint8_t *buffer = aws_mem_acquire(allocator, read_size);
+    if (!buffer) {
+        fclose(file);
+        return AWS_OP_ERR;
+    }
+    if (aws_byte_buf_init(out_index, allocator, index_size)) {
+        aws_mem_release(allocator, buffer);
+        fclose(file);
+        return AWS_OP_ERR;
+    }
+
+    struct index_builder builder;
+    s_builder_init(&builder, crc, poly, block_size, out_index->buffer + AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE);
+
+    int result = AWS_OP_SUCCESS;
+    uint64_t remaining = (uint64_t)file_length;
+    while (remaining) {
+        size_t want = remaining < read_size ? (size_t)remaining : read_size;
+        size_t read = fread(buffer, 1, want, file);
+        if (read != want) {
+            result = ferror(file) ? aws_translate_and_raise_io_error(errno)
+                                  : aws_raise_error(AWS_ERROR_FILE_READ_FAILURE);
+            break;
+        }
+        s_builder_add(&builder, buffer, read);
+        remaining -= read;
+    }
+
+    aws_mem_release(allocator, buffer);
+    fclose(file);
+
+    if (result != AWS_OP_SUCCESS) {
+        aws_byte_buf_clean_up(out_index);
+        return AWS_OP_ERR;
+    }
+
+    s_write_header(out_index->buffer, algorithm, block_size, builder.object_crc, (uint64_t)file_length);
+    out_index->len = index_size;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_block_index_parse(struct aws_byte_cursor input, struct aws_checksums_block_index *out) {
+    if (input.len < AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    const uint8_t *header = input.ptr;
+    if (memcmp(header, s_index_magic, sizeof(s_index_magic)) || header[4] != AWS_CHECKSUMS_BLOCK_INDEX_VERSION ||
+        header[5] >= AWS_CHECKSUMS_CRC_ALGORITHM_COUNT || header[6] || header[7] || s_read_le32(header + 24) ||
+        s_read_le32(header + 28) != aws_checksums_crc32c(header, INDEX_HEADER_BODY_SIZE, 0)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    uint32_t block_size = s_read_le32(header + 8);
+    uint64_t object_length = (uint64_t)s_read_le32(header + 16) | (uint64_t)s_read_le32(header + 20) << 32;
+    size_t index_size = 0;
+    if (aws_checksums_block_index_compute_size(object_length, block_size, &index_size)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    if (input.len < index_size) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    out->algorithm = (enum aws_checksums_crc_algorithm)header[5];
+    out->block_size = block_size;
+    out->object_crc = s_read_le32(header + 12);
+    out->object_length = object_length;
+    out->block_count = s_block_count(object_length, block_size);
+    out->entries = header + AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE;
+    return AWS_OP_SUCCESS;
+}
+
+uint32_t aws_checksums_block_index_get_block_crc(const struct aws_checksums_block_index *index, uint64_t block_number) {
+    AWS_ASSERT(block_number < index->block_count);
+    return s_read_le32(index->entries + 4 * block_number);
+}
+
+static uint64_t s_block_length(const struct aws_checksums_block_index *index, uint64_t block_number) {
+    uint64_t start = block_number * index->block_size;
+    uint64_t left = index->object_length - start;
+    return left < index->block_size ? left : index->block_size;
+}
+
+int aws_checksums_block_index_range_crc(
+    const struct aws_checksums_block_index *index,
+    uint64_t offset,
+    uint64_t length,
+    const uint8_t *data,
+    uint32_t *out_crc) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    uint32_t poly = 0;
+    if (aws_checksums_crc_select(index->algorithm, &crc, &poly)) {
+        return AWS_OP_ERR;
+    }
+    if (offset > index->object_length || length > index->object_length - offset) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    uint32_t result = 0;
+    uint64_t position = offset;
+    const uint64_t end = offset + length;
+    /* shift over one whole block, computed on first use */
+    uint32_t block_shift = 0;
+    bool have_block_shift = false;
+
+    while (position < end) {
+        uint64_t block_number = position / index->block_size;
+        uint64_t block_start = block_number * index->block_size;
+        uint64_t block_end = block_start + s_block_length(index, block_number);
+        uint64_t piece_end = end < block_end ? end : block_end;
+        uint64_t piece_length = piece_end - position;
+
+        uint32_t piece_crc = 0;
+        if (position == block_start && piece_end == block_end) {
+            piece_crc = aws_checksums_block_index_get_block_crc(index, block_number);
+        } else {
+            /* a partial block at one end of the range, at most block_size (and so INT_MAX) bytes */
+            piece_crc = crc(data + (position - offset), (int)piece_length, 0);
+        }
+
+        uint32_t shift = 0;
+        if (piece_length == index->block_size) {
+            if (!have_block_shift) {
+                block_shift = aws_checksums_x2nmodp((uint64_t)index->block_size << 3, poly);
+                have_block_shift = true;
+            }
+            shift = block_shift;
+        } else {
+            shift = aws_checksums_x2nmodp(piece_length << 3, poly);
+        }
+
+        result = aws_checksums_multmodp(shift, result, poly) ^ piece_crc;
+        position = piece_end;
+    }
+
+    *out_crc = result;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_block_index_verify_range(
+    const struct aws_checksums_block_index *index,
+    uint64_t offset,
+    uint64_t length,
+    const uint8_t *data,
+    bool *out_matches) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    if (aws_checksums_crc_select(index->algorithm, &crc, NULL)) {
+        return AWS_OP_ERR;
+    }
+    const uint64_t end = offset + length;
+    if (offset > index->object_length || length > index->object_length - offset || offset % index->block_size ||
+        (end % index->block_size && end != index->object_length)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    bool matches = true;
+    for (uint64_t block_number = offset / index->block_size; matches && block_number * index->block_size < end;
+         ++block_number) {
+        const uint8_t *block = data + (block_number * index->block_size - offset);
+        /* at most block_size, and so INT_MAX, bytes */
+        int block_length = (int)s_block_length(index, block_number);
+        matches = crc(block, block_length, 0) == aws_checksums_block_index_get_block_crc(index, block_number);
+    }
+
+    *out_matches = matches;
+    return AWS_OP_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/checkpoint.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/common.h>
+
+static const uint8_t s_checkpoint_magic[4] = {'A', 'C', 'K', 'P'};
+
+/* everything before the trailing integrity crc */
+#define CHECKPOINT_BODY_SIZE (AWS_CHECKSUMS_CHECKPOINT_SIZE - 4)
+
+static bool s_algorithm_is_valid(enum aws_checksums_crc_algorithm algorithm) {
+    return (int)algorithm >= 0 && algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT;
+}
+
+int aws_checksums_checkpoint_init(
+    struct aws_checksums_checkpoint *checkpoint,
+    enum aws_checksums_crc_algorithm algorithm) {
+
+    if (!s_algorithm_is_valid(algorithm)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    checkpoint->algorithm = algorithm;
+    checkpoint->crc = 0;
+    checkpoint->length = 0;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_checkpoint_update(
+    struct aws_checksums_checkpoint *checkpoint,
+    const uint8_t *input,
+    size_t length) {
+
+    aws_checksums_crc_fn *crc_fn = NULL;
+    if (aws_checksums_crc_select(checkpoint->algorithm, &crc_fn, NULL)) {
+        return AWS_OP_ERR;
+    }
+    if (checkpoint->length + length < checkpoint->length) {
+        return aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+    }
+
+    checkpoint->length += length;
+    checkpoint->crc = aws_checksums_crc_update(crc_fn, input, length, checkpoint->crc);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_checkpoint_encode(
+    const struct aws_checksums_checkpoint *checkpoint,
+    struct aws_byte_buf *output) {
+
+    if (!s_algorithm_is_valid(checkpoint->algorithm)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    if (output->capacity - output->len < AWS_CHECKSUMS_CHECKPOINT_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    uint8_t *body = output->buffer + output->len;
+    aws_byte_buf_write(output, s_checkpoint_magic, sizeof(s_checkpoint_magic));
+    aws_byte_buf_write_u8(output, AWS_CHECKSUMS_CHECKPOINT_VERSION);
+    aws_byte_buf_write_u8(output, (uint8_t)checkpoint->algorithm);
+    aws_byte_buf_write_be16(output, 0);
+    aws_byte_buf_write_be64(output, checkpoint->length);
+    aws_byte_buf_write_be32(output, checkpoint->crc);
+    aws_byte_buf_write_be32(output, aws_checksums_crc32c(body, CHECKPOINT_BODY_SIZE, 0));
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_checkpoint_decode(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_checkpoint *checkpoint) {
+
+    if (input->len < AWS_CHECKSUMS_CHECKPOINT_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    struct aws_byte_cursor cursor = *input;
+    const uint32_t expected_integrity = aws_checksums_crc32c(cursor.ptr, CHECKPOINT_BODY_SIZE, 0);
+
+    uint8_t magic[4];
+    uint8_t version = 0;
+    uint8_t algorithm = 0;
+    uint16_t reserved = 0;
+    uint64_t length = 0;
+    uint32_t crc = 0;
+    uint32_t integrity = 0;
+    aws_byte_cursor_read(&cursor, magic, sizeof(magic));
+    aws_byte_cursor_read_u8(&cursor, &version);
+    aws_byte_cursor_read_u8(&cursor, &algorithm);
+    aws_byte_cursor_read_be16(&cursor, &reserved);
+    aws_byte_cursor_read_be64(&cursor, &length);
+    aws_byte_cursor_read_be32(&cursor, &crc);
+    aws_byte_cursor_read_be32(&cursor, &integrity);
+
+    if (memcmp(magic, s_checkpoint_magic, sizeof(magic)) || version != AWS_CHECKSUMS_CHECKPOINT_VERSION ||
+        algorithm >= AWS_CHECKSUMS_CRC_ALGORITHM_COUNT || reserved != 0 || integrity != expected_integrity) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    checkpoint->algorithm = (enum aws_checksums_crc_algorithm)algorithm;
+    checkpoint->crc = crc;
+    checkpoint->length = length;
+    aws_byte_cursor_advance(input, AWS_CHECKSUMS_CHECKPOINT_SIZE);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_checkpoint_merge(
+    const struct aws_checksums_checkpoint *first,
+    const struct aws_checksums_checkpoint *second,
+    struct aws_checksums_checkpoint *out) {
+
+    if (!s_algorithm_is_valid(first->algorithm) || first->algorithm != second->algorithm) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    if (first->length + second->length < first->length) {
+        return aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+    }
+
+    const enum aws_checksums_crc_algorithm algorithm = first->algorithm;
+    const uint64_t length = first->length + second->length;
+    const uint32_t crc = algorithm == AWS_CHECKSUMS_CRC32
+                             ? aws_checksums_crc32_combine(first->crc, second->crc, second->length)
+                             : aws_checksums_crc32c_combine(first->crc, second->crc, second->length);
+
+    out->algorithm = algorithm;
+    out->crc = crc;
+    out->length = length;
+    return AWS_OP_SUCCESS;
+}
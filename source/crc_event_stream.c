@@ -0,0 +1,107 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/event_stream.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/common.h>
+
+static uint32_t s_read_u32(const uint8_t *bytes) {
+    return (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | (uint32_t)bytes[3];
+}
+
+int aws_checksums_event_stream_compute_crcs(
+    const uint8_t *message,
+    size_t length,
+    uint32_t *out_prelude_crc,
+    uint32_t *out_message_crc) {
+
+    if (length < AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    uint32_t prelude_crc = aws_checksums_crc32(message, 8, 0);
+    uint8_t prelude_crc_bytes[4] = {
+        (uint8_t)(prelude_crc >> 24), (uint8_t)(prelude_crc >> 16), (uint8_t)(prelude_crc >> 8), (uint8_t)prelude_crc};
+    uint32_t message_crc = aws_checksums_crc32(prelude_crc_bytes, 4, prelude_crc);
+    message_crc = aws_checksums_crc_update(
+        aws_checksums_crc32,
+        message + AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE,
+        length - AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE,
+        message_crc);
+
+    *out_prelude_crc = prelude_crc;
+    *out_message_crc = message_crc;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_event_stream_validate(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_event_stream_frame *out_frame) {
+
+    if (input->len < AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    const uint8_t *message = input->ptr;
+    AWS_ZERO_STRUCT(*out_frame);
+    out_frame->prelude_crc = aws_checksums_crc32(message, 8, 0);
+    out_frame->prelude_crc_matches = out_frame->prelude_crc == s_read_u32(message + 8);
+    if (!out_frame->prelude_crc_matches) {
+        return AWS_OP_SUCCESS;
+    }
+
+    uint32_t total_length = s_read_u32(message);
+    uint32_t headers_length = s_read_u32(message + 4);
+    if (total_length < AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE ||
+        headers_length > total_length - AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    if (input->len < total_length) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    /* the stored prelude crc equals the running crc, so the pass simply continues over it */
+    size_t trailer = total_length - AWS_CHECKSUMS_EVENT_STREAM_TRAILER_SIZE;
+    out_frame->message_crc =
+        aws_checksums_crc_update(aws_checksums_crc32, message + 8, trailer - 8, out_frame->prelude_crc);
+    out_frame->message_crc_matches = out_frame->message_crc == s_read_u32(message + trailer);
+
+    out_frame->total_length = total_length;
+    out_frame->headers_length = headers_length;
+    out_frame->headers =
+        aws_byte_cursor_from_array(message + AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE, headers_length);
+    out_frame->payload = aws_byte_cursor_from_array(
+        message + AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE + headers_length,
+        total_length - AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE - headers_length);
+
+    aws_byte_cursor_advance(input, total_length);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_event_stream_validate_batch(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_event_stream_frame *frames,
+    size_t frame_capacity,
+    size_t *out_frame_count) {
+
+    size_t frame_count = 0;
+    int result = AWS_OP_SUCCESS;
+    while (input->len && frame_count < frame_capacity) {
+        struct aws_checksums_event_stream_frame *frame = &frames[frame_count];
+        if (aws_checksums_event_stream_validate(input, frame)) {
+            if (aws_last_error() != AWS_ERROR_SHORT_BUFFER) {
+                result = AWS_OP_ERR;
+            }
+            break;
+        }
+        ++frame_count;
+        if (!frame->prelude_crc_matches || !frame->message_crc_matches) {
+            break;
+        }
+    }
+
+    *out_frame_count = frame_count;
+    return result;
+}
@@ -0,0 +1,382 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/file.h>
+#include <aws/checksums/private/crc_file.h>
+#include <aws/checksums/private/crc_file_reader.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/clock.h>
+#include <aws/common/common.h>
+#include <aws/common/file.h>
+#include <aws/common/math.h>
+#include <aws/common/system_info.h>
+#include <aws/common/thread.h>
+
+#include <errno.h>
+#include <stdio.h>
+
+/* read size of the buffered path */
+#define FILE_READ_BUFFER_SIZE (1024 * 1024)
+
+struct file_range {
+    aws_checksums_crc_fn *crc;
+    const uint8_t *data;
+    size_t length;
+    uint32_t result;
+    bool on_worker;
+};
+
+static void s_range_main(void *arg) {
+    struct file_range *range = arg;
+    range->result = aws_checksums_crc_update(range->crc, range->data, range->length, 0);
+}
+
+/*
+ * One contiguous range per thread, each checksummed from 0 and then combined in file order. The calling thread takes
+ * the first range; a worker that fails to launch has its range run on the calling thread instead.
+ */
+static int s_crc_mapped(
+    struct aws_allocator *allocator,
+    const struct aws_checksums_file_mapping *mapping,
+    aws_checksums_crc_fn *crc,
+    uint32_t poly,
+    size_t thread_count,
+    uint64_t min_bytes_per_thread,
+    uint32_t *out_crc) {
+
+    uint64_t max_threads = mapping->length / min_bytes_per_thread;
+    if (thread_count > max_threads) {
+        thread_count = max_threads ? (size_t)max_threads : 1;
+    }
+
+    if (thread_count == 1) {
+        *out_crc = aws_checksums_crc_update(crc, mapping->data, mapping->length, 0);
+        return AWS_OP_SUCCESS;
+    }
+
+    struct file_range *ranges = aws_mem_calloc(allocator, thread_count, sizeof(struct file_range));
+    struct aws_thread *threads = aws_mem_calloc(allocator, thread_count, sizeof(struct aws_thread));
+    if (!ranges || !threads) {
+        aws_mem_release(allocator, ranges);
+        aws_mem_release(allocator, threads);
+        return AWS_OP_ERR;
+    }
+
+    size_t range_length = mapping->length / thread_count;
+    for (size_t i = 0; i < thread_count; ++i) {
+        ranges[i].crc = crc;
+        ranges[i].data = mapping->data + i * range_length;
+        ranges[i].length = i + 1 == thread_count ? mapping->length - i * range_length : range_length;
+    }
+
+    for (size_t i = 1; i < thread_count; ++i) {
+        aws_thread_init(&threads[i], allocator);
+        if (aws_thread_launch(&threads[i], s_range_main, &ranges[i], aws_default_thread_options())) {
+            aws_thread_clean_up(&threads[i]);
+            s_range_main(&ranges[i]);
+        } else {
+            ranges[i].on_worker = true;
+        }
+    }
+
+    s_range_main(&ranges[0]);
+    uint32_t result = ranges[0].result;
+    for (size_t i = 1; i < thread_count; ++i) {
+        if (ranges[i].on_worker) {
+            aws_thread_join(&threads[i]);
+            aws_thread_clean_up(&threads[i]);
+        }
+        /* as in aws_checksums_crc32_combine(), shift the crc so far over the range and add the range's crc */
+        uint32_t shift = aws_checksums_x2nmodp((uint64_t)ranges[i].length << 3, poly);
+        result = aws_checksums_multmodp(shift, result, poly) ^ ranges[i].result;
+    }
+
+    aws_mem_release(allocator, ranges);
+    aws_mem_release(allocator, threads);
+    *out_crc = result;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_crc_buffered(
+    struct aws_allocator *allocator,
+    const char *path,
+    aws_checksums_crc_fn *crc,
+    uint32_t *out_crc) {
+
+    FILE *file = aws_fopen(path, "rb");
+    if (!file) {
+        return AWS_OP_ERR;
+    }
+
+    uint8_t *buffer = aws_mem_acquire(allocator, FILE_READ_BUFFER_SIZE);
+    if (!buffer) {
+        fclose(file);
+        return AWS_OP_ERR;
+    }
+
+    uint32_t result = 0;
+    size_t read = 0;
+    while ((read = fread(buffer, 1, FILE_READ_BUFFER_SIZE, file)) > 0) {
+        result = crc(buffer, (int)read, result);
+    }
+    /* ferror doesn't promise errno is set, a failed read must not pass for the end of the file either way */
+    bool read_failed = ferror(file) != 0;
+    int read_errno = errno;
+
+    aws_mem_release(allocator, buffer);
+    fclose(file);
+
+    if (read_failed) {
+        return read_errno ? aws_translate_and_raise_io_error(read_errno) : aws_raise_error(AWS_ERROR_FILE_READ_FAILURE);
+    }
+    *out_crc = result;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_file_crc(
+    struct aws_allocator *allocator,
+    const char *path,
+    enum aws_checksums_crc_algorithm algorithm,
+    const struct aws_checksums_file_options *options,
+    uint32_t *out_crc) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    uint32_t poly = 0;
+    if (!path || !out_crc || aws_checksums_crc_select(algorithm, &crc, &poly)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct aws_checksums_file_options defaults = {0};
+    if (!options) {
+        options = &defaults;
+    }
+
+    size_t thread_count = options->thread_count;
+    if (!thread_count) {
+        thread_count = aws_system_info_processor_count();
+        if (thread_count > AWS_CHECKSUMS_FILE_DEFAULT_MAX_THREADS) {
+            thread_count = AWS_CHECKSUMS_FILE_DEFAULT_MAX_THREADS;
+        }
+    }
+    uint64_t min_bytes_per_thread =
+        options->min_bytes_per_thread ? options->min_bytes_per_thread : AWS_CHECKSUMS_FILE_DEFAULT_MIN_BYTES_PER_THREAD;
+
+    if (!options->force_buffered) {
+        struct aws_checksums_file_mapping mapping = {0};
+        if (aws_checksums_file_map(path, &mapping) == AWS_OP_SUCCESS) {
+            int result = s_crc_mapped(allocator, &mapping, crc, poly, thread_count, min_bytes_per_thread, out_crc);
+            aws_checksums_file_unmap(&mapping);
+            return result;
+        }
+        if (aws_last_error() != AWS_ERROR_UNSUPPORTED_OPERATION) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return s_crc_buffered(allocator, path, crc, out_crc);
+}
+
+/* each block goes through a single kernel call, which takes an int length */
+#define FILE_STREAM_MAX_BLOCK_SIZE (1024 * 1024 * 1024)
+
+/*
+ * The streaming pipeline: block i of the file is read into slot i % queue_depth, and the calling thread checksums the
+ * blocks strictly in file order while up to queue_depth - 1 reads after the current one are in flight. Reads can
+ * complete in any order; a slot whose read finished early just waits for its turn.
+ */
+struct stream_slot {
+    /* first, so a completed read converts back to its slot */
+    struct aws_checksums_read read;
+    uint8_t *buffer;
+    uint64_t block_offset;
+    /* bytes of the file in this block, the read itself may be longer for O_DIRECT */
+    size_t block_length;
+    size_t filled;
+    bool done;
+};
+
+struct file_stream {
+    struct aws_checksums_file_reader *reader;
+    struct aws_checksums_file_reader_info info;
+    struct stream_slot *slots;
+    size_t block_size;
+    uint64_t next_offset;
+    size_t in_flight;
+    struct aws_checksums_file_stream_stats stats;
+};
+
+static uint64_t s_now_ns(void) {
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    return now;
+}
+
+static size_t s_align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/* issues the part of the slot's block that hasn't been read yet */
+static int s_stream_submit(struct file_stream *stream, struct stream_slot *slot) {
+    size_t remaining = slot->block_length - slot->filled;
+    slot->read.buffer = slot->buffer + slot->filled;
+    slot->read.offset = slot->block_offset + slot->filled;
+    /* O_DIRECT reads whole sectors, the part past the end of the file just comes back short */
+    slot->read.length = stream->info.direct_io ? s_align_up(remaining, AWS_CHECKSUMS_DIRECT_IO_ALIGNMENT) : remaining;
+
+    if (aws_checksums_file_reader_submit(stream->reader, &slot->read)) {
+        return AWS_OP_ERR;
+    }
+    ++stream->in_flight;
+    ++stream->stats.reads;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_stream_start_block(struct file_stream *stream, struct stream_slot *slot) {
+    slot->block_offset = stream->next_offset;
+    slot->block_length = (size_t)aws_min_u64(stream->block_size, stream->info.size - stream->next_offset);
+    slot->filled = 0;
+    slot->done = false;
+    stream->next_offset += slot->block_length;
+    return s_stream_submit(stream, slot);
+}
+
+static int s_stream_complete_one(struct file_stream *stream) {
+    struct aws_checksums_read *read = NULL;
+    if (aws_checksums_file_reader_wait(stream->reader, &read)) {
+        return AWS_OP_ERR;
+    }
+    --stream->in_flight;
+
+    struct stream_slot *slot = (struct stream_slot *)read;
+    if (read->result < 0) {
+        return aws_translate_and_raise_io_error((int)-read->result);
+    }
+    if (read->result == 0) {
+        /* the file was shorter than its size said when we opened it */
+        return aws_raise_error(AWS_ERROR_FILE_READ_FAILURE);
+    }
+
+    slot->filled += (size_t)aws_min_u64((uint64_t)read->result, slot->block_length - slot->filled);
+    if (slot->filled < slot->block_length) {
+        return s_stream_submit(stream, slot);
+    }
+    slot->done = true;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_file_crc_stream(
+    struct aws_allocator *allocator,
+    const char *path,
+    enum aws_checksums_crc_algorithm algorithm,
+    const struct aws_checksums_file_stream_options *options,
+    uint32_t *out_crc,
+    struct aws_checksums_file_stream_stats *out_stats) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    if (!path || !out_crc || aws_checksums_crc_select(algorithm, &crc, NULL)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct aws_checksums_file_stream_options defaults = {0};
+    if (!options) {
+        options = &defaults;
+    }
+    size_t queue_depth = options->queue_depth ? options->queue_depth : AWS_CHECKSUMS_FILE_STREAM_DEFAULT_QUEUE_DEPTH;
+    size_t block_size = options->block_size ? options->block_size : AWS_CHECKSUMS_FILE_STREAM_DEFAULT_BLOCK_SIZE;
+    if (block_size > FILE_STREAM_MAX_BLOCK_SIZE) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    block_size = s_align_up(block_size, AWS_CHECKSUMS_DIRECT_IO_ALIGNMENT);
+    /* every slot's buffer plus the slack to align the first one */
+    size_t storage_size = 0;
+    if (aws_mul_size_checked(queue_depth, block_size, &storage_size) ||
+        aws_add_size_checked(storage_size, AWS_CHECKSUMS_DIRECT_IO_ALIGNMENT, &storage_size)) {
+        return AWS_OP_ERR;
+    }
+
+    uint64_t start_ns = s_now_ns();
+    struct file_stream stream;
+    AWS_ZERO_STRUCT(stream);
+    stream.block_size = block_size;
+
+    struct aws_checksums_file_reader_options reader_options = {
+        .queue_depth = queue_depth,
+        .direct_io = !options->disable_direct_io,
+        .io_uring = !options->disable_io_uring,
+    };
+    stream.reader = aws_checksums_file_reader_new(allocator, path, &reader_options, &stream.info);
+    if (!stream.reader) {
+        return AWS_OP_ERR;
+    }
+
+    int result = AWS_OP_ERR;
+    uint8_t *storage = aws_mem_acquire(allocator, storage_size);
+    stream.slots = aws_mem_calloc(allocator, queue_depth, sizeof(struct stream_slot));
+    if (!storage || !stream.slots) {
+        goto done;
+    }
+    uint8_t *buffers = (uint8_t *)s_align_up((size_t)(uintptr_t)storage, AWS_CHECKSUMS_DIRECT_IO_ALIGNMENT);
+    for (size_t i = 0; i < queue_depth; ++i) {
+        stream.slots[i].buffer = buffers + i * block_size;
+    }
+
+    for (size_t i = 0; i < queue_depth && stream.next_offset < stream.info.size; ++i) {
+        if (s_stream_start_block(&stream, &stream.slots[i])) {
+            goto done;
+        }
+    }
+
+    uint32_t crc_value = 0;
+    uint64_t consumed = 0;
+    for (size_t block = 0; consumed < stream.info.size; ++block) {
+        struct stream_slot *slot = &stream.slots[block % queue_depth];
+
+        uint64_t wait_start_ns = s_now_ns();
+        while (!slot->done) {
+            if (s_stream_complete_one(&stream)) {
+                goto done;
+            }
+        }
+        uint64_t checksum_start_ns = s_now_ns();
+        stream.stats.read_wait_ns += checksum_start_ns - wait_start_ns;
+
+        crc_value = crc(slot->buffer, (int)slot->block_length, crc_value);
+        consumed += slot->block_length;
+        stream.stats.checksum_ns += s_now_ns() - checksum_start_ns;
+
+        if (stream.next_offset < stream.info.size && s_stream_start_block(&stream, slot)) {
+            goto done;
+        }
+    }
+
+    *out_crc = crc_value;
+    stream.stats.bytes = consumed;
+    result = AWS_OP_SUCCESS;
+
+done:;
+    /* the buffers can't go away under reads still in flight, drain them without losing the error that stopped us */
+    int error = result == AWS_OP_SUCCESS ? AWS_ERROR_SUCCESS : aws_last_error();
+    while (stream.in_flight) {
+        struct aws_checksums_read *read = NULL;
+        if (aws_checksums_file_reader_wait(stream.reader, &read)) {
+            break;
+        }
+        --stream.in_flight;
+    }
+    aws_checksums_file_reader_destroy(stream.reader);
+    aws_mem_release(allocator, stream.slots);
+    aws_mem_release(allocator, storage);
+
+    if (result != AWS_OP_SUCCESS) {
+        return aws_raise_error(error);
+    }
+    if (out_stats) {
+        stream.stats.elapsed_ns = s_now_ns() - start_ns;
+        stream.stats.direct_io = stream.info.direct_io;
+        stream.stats.io_uring = stream.info.io_uring;
+        *out_stats = stream.stats;
+    }
+    return AWS_OP_SUCCESS;
+}
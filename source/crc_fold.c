@@ -0,0 +1,177 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_fold.h>
+#include <aws/checksums/private/crc_priv.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/cpuid.h>
+#include <aws/common/thread.h>
+
+/*
+ * Carry-less multiply folding crc for x86, generic over the polynomial: the same fold functions serve crc32 (which
+ * has no x86 instruction at all) and crc32c. Each ISA tier lives in its own file under source/intel/intrin, built with
+ * only that tier's flags, and the best one the host supports is picked here at runtime (see crc_fold.h).
+ */
+
+#ifdef AWS_CHECKSUMS_HAVE_CLMUL_FOLD
+
+static struct aws_checksums_fold_constants s_crc32_constants;
+static struct aws_checksums_fold_constants s_crc32c_constants;
+static aws_thread_once s_constants_once = AWS_THREAD_ONCE_STATIC_INIT;
+
+enum fold_level {
+    FOLD_NONE,
+    FOLD_CLMUL,
+    FOLD_AVX512,
+};
+
+#    ifdef AWS_CHECKSUMS_FIXED_ISA
+
+/* fixed ISA build, the level follows from the target flags the library is compiled with */
+static enum fold_level s_detect_level(void) {
+#        if defined(AWS_CHECKSUMS_HAVE_AVX512_FOLD) && defined(__AVX512F__) && defined(__AVX512VL__) &&                   \
+            defined(__VPCLMULQDQ__)
+    return FOLD_AVX512;
+#        elif defined(__PCLMUL__) && defined(__SSE4_1__)
+    return FOLD_CLMUL;
+#        else
+    return FOLD_NONE;
+#        endif
+}
+
+static bool s_crc32c_has_hw(void) {
+#        ifdef __SSE4_2__
+    return true;
+#        else
+    return false;
+#        endif
+}
+
+#    else
+
+static bool s_detection_performed = false;
+static enum fold_level s_level = FOLD_NONE;
+/* crc32c short inputs and fold tails take the crc32 instruction where there is one */
+static bool s_crc32c_hw = false;
+
+static enum fold_level s_detect_level(void) {
+    if (AWS_UNLIKELY(!s_detection_performed)) {
+#        ifdef AWS_CHECKSUMS_HAVE_AVX512_FOLD
+        if (aws_cpu_has_feature(AWS_CPU_FEATURE_AVX512) && aws_cpu_has_feature(AWS_CPU_FEATURE_VPCLMULQDQ)) {
+            s_level = FOLD_AVX512;
+        } else
+#        endif
+            if (aws_cpu_has_feature(AWS_CPU_FEATURE_CLMUL) && aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_1)) {
+            s_level = FOLD_CLMUL;
+        }
+        if (aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2)) {
+            s_crc32c_hw = true;
+        }
+        /* same reasoning as the detection in the hw kernels, a race only repeats the detection */
+        s_detection_performed = true;
+    }
+    return s_level;
+}
+
+static bool s_crc32c_has_hw(void) {
+    s_detect_level();
+    return s_crc32c_hw;
+}
+
+#    endif /* AWS_CHECKSUMS_FIXED_ISA */
+
+static void s_fill_pair(uint64_t pair[2], uint64_t distance, uint32_t poly) {
+    pair[0] = (uint64_t)aws_checksums_x2nmodp(distance + 63, poly) << 32;
+    pair[1] = (uint64_t)aws_checksums_x2nmodp(distance - 1, poly) << 32;
+}
+
+static void s_fill_constants(struct aws_checksums_fold_constants *constants, uint32_t poly) {
+    s_fill_pair(constants->fold_128, 128, poly);
+    s_fill_pair(constants->fold_256, 256, poly);
+    s_fill_pair(constants->fold_384, 384, poly);
+    s_fill_pair(constants->fold_512, 512, poly);
+    s_fill_pair(constants->fold_2048, 2048, poly);
+}
+
+static void s_init_constants(void *user_data) {
+    (void)user_data;
+    s_fill_constants(&s_crc32_constants, CRC32_POLYNOMIAL);
+    s_fill_constants(&s_crc32c_constants, CRC32C_POLYNOMIAL);
+}
+
+static uint32_t s_crc_fold(
+    const uint8_t *input,
+    int length,
+    uint32_t previous_crc,
+    const struct aws_checksums_fold_constants *constants,
+    aws_checksums_crc_fn *tail_fn) {
+
+    uint8_t remainder[16];
+    size_t consumed = 0;
+
+#    ifdef AWS_CHECKSUMS_HAVE_AVX512_FOLD
+    if (s_detect_level() == FOLD_AVX512 && length >= AWS_CHECKSUMS_FOLD_AVX512_MIN_LENGTH) {
+        consumed = aws_checksums_crc_fold_avx512(input, (size_t)length, ~previous_crc, constants, remainder);
+    } else
+#    endif
+    {
+        consumed = aws_checksums_crc_fold_clmul(input, (size_t)length, ~previous_crc, constants, remainder);
+    }
+
+    /* the remainder's crc starting from 0 is what tail_fn computes for a previous crc of ~0 */
+    uint32_t crc = tail_fn(remainder, sizeof(remainder), 0xFFFFFFFF);
+    return tail_fn(input + consumed, length - (int)consumed, crc);
+}
+
+bool aws_checksums_clmul_fold_is_available(void) {
+    return s_detect_level() != FOLD_NONE;
+}
+
+bool aws_checksums_avx512_fold_is_available(void) {
+    return s_detect_level() == FOLD_AVX512;
+}
+
+uint32_t aws_checksums_crc32_clmul(const uint8_t *input, int length, uint32_t previousCrc32) {
+    if (length >= AWS_CHECKSUMS_FOLD_CLMUL_MIN_LENGTH && s_detect_level() != FOLD_NONE) {
+        aws_thread_call_once(&s_constants_once, s_init_constants, NULL);
+        return s_crc_fold(input, length, previousCrc32, &s_crc32_constants, aws_checksums_crc32_sw);
+    }
+    return aws_checksums_crc32_sw(input, length, previousCrc32);
+}
+
+uint32_t aws_checksums_crc32c_clmul(const uint8_t *input, int length, uint32_t previousCrc32) {
+    if (s_crc32c_has_hw()) {
+        if (length < AWS_CHECKSUMS_CRC32C_HW_FOLD_MIN_LENGTH || s_detect_level() == FOLD_NONE) {
+            return aws_checksums_crc32c_hw(input, length, previousCrc32);
+        }
+        aws_thread_call_once(&s_constants_once, s_init_constants, NULL);
+        return s_crc_fold(input, length, previousCrc32, &s_crc32c_constants, aws_checksums_crc32c_hw);
+    }
+    if (length >= AWS_CHECKSUMS_FOLD_CLMUL_MIN_LENGTH && s_detect_level() != FOLD_NONE) {
+        aws_thread_call_once(&s_constants_once, s_init_constants, NULL);
+        return s_crc_fold(input, length, previousCrc32, &s_crc32c_constants, aws_checksums_crc32c_sw);
+    }
+    return aws_checksums_crc32c_sw(input, length, previousCrc32);
+}
+
+#else
+
+bool aws_checksums_clmul_fold_is_available(void) {
+    return false;
+}
+
+bool aws_checksums_avx512_fold_is_available(void) {
+    return false;
+}
+
+uint32_t aws_checksums_crc32_clmul(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32_sw(input, length, previousCrc32);
+}
+
+uint32_t aws_checksums_crc32c_clmul(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32c_sw(input, length, previousCrc32);
+}
+
+#endif /* AWS_CHECKSUMS_HAVE_CLMUL_FOLD */
@@ -0,0 +1,224 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/header.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/common.h>
+
+static const uint8_t s_encoding[64] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* base64 digit value + 1 of every character, 0 for characters that aren't digits */
+static const uint8_t s_decoding[256] = {
+    ['A'] = 1, ['B'] = 2, ['C'] = 3, ['D'] = 4, ['E'] = 5, ['F'] = 6, ['G'] = 7, ['H'] = 8, ['I'] = 9, ['J'] = 10,
+    ['K'] = 11, ['L'] = 12, ['M'] = 13, ['N'] = 14, ['O'] = 15, ['P'] = 16, ['Q'] = 17, ['R'] = 18, ['S'] = 19,
+    ['T'] = 20, ['U'] = 21, ['V'] = 22, ['W'] = 23, ['X'] = 24, ['Y'] = 25, ['Z'] = 26, ['a'] = 27, ['b'] = 28,
+    ['c'] = 29, ['d'] = 30, ['e'] = 31, ['f'] = 32, ['g'] = 33, ['h'] = 34, ['i'] = 35, ['j'] = 36, ['k'] = 37,
+    ['l'] = 38, ['m'] = 39, ['n'] = 40, ['o'] = 41, ['p'] = 42, ['q'] = 43, ['r'] = 44, ['s'] = 45, ['t'] = 46,
+    ['u'] = 47, ['v'] = 48, ['w'] = 49, ['x'] = 50, ['y'] = 51, ['z'] = 52, ['0'] = 53, ['1'] = 54, ['2'] = 55,
+    ['3'] = 56, ['4'] = 57, ['5'] = 58, ['6'] = 59, ['7'] = 60, ['8'] = 61, ['9'] = 62, ['+'] = 63, ['/'] = 64,
+};
+
+/* the 32 bits are six digits of 6, 6, 6, 6, 6 and 2 bits (padded with 4 zero bits), then two '=' */
+static void s_encode(uint32_t crc, uint8_t *out) {
+    out[0] = s_encoding[crc >> 26];
+    out[1] = s_encoding[(crc >> 20) & 0x3F];
+    out[2] = s_encoding[(crc >> 14) & 0x3F];
+    out[3] = s_encoding[(crc >> 8) & 0x3F];
+    out[4] = s_encoding[(crc >> 2) & 0x3F];
+    out[5] = s_encoding[(crc << 4) & 0x30];
+    out[6] = '=';
+    out[7] = '=';
+}
+
+static struct aws_byte_cursor s_trim(struct aws_byte_cursor value) {
+    while (value.len && (value.ptr[0] == ' ' || value.ptr[0] == '\t')) {
+        aws_byte_cursor_advance(&value, 1);
+    }
+    while (value.len && (value.ptr[value.len - 1] == ' ' || value.ptr[value.len - 1] == '\t')) {
+        --value.len;
+    }
+    return value;
+}
+
+/* value is trimmed */
+static int s_decode_trimmed(struct aws_byte_cursor value, uint32_t *out_crc) {
+    if (value.len != AWS_CHECKSUMS_HEADER_VALUE_SIZE || value.ptr[6] != '=' || value.ptr[7] != '=') {
+        return aws_raise_error(AWS_ERROR_INVALID_BASE64_STR);
+    }
+
+    uint8_t digits[6];
+    uint8_t invalid = 0;
+    for (size_t i = 0; i < 6; ++i) {
+        uint8_t digit = s_decoding[value.ptr[i]];
+        invalid |= digit == 0;
+        digits[i] = (uint8_t)(digit - 1);
+    }
+    /* the last digit only carries 2 bits, the canonical encoding has the other 4 clear */
+    if (invalid || (digits[5] & 0x0F)) {
+        return aws_raise_error(AWS_ERROR_INVALID_BASE64_STR);
+    }
+
+    *out_crc = (uint32_t)digits[0] << 26 | (uint32_t)digits[1] << 20 | (uint32_t)digits[2] << 14 |
+               (uint32_t)digits[3] << 8 | (uint32_t)digits[4] << 2 | (uint32_t)digits[5] >> 4;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_decode(struct aws_byte_cursor value, uint32_t *out_crc) {
+    return s_decode_trimmed(s_trim(value), out_crc);
+}
+
+/* digits is a part count: 1 or more, no leading zeros, no overflow */
+static int s_decode_part_count(struct aws_byte_cursor digits, size_t *out_part_count) {
+    if (digits.len == 0 || digits.ptr[0] == '0') {
+        return aws_raise_error(AWS_ERROR_INVALID_BASE64_STR);
+    }
+    size_t part_count = 0;
+    for (size_t i = 0; i < digits.len; ++i) {
+        uint8_t digit = (uint8_t)(digits.ptr[i] - '0');
+        if (digit > 9 || part_count > (SIZE_MAX - digit) / 10) {
+            return aws_raise_error(AWS_ERROR_INVALID_BASE64_STR);
+        }
+        part_count = part_count * 10 + digit;
+    }
+    *out_part_count = part_count;
+    return AWS_OP_SUCCESS;
+}
+
+struct aws_byte_cursor aws_checksums_header_name(enum aws_checksums_crc_algorithm algorithm) {
+    switch (algorithm) {
+        case AWS_CHECKSUMS_CRC32:
+            return aws_byte_cursor_from_c_str("x-amz-checksum-crc32");
+        case AWS_CHECKSUMS_CRC32C:
+            return aws_byte_cursor_from_c_str("x-amz-checksum-crc32c");
+        default: {
+            struct aws_byte_cursor empty = {0};
+            return empty;
+        }
+    }
+}
+
+int aws_checksums_header_value_encode(uint32_t crc, struct aws_byte_buf *output) {
+    if (output->capacity - output->len < AWS_CHECKSUMS_HEADER_VALUE_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    s_encode(crc, output->buffer + output->len);
+    output->len += AWS_CHECKSUMS_HEADER_VALUE_SIZE;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_header_value_decode(struct aws_byte_cursor value, uint32_t *out_crc) {
+    return s_decode(value, out_crc);
+}
+
+int aws_checksums_header_value_encode_composite(uint32_t crc, size_t part_count, struct aws_byte_buf *output) {
+    if (part_count == 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* the count's digits, least significant first */
+    uint8_t digits[20];
+    size_t digit_count = 0;
+    do {
+        digits[digit_count++] = (uint8_t)('0' + part_count % 10);
+        part_count /= 10;
+    } while (part_count);
+
+    if (output->capacity - output->len < AWS_CHECKSUMS_HEADER_VALUE_SIZE + 1 + digit_count) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    uint8_t *out = output->buffer + output->len;
+    s_encode(crc, out);
+    out += AWS_CHECKSUMS_HEADER_VALUE_SIZE;
+    *out++ = '-';
+    for (size_t i = 0; i < digit_count; ++i) {
+        out[i] = digits[digit_count - 1 - i];
+    }
+    output->len += AWS_CHECKSUMS_HEADER_VALUE_SIZE + 1 + digit_count;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_header_value_decode_composite(
+    struct aws_byte_cursor value,
+    uint32_t *out_crc,
+    size_t *out_part_count) {
+
+    value = s_trim(value);
+    size_t part_count = 0;
+    if (value.len > AWS_CHECKSUMS_HEADER_VALUE_SIZE) {
+        if (value.ptr[AWS_CHECKSUMS_HEADER_VALUE_SIZE] != '-') {
+            return aws_raise_error(AWS_ERROR_INVALID_BASE64_STR);
+        }
+        struct aws_byte_cursor digits = aws_byte_cursor_from_array(
+            value.ptr + AWS_CHECKSUMS_HEADER_VALUE_SIZE + 1, value.len - AWS_CHECKSUMS_HEADER_VALUE_SIZE - 1);
+        if (s_decode_part_count(digits, &part_count)) {
+            return AWS_OP_ERR;
+        }
+        value.len = AWS_CHECKSUMS_HEADER_VALUE_SIZE;
+    }
+    if (s_decode_trimmed(value, out_crc)) {
+        return AWS_OP_ERR;
+    }
+    *out_part_count = part_count;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_header_value_compute(
+    enum aws_checksums_crc_algorithm algorithm,
+    const uint8_t *input,
+    size_t length,
+    struct aws_byte_buf *output) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    if (aws_checksums_crc_select(algorithm, &crc, NULL)) {
+        return AWS_OP_ERR;
+    }
+    if (output->capacity - output->len < AWS_CHECKSUMS_HEADER_VALUE_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    s_encode(aws_checksums_crc_update(crc, input, length, 0), output->buffer + output->len);
+    output->len += AWS_CHECKSUMS_HEADER_VALUE_SIZE;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_header_value_verify(
+    enum aws_checksums_crc_algorithm algorithm,
+    const uint8_t *input,
+    size_t length,
+    struct aws_byte_cursor value,
+    bool *out_matches) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    if (aws_checksums_crc_select(algorithm, &crc, NULL)) {
+        return AWS_OP_ERR;
+    }
+    uint32_t expected = 0;
+    if (s_decode(value, &expected)) {
+        return AWS_OP_ERR;
+    }
+    *out_matches = aws_checksums_crc_update(crc, input, length, 0) == expected;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_header_value_encode_batch(const uint32_t *crcs, size_t count, struct aws_byte_buf *output) {
+    if ((output->capacity - output->len) / AWS_CHECKSUMS_HEADER_VALUE_SIZE < count) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    uint8_t *out = output->buffer + output->len;
+    for (size_t i = 0; i < count; ++i) {
+        s_encode(crcs[i], out);
+        out += AWS_CHECKSUMS_HEADER_VALUE_SIZE;
+    }
+    output->len += count * AWS_CHECKSUMS_HEADER_VALUE_SIZE;
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_header_value_decode_batch(const struct aws_byte_cursor *values, size_t count, uint32_t *out_crcs) {
+    for (size_t i = 0; i < count; ++i) {
+        if (s_decode(values[i], &out_crcs[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+    return AWS_OP_SUCCESS;
+}
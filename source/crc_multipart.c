@@ -0,0 +1,67 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/multipart.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/common.h>
+
+/* part crcs go into the composite crc this many at a time, one kernel call per batch instead of per part */
+#define MULTIPART_COMPOSITE_BATCH 256
+
+int aws_checksums_multipart_crc_compute(
+    enum aws_checksums_crc_algorithm algorithm,
+    const struct aws_checksums_part *parts,
+    size_t part_count,
+    struct aws_checksums_multipart_crc *out) {
+
+    aws_checksums_crc_fn *crc_fn = NULL;
+    uint32_t poly = 0;
+    if (aws_checksums_crc_select(algorithm, &crc_fn, &poly)) {
+        return AWS_OP_ERR;
+    }
+    if (!out || (!parts && part_count)) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    uint8_t batch[4 * MULTIPART_COMPOSITE_BATCH];
+    size_t batched = 0;
+    uint32_t composite_crc = 0;
+    uint32_t full_object_crc = 0;
+    uint64_t total_length = 0;
+
+    /* x^(8 * shift_length), the shift of the crc so far over a part of shift_length bytes */
+    uint64_t shift_length = 0;
+    uint32_t shift = 0;
+
+    for (size_t i = 0; i < part_count; ++i) {
+        const struct aws_checksums_part *part = &parts[i];
+
+        if (i == 0 || part->length != shift_length) {
+            shift_length = part->length;
+            shift = aws_checksums_x2nmodp(shift_length << 3, poly);
+        }
+        full_object_crc = aws_checksums_multmodp(shift, full_object_crc, poly) ^ part->crc;
+        total_length += part->length;
+
+        uint8_t *bytes = batch + 4 * batched;
+        bytes[0] = (uint8_t)(part->crc >> 24);
+        bytes[1] = (uint8_t)(part->crc >> 16);
+        bytes[2] = (uint8_t)(part->crc >> 8);
+        bytes[3] = (uint8_t)part->crc;
+        if (++batched == MULTIPART_COMPOSITE_BATCH) {
+            composite_crc = crc_fn(batch, (int)sizeof(batch), composite_crc);
+            batched = 0;
+        }
+    }
+    if (batched) {
+        composite_crc = crc_fn(batch, (int)(4 * batched), composite_crc);
+    }
+
+    out->composite_crc = composite_crc;
+    out->full_object_crc = full_object_crc;
+    out->total_length = total_length;
+    out->part_count = part_count;
+    return AWS_OP_SUCCESS;
+}
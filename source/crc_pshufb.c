@@ -0,0 +1,185 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_priv.h>
+#include <aws/checksums/private/crc_pshufb.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/cpuid.h>
+#include <aws/common/thread.h>
+
+#include <string.h>
+
+/*
+ * Vectorized table driven crc for x86 cpus that have SSSE3 but neither crc instructions nor carry-less multiply
+ * (typically virtual machines and emulators that mask them). Instead of walking the 16 KiB slice-by-16 table, each
+ * block is split into 16 (SSSE3) or 32 (AVX2) contiguous lanes that run independent byte-at-a-time crcs out of
+ * nibble tables held in registers, and the lane crcs are merged afterwards (see crc_pshufb.h).
+ */
+
+#define PSHUFB_SSSE3_BLOCK (16 * AWS_CHECKSUMS_PSHUFB_LANE_BYTES)
+#define PSHUFB_AVX2_BLOCK (32 * AWS_CHECKSUMS_PSHUFB_LANE_BYTES)
+
+#ifdef AWS_CHECKSUMS_HAVE_PSHUFB
+
+struct pshufb_tables {
+    struct aws_checksums_nibble_tables nibbles;
+    /* shift[k][i] = (i << 8k) * x^(8 * AWS_CHECKSUMS_PSHUFB_LANE_BYTES) mod p, advances a crc over one lane */
+    uint32_t shift[4][256];
+};
+
+static struct pshufb_tables s_crc32_tables;
+static struct pshufb_tables s_crc32c_tables;
+static aws_thread_once s_tables_once = AWS_THREAD_ONCE_STATIC_INIT;
+
+enum pshufb_level {
+    PSHUFB_NONE,
+    PSHUFB_SSSE3,
+    PSHUFB_AVX2,
+};
+
+#    ifdef AWS_CHECKSUMS_FIXED_ISA
+
+/* fixed ISA build, the level follows from the target flags the library is compiled with */
+static enum pshufb_level s_detect_level(void) {
+#        if defined(__AVX2__)
+    return PSHUFB_AVX2;
+#        elif defined(__SSSE3__)
+    return PSHUFB_SSSE3;
+#        else
+    return PSHUFB_NONE;
+#        endif
+}
+
+#    else
+
+static bool s_detection_performed = false;
+static enum pshufb_level s_level = PSHUFB_NONE;
+
+static enum pshufb_level s_detect_level(void) {
+    if (AWS_UNLIKELY(!s_detection_performed)) {
+        /* aws-c-common has no SSSE3 flag, every cpu with SSE4.1 has SSSE3 */
+        if (aws_cpu_has_feature(AWS_CPU_FEATURE_AVX2)) {
+            s_level = PSHUFB_AVX2;
+        } else if (aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_1)) {
+            s_level = PSHUFB_SSSE3;
+        }
+        /* same reasoning as the detection in the hw kernels, a race only repeats the detection */
+        s_detection_performed = true;
+    }
+    return s_level;
+}
+
+#    endif /* AWS_CHECKSUMS_FIXED_ISA */
+
+static uint32_t s_byte_table_entry(uint32_t index, uint32_t poly) {
+    uint32_t crc = index;
+    for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+    }
+    return crc;
+}
+
+static void s_fill_tables(struct pshufb_tables *tables, uint32_t poly) {
+    for (uint32_t n = 0; n < 16; ++n) {
+        uint32_t lo = s_byte_table_entry(n, poly);
+        uint32_t hi = s_byte_table_entry(n << 4, poly);
+        for (int j = 0; j < 4; ++j) {
+            tables->nibbles.lo[j][n] = (uint8_t)(lo >> (8 * j));
+            tables->nibbles.hi[j][n] = (uint8_t)(hi >> (8 * j));
+        }
+    }
+
+    uint32_t lane_shift = aws_checksums_x2nmodp(8 * AWS_CHECKSUMS_PSHUFB_LANE_BYTES, poly);
+    for (int k = 0; k < 4; ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            tables->shift[k][i] = aws_checksums_multmodp(i << (8 * k), lane_shift, poly);
+        }
+    }
+}
+
+static void s_init_tables(void *user_data) {
+    (void)user_data;
+    s_fill_tables(&s_crc32_tables, CRC32_POLYNOMIAL);
+    s_fill_tables(&s_crc32c_tables, CRC32C_POLYNOMIAL);
+}
+
+/* Lane i + 1 follows lane i in the input, so the block crc is every lane's crc carried over the lanes after it. */
+static uint32_t s_merge_lanes(const uint32_t *lane_crcs, int lane_count, const uint32_t shift[4][256]) {
+    uint32_t crc = lane_crcs[0];
+    for (int lane = 1; lane < lane_count; ++lane) {
+        crc = shift[0][crc & 0xff] ^ shift[1][(crc >> 8) & 0xff] ^ shift[2][(crc >> 16) & 0xff] ^
+              shift[3][crc >> 24] ^ lane_crcs[lane];
+    }
+    return crc;
+}
+
+static uint32_t s_crc_pshufb(
+    const uint8_t *input,
+    int length,
+    uint32_t previous_crc,
+    const struct pshufb_tables *tables,
+    uint32_t (*tail_fn)(const uint8_t *, int, uint32_t)) {
+
+    uint32_t crc = ~previous_crc;
+    uint32_t lane_crcs[32];
+
+    if (s_detect_level() == PSHUFB_AVX2) {
+        while (length >= PSHUFB_AVX2_BLOCK) {
+            memset(lane_crcs, 0, sizeof(lane_crcs));
+            lane_crcs[0] = crc;
+            aws_checksums_crc_pshufb_avx2_block(input, lane_crcs, &tables->nibbles);
+            crc = s_merge_lanes(lane_crcs, 32, tables->shift);
+            input += PSHUFB_AVX2_BLOCK;
+            length -= PSHUFB_AVX2_BLOCK;
+        }
+    }
+
+    while (length >= PSHUFB_SSSE3_BLOCK) {
+        memset(lane_crcs, 0, sizeof(lane_crcs));
+        lane_crcs[0] = crc;
+        aws_checksums_crc_pshufb_ssse3_block(input, lane_crcs, &tables->nibbles);
+        crc = s_merge_lanes(lane_crcs, 16, tables->shift);
+        input += PSHUFB_SSSE3_BLOCK;
+        length -= PSHUFB_SSSE3_BLOCK;
+    }
+
+    return tail_fn(input, length, ~crc);
+}
+
+bool aws_checksums_pshufb_is_available(void) {
+    return s_detect_level() != PSHUFB_NONE;
+}
+
+uint32_t aws_checksums_crc32_pshufb(const uint8_t *input, int length, uint32_t previousCrc32) {
+    if (length >= PSHUFB_SSSE3_BLOCK && s_detect_level() != PSHUFB_NONE) {
+        aws_thread_call_once(&s_tables_once, s_init_tables, NULL);
+        return s_crc_pshufb(input, length, previousCrc32, &s_crc32_tables, aws_checksums_crc32_sw);
+    }
+    return aws_checksums_crc32_sw(input, length, previousCrc32);
+}
+
+uint32_t aws_checksums_crc32c_pshufb(const uint8_t *input, int length, uint32_t previousCrc32) {
+    if (length >= PSHUFB_SSSE3_BLOCK && s_detect_level() != PSHUFB_NONE) {
+        aws_thread_call_once(&s_tables_once, s_init_tables, NULL);
+        return s_crc_pshufb(input, length, previousCrc32, &s_crc32c_tables, aws_checksums_crc32c_sw);
+    }
+    return aws_checksums_crc32c_sw(input, length, previousCrc32);
+}
+
+#else
+
+bool aws_checksums_pshufb_is_available(void) {
+    return false;
+}
+
+uint32_t aws_checksums_crc32_pshufb(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32_sw(input, length, previousCrc32);
+}
+
+uint32_t aws_checksums_crc32c_pshufb(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32c_sw(input, length, previousCrc32);
+}
+
+#endif /* AWS_CHECKSUMS_HAVE_PSHUFB */
@@ -0,0 +1,204 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_util.h>
+#include <aws/checksums/rolling.h>
+
+#include <aws/common/common.h>
+
+#include <string.h>
+
+/*
+ * The window is tracked as the raw crc register of its bytes, started from 0 and never inverted, which is linear in
+ * the data: appending a byte is the usual table step, and the byte that falls out of the window is removed by xoring
+ * in its own raw crc shifted over window_size bytes (out_table). The crc of the window with the usual inversions
+ * differs from the raw register by a constant, the crc of window_size zero bytes.
+ */
+struct aws_checksums_rolling_crc {
+    struct aws_allocator *allocator;
+    struct aws_checksums_rolling_crc_options options;
+    aws_checksums_crc_fn *crc;
+    uint32_t in_table[256];
+    uint32_t out_table[256];
+    uint32_t zero_window_crc;
+    uint32_t reg;
+    /* the last window_size bytes seen, oldest at position */
+    uint8_t *window;
+    uint32_t position;
+    /* the chunk in progress */
+    uint64_t chunk_offset;
+    uint64_t chunk_length;
+    uint32_t chunk_crc;
+};
+
+struct aws_checksums_rolling_crc *aws_checksums_rolling_crc_new(
+    struct aws_allocator *allocator,
+    const struct aws_checksums_rolling_crc_options *options) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    uint32_t poly = 0;
+    if (aws_checksums_crc_select(options->algorithm, &crc, &poly)) {
+        return NULL;
+    }
+    if (options->window_size == 0 ||
+        (options->max_chunk_size && options->max_chunk_size < options->min_chunk_size)) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    struct aws_checksums_rolling_crc *rolling = aws_mem_calloc(allocator, 1, sizeof(struct aws_checksums_rolling_crc));
+    if (!rolling) {
+        return NULL;
+    }
+    rolling->window = aws_mem_acquire(allocator, options->window_size);
+    if (!rolling->window) {
+        aws_mem_release(allocator, rolling);
+        return NULL;
+    }
+
+    rolling->allocator = allocator;
+    rolling->options = *options;
+    rolling->crc = crc;
+
+    uint32_t window_shift = aws_checksums_x2nmodp((uint64_t)options->window_size << 3, poly);
+    for (uint32_t n = 0; n < 256; ++n) {
+        uint32_t reg = n;
+        for (int bit = 0; bit < 8; ++bit) {
+            reg = reg & 1 ? (reg >> 1) ^ poly : reg >> 1;
+        }
+        rolling->in_table[n] = reg;
+        rolling->out_table[n] = aws_checksums_multmodp(window_shift, reg, poly);
+    }
+    /* the zero window leaves the all-ones starting register shifted over window_size bytes, then inverted */
+    rolling->zero_window_crc = ~aws_checksums_multmodp(window_shift, 0xFFFFFFFF, poly);
+
+    aws_checksums_rolling_crc_reset(rolling);
+    return rolling;
+}
+
+void aws_checksums_rolling_crc_destroy(struct aws_checksums_rolling_crc *rolling) {
+    if (!rolling) {
+        return;
+    }
+    aws_mem_release(rolling->allocator, rolling->window);
+    aws_mem_release(rolling->allocator, rolling);
+}
+
+void aws_checksums_rolling_crc_reset(struct aws_checksums_rolling_crc *rolling) {
+    memset(rolling->window, 0, rolling->options.window_size);
+    rolling->position = 0;
+    rolling->reg = 0;
+    rolling->chunk_offset = 0;
+    rolling->chunk_length = 0;
+    rolling->chunk_crc = 0;
+}
+
+/* the byte that leaves the window when input[i] comes in */
+static inline uint8_t s_leaving_byte(const struct aws_checksums_rolling_crc *rolling, const uint8_t *input, size_t i) {
+    const uint32_t window_size = rolling->options.window_size;
+    if (i >= window_size) {
+        return input[i - window_size];
+    }
+    size_t index = rolling->position + i;
+    if (index >= window_size) {
+        index -= window_size;
+    }
+    return rolling->window[index];
+}
+
+/* keeps the last window_size bytes after consumed bytes of input went through */
+static void s_save_window(struct aws_checksums_rolling_crc *rolling, const uint8_t *input, size_t consumed) {
+    const uint32_t window_size = rolling->options.window_size;
+    if (consumed >= window_size) {
+        memcpy(rolling->window, input + consumed - window_size, window_size);
+        rolling->position = 0;
+        return;
+    }
+    for (size_t i = 0; i < consumed; ++i) {
+        rolling->window[rolling->position] = input[i];
+        if (++rolling->position == window_size) {
+            rolling->position = 0;
+        }
+    }
+}
+
+uint32_t aws_checksums_rolling_crc_update(
+    struct aws_checksums_rolling_crc *rolling,
+    const uint8_t *input,
+    size_t length) {
+
+    uint32_t reg = rolling->reg;
+    for (size_t i = 0; i < length; ++i) {
+        uint8_t in = input[i];
+        reg = (reg >> 8) ^ rolling->in_table[(reg ^ in) & 0xff] ^ rolling->out_table[s_leaving_byte(rolling, input, i)];
+    }
+    s_save_window(rolling, input, length);
+    rolling->reg = reg;
+    return reg ^ rolling->zero_window_crc;
+}
+
+size_t aws_checksums_rolling_crc_find_chunks(
+    struct aws_checksums_rolling_crc *rolling,
+    const uint8_t *input,
+    size_t length,
+    struct aws_checksums_chunk *chunks,
+    size_t chunk_capacity,
+    size_t *out_chunk_count) {
+
+    const uint32_t mask = rolling->options.boundary_mask;
+    /* (window crc & mask) == 0, on the raw register */
+    const uint32_t target = rolling->zero_window_crc & mask;
+    const uint64_t min_chunk_size = rolling->options.min_chunk_size;
+    const uint64_t max_chunk_size = rolling->options.max_chunk_size;
+
+    uint32_t reg = rolling->reg;
+    uint64_t chunk_length = rolling->chunk_length;
+    size_t chunk_count = 0;
+    /* start of the bytes of this call not yet in chunk_crc */
+    size_t segment_start = 0;
+    size_t i = 0;
+
+    while (i < length && chunk_count < chunk_capacity) {
+        uint8_t in = input[i];
+        reg = (reg >> 8) ^ rolling->in_table[(reg ^ in) & 0xff] ^ rolling->out_table[s_leaving_byte(rolling, input, i)];
+        ++i;
+        ++chunk_length;
+
+        if ((chunk_length >= min_chunk_size && (reg & mask) == target) || chunk_length == max_chunk_size) {
+            struct aws_checksums_chunk *chunk = &chunks[chunk_count++];
+            chunk->offset = rolling->chunk_offset;
+            chunk->length = chunk_length;
+            chunk->crc =
+                aws_checksums_crc_update(rolling->crc, input + segment_start, i - segment_start, rolling->chunk_crc);
+
+            rolling->chunk_offset += chunk_length;
+            rolling->chunk_crc = 0;
+            chunk_length = 0;
+            segment_start = i;
+        }
+    }
+
+    rolling->chunk_crc =
+        aws_checksums_crc_update(rolling->crc, input + segment_start, i - segment_start, rolling->chunk_crc);
+    rolling->chunk_length = chunk_length;
+    rolling->reg = reg;
+    s_save_window(rolling, input, i);
+
+    *out_chunk_count = chunk_count;
+    return i;
+}
+
+bool aws_checksums_rolling_crc_finish(
+    struct aws_checksums_rolling_crc *rolling,
+    struct aws_checksums_chunk *out_chunk) {
+
+    bool has_chunk = rolling->chunk_length != 0;
+    if (has_chunk) {
+        out_chunk->offset = rolling->chunk_offset;
+        out_chunk->length = rolling->chunk_length;
+        out_chunk->crc = rolling->chunk_crc;
+    }
+    aws_checksums_rolling_crc_reset(rolling);
+    return has_chunk;
+}
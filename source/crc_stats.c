@@ -0,0 +1,129 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_stats.h>
+
+#include <aws/common/common.h>
+
+static const char *s_kernel_names[AWS_CHECKSUMS_KERNEL_COUNT] = {
+    [AWS_CHECKSUMS_KERNEL_SW] = "sw",
+    [AWS_CHECKSUMS_KERNEL_HW] = "hw",
+    [AWS_CHECKSUMS_KERNEL_PSHUFB] = "pshufb",
+    [AWS_CHECKSUMS_KERNEL_CLMUL] = "clmul",
+};
+
+const char *aws_checksums_kernel_name(enum aws_checksums_kernel kernel) {
+    if ((int)kernel < 0 || kernel >= AWS_CHECKSUMS_KERNEL_COUNT) {
+        return "unknown";
+    }
+    return s_kernel_names[kernel];
+}
+
+#ifdef AWS_CHECKSUMS_ENABLE_STATS
+
+#    include <aws/common/atomics.h>
+#    include <aws/common/math.h>
+#    include <aws/common/mutex.h>
+#    include <aws/common/thread.h>
+
+/*
+ * Every thread gets its own block of counters the first time it records a call. Only the owning thread writes to
+ * a block (relaxed load + store, no read-modify-write), so recording never contends; the snapshot walks the list of
+ * blocks and sums them. Blocks are never freed since thread exit can't be observed portably, which bounds the memory
+ * by the number of threads that ever checksummed (a few KiB each).
+ */
+struct thread_counters {
+    struct aws_atomic_var calls;
+    struct aws_atomic_var bytes;
+    struct aws_atomic_var size_class_calls[AWS_CHECKSUMS_STATS_SIZE_CLASSES];
+};
+
+struct thread_stats {
+    struct thread_counters counters[AWS_CHECKSUMS_CRC_ALGORITHM_COUNT][AWS_CHECKSUMS_KERNEL_COUNT];
+    struct thread_stats *next;
+};
+
+static struct aws_mutex s_registry_lock = AWS_MUTEX_INIT;
+static struct thread_stats *s_registry_head;
+
+static AWS_THREAD_LOCAL struct thread_stats *tl_stats;
+
+static struct thread_stats *s_register_thread(void) {
+    struct thread_stats *stats = aws_mem_calloc(aws_default_allocator(), 1, sizeof(struct thread_stats));
+
+    aws_mutex_lock(&s_registry_lock);
+    stats->next = s_registry_head;
+    s_registry_head = stats;
+    aws_mutex_unlock(&s_registry_lock);
+
+    tl_stats = stats;
+    return stats;
+}
+
+static inline size_t s_size_class(int length) {
+    /* bit length of the call size, 0 stays in class 0 */
+    return 32 - aws_clz_u32((uint32_t)length);
+}
+
+static inline void s_bump(struct aws_atomic_var *counter, size_t amount) {
+    size_t value = aws_atomic_load_int_explicit(counter, aws_memory_order_relaxed);
+    aws_atomic_store_int_explicit(counter, value + amount, aws_memory_order_relaxed);
+}
+
+void aws_checksums_stats_record(
+    enum aws_checksums_crc_algorithm algorithm,
+    enum aws_checksums_kernel kernel,
+    int length) {
+
+    struct thread_stats *stats = tl_stats;
+    if (AWS_UNLIKELY(!stats)) {
+        stats = s_register_thread();
+    }
+
+    if (length < 0) {
+        length = 0;
+    }
+
+    struct thread_counters *counters = &stats->counters[algorithm][kernel];
+    s_bump(&counters->calls, 1);
+    s_bump(&counters->bytes, (size_t)length);
+    s_bump(&counters->size_class_calls[s_size_class(length)], 1);
+}
+
+int aws_checksums_stats_snapshot(struct aws_checksums_stats *out) {
+    if (!out) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    AWS_ZERO_STRUCT(*out);
+
+    aws_mutex_lock(&s_registry_lock);
+    for (struct thread_stats *stats = s_registry_head; stats; stats = stats->next) {
+        for (size_t algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+            for (size_t kernel = 0; kernel < AWS_CHECKSUMS_KERNEL_COUNT; ++kernel) {
+                struct thread_counters *counters = &stats->counters[algorithm][kernel];
+                struct aws_checksums_kernel_stats *totals = &out->kernels[algorithm][kernel];
+
+                totals->calls += aws_atomic_load_int_explicit(&counters->calls, aws_memory_order_relaxed);
+                totals->bytes += aws_atomic_load_int_explicit(&counters->bytes, aws_memory_order_relaxed);
+                for (size_t i = 0; i < AWS_CHECKSUMS_STATS_SIZE_CLASSES; ++i) {
+                    totals->size_class_calls[i] +=
+                        aws_atomic_load_int_explicit(&counters->size_class_calls[i], aws_memory_order_relaxed);
+                }
+            }
+        }
+    }
+    aws_mutex_unlock(&s_registry_lock);
+
+    return AWS_OP_SUCCESS;
+}
+
+#else
+
+int aws_checksums_stats_snapshot(struct aws_checksums_stats *out) {
+    (void)out;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+#endif /* AWS_CHECKSUMS_ENABLE_STATS */
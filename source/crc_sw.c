@@ -3,13 +3,13 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 #include <aws/checksums/private/crc_priv.h>
-#include <stddef.h>
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/thread.h>
 
-/* The Ethernet, gzip, et.al CRC32 polynomial (reverse of 0x04C11DB7) */
-#define CRC32_POLYNOMIAL 0xEDB88320
+#include <stddef.h>
 
-/* The Castagnoli, iSCSI CRC32c polynomial (reverse of 0x1EDC6F41) */
-#define CRC32C_POLYNOMIAL 0x82F63B78
+#ifndef AWS_CHECKSUMS_COMPACT_TABLES
 
 /** CRC32 (Ethernet, gzip) lookup table for slice-by-4/8/16 */
 const uint32_t CRC32_TABLE[16][256] = {
@@ -1105,11 +1105,68 @@ const uint32_t CRC32C_TABLE[16][256] = {
         0x5A26B1E2, 0xA82ABC1C, 0xBBD2DCEF, 0x49DED111, 0x9C221D09, 0x6E2E10F7, 0x7DD67004, 0x8FDA7DFA  /* [15][0x100]*/
     }};
 
+static inline const uint32_t *s_crc32_table(void) {
+    return &CRC32_TABLE[0][0];
+}
+
+static inline const uint32_t *s_crc32c_table(void) {
+    return &CRC32C_TABLE[0][0];
+}
+
+#else
+
+/*
+ * Compact table build (AWS_CHECKSUMS_COMPACT_TABLES): instead of the 32 KiB of slice-by-16 tables above, only the
+ * four slices slice-by-4 needs are kept, generated on first use into 8 KiB of bss, so nothing is paged in or pulled
+ * into the caches until the software path actually runs. Every length is handled by slice-by-4, the slice-by-8/16
+ * and braided kernels are compiled out.
+ */
+#    define CRC_COMPACT_SLICES 4
+
+static uint32_t s_crc32_compact_table[CRC_COMPACT_SLICES][256];
+static uint32_t s_crc32c_compact_table[CRC_COMPACT_SLICES][256];
+static aws_thread_once s_compact_tables_once = AWS_THREAD_ONCE_STATIC_INIT;
+
+static void s_fill_compact_table(uint32_t table[CRC_COMPACT_SLICES][256], uint32_t poly) {
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+        }
+        table[0][i] = crc;
+    }
+
+    /* slice k advances a byte over k more zero bytes */
+    for (int k = 1; k < CRC_COMPACT_SLICES; ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t previous = table[k - 1][i];
+            table[k][i] = (previous >> 8) ^ table[0][previous & 0xff];
+        }
+    }
+}
+
+static void s_init_compact_tables(void *user_data) {
+    (void)user_data;
+    s_fill_compact_table(s_crc32_compact_table, CRC32_POLYNOMIAL);
+    s_fill_compact_table(s_crc32c_compact_table, CRC32C_POLYNOMIAL);
+}
+
+static inline const uint32_t *s_crc32_table(void) {
+    aws_thread_call_once(&s_compact_tables_once, s_init_compact_tables, NULL);
+    return &s_crc32_compact_table[0][0];
+}
+
+static inline const uint32_t *s_crc32c_table(void) {
+    aws_thread_call_once(&s_compact_tables_once, s_init_compact_tables, NULL);
+    return &s_crc32c_compact_table[0][0];
+}
+
+#endif /* AWS_CHECKSUMS_COMPACT_TABLES */
+
 /* private (static) function factoring out byte-by-byte CRC computation using just one slice of the lookup table*/
 static uint32_t s_crc_generic_sb1(const uint8_t *input, int length, uint32_t crc, const uint32_t *table_ptr) {
-    uint32_t(*table)[16][256] = (uint32_t(*)[16][256])table_ptr;
     while (length-- > 0) {
-        crc = (crc >> 8) ^ (*table)[0][(crc & 0xff) ^ *input++];
+        crc = (crc >> 8) ^ table_ptr[(crc & 0xff) ^ *input++];
     }
     return crc;
 }
@@ -1146,18 +1203,20 @@ static inline uint32_t s_crc_generic_align(
 static uint32_t s_crc_generic_sb4(const uint8_t *input, int length, uint32_t crc, const uint32_t *table_ptr) {
     const uint32_t *current = (const uint32_t *)input;
     int remaining = length;
-    uint32_t(*table)[16][256] = (uint32_t(*)[16][256])table_ptr;
+    /* only the first 4 slices are read, so this also runs on the compact tables */
+    const uint32_t(*table)[256] = (const uint32_t(*)[256])table_ptr;
 
     while (remaining >= 4) {
         crc ^= *current++;
-        crc = (*table)[3][crc & 0xff] ^ (*table)[2][(crc >> 8) & 0xff] ^ (*table)[1][(crc >> 16) & 0xff] ^
-              (*table)[0][crc >> 24];
+        crc = table[3][crc & 0xff] ^ table[2][(crc >> 8) & 0xff] ^ table[1][(crc >> 16) & 0xff] ^ table[0][crc >> 24];
         remaining -= 4;
     }
 
     return s_crc_generic_sb1(&input[length - remaining], remaining, crc, table_ptr);
 }
 
+#ifndef AWS_CHECKSUMS_COMPACT_TABLES
+
 /* private (static) function to compute a generic slice-by-8 CRC using the specified lookup table (8 table slices)*/
 static uint32_t s_crc_generic_sb8(const uint8_t *input, int length, uint32_t crc, const uint32_t *table_ptr) {
     const uint32_t *current = (const uint32_t *)input;
@@ -1203,56 +1262,203 @@ static uint32_t s_crc_generic_sb16(const uint8_t *input, int length, uint32_t cr
     return s_crc_generic_sb4(&input[length - remaining], remaining, crc, table_ptr);
 }
 
+/*
+ * Braided kernel, after zlib's crc32.c. The input is treated as CRC_BRAID_N interleaved streams of 8 byte words, each
+ * running its own crc, so the table lookups of the N streams are independent and can be in flight at the same time
+ * instead of forming the single dependency chain of slice-by-16. Braid table k folds byte k of a word forward over
+ * the N words each stream skips (table[k][i] = i * x^(8 * (N * 8 + 3 - k)) mod p), and the last block merges the
+ * streams back into one crc with the byte-wise table. Tables are 8 KiB per polynomial, generated on first use.
+ */
+#define CRC_BRAID_N 5
+#define CRC_BRAID_W 8
+#define CRC_BRAID_BLOCK (CRC_BRAID_N * CRC_BRAID_W)
+
+/* Merging the streams costs a serial pass over the last block, so slice-by-16 stays ahead on short inputs. The
+ * crossover measured (aws-checksums-benchmark, x86-64) between 512 and 768 bytes. */
+#define CRC_BRAID_MIN_LENGTH 768
+
+static uint32_t s_crc32_braid_table[CRC_BRAID_W][256];
+static uint32_t s_crc32c_braid_table[CRC_BRAID_W][256];
+static aws_thread_once s_braid_tables_once = AWS_THREAD_ONCE_STATIC_INIT;
+
+static void s_fill_braid_table(uint32_t table[CRC_BRAID_W][256], uint32_t poly) {
+    for (int k = 0; k < CRC_BRAID_W; ++k) {
+        uint32_t shift = aws_checksums_x2nmodp((uint64_t)(CRC_BRAID_BLOCK + 3 - k) << 3, poly);
+        table[k][0] = 0;
+        /* the entries are linear in i, so only the single bit ones need a multiply, the rest are xors of those */
+        for (uint32_t bit = 1; bit < 256; bit <<= 1) {
+            table[k][bit] = aws_checksums_multmodp(bit << 24, shift, poly);
+        }
+        for (uint32_t i = 3; i < 256; ++i) {
+            uint32_t low_bit = i & (0u - i);
+            table[k][i] = table[k][low_bit] ^ table[k][i ^ low_bit];
+        }
+    }
+}
+
+static void s_init_braid_tables(void *user_data) {
+    (void)user_data;
+    s_fill_braid_table(s_crc32_braid_table, CRC32_POLYNOMIAL);
+    s_fill_braid_table(s_crc32c_braid_table, CRC32C_POLYNOMIAL);
+}
+
+/* runs one word through the byte-wise table, returning the crc of the word appended to a zero crc */
+static inline uint32_t s_crc_word(uint64_t data, const uint32_t *table_ptr) {
+    for (int k = 0; k < CRC_BRAID_W; ++k) {
+        data = (data >> 8) ^ table_ptr[data & 0xff];
+    }
+    return (uint32_t)data;
+}
+
+/* folds one word of a stream forward by a block, spelled out since the loop form is left rolled at -O2 */
+static inline uint32_t s_braid_word(uint64_t word, const uint32_t (*braid)[256]) {
+    return braid[0][word & 0xff] ^ braid[1][(word >> 8) & 0xff] ^ braid[2][(word >> 16) & 0xff] ^
+           braid[3][(word >> 24) & 0xff] ^ braid[4][(word >> 32) & 0xff] ^ braid[5][(word >> 40) & 0xff] ^
+           braid[6][(word >> 48) & 0xff] ^ braid[7][word >> 56];
+}
+
+/* private (static) function to compute a generic braided CRC, input must be 8 byte aligned and hold at least one
+ * CRC_BRAID_BLOCK */
+static uint32_t s_crc_generic_braid(
+    const uint8_t *input,
+    int length,
+    uint32_t crc,
+    const uint32_t *table_ptr,
+    const uint32_t (*braid)[256]) {
+
+    const uint64_t *words = (const uint64_t *)input;
+    int blocks = length / CRC_BRAID_BLOCK;
+    int remaining = length - blocks * CRC_BRAID_BLOCK;
+
+    uint32_t crc0 = crc;
+    uint32_t crc1 = 0;
+    uint32_t crc2 = 0;
+    uint32_t crc3 = 0;
+    uint32_t crc4 = 0;
+
+    while (--blocks) {
+        uint64_t word0 = crc0 ^ words[0];
+        uint64_t word1 = crc1 ^ words[1];
+        uint64_t word2 = crc2 ^ words[2];
+        uint64_t word3 = crc3 ^ words[3];
+        uint64_t word4 = crc4 ^ words[4];
+        words += CRC_BRAID_N;
+
+        crc0 = s_braid_word(word0, braid);
+        crc1 = s_braid_word(word1, braid);
+        crc2 = s_braid_word(word2, braid);
+        crc3 = s_braid_word(word3, braid);
+        crc4 = s_braid_word(word4, braid);
+    }
+
+    /* the last block carries each stream's crc into the next word, leaving a single crc */
+    crc = s_crc_word(crc0 ^ words[0], table_ptr);
+    crc = s_crc_word(crc1 ^ words[1] ^ crc, table_ptr);
+    crc = s_crc_word(crc2 ^ words[2] ^ crc, table_ptr);
+    crc = s_crc_word(crc3 ^ words[3] ^ crc, table_ptr);
+    crc = s_crc_word(crc4 ^ words[4] ^ crc, table_ptr);
+    words += CRC_BRAID_N;
+
+    return s_crc_generic_sb16((const uint8_t *)words, remaining, crc, table_ptr);
+}
+
+/* Processes unaligned leading bytes one at a time until input is 8 byte aligned, like s_crc_generic_align. */
+static inline uint32_t s_crc_generic_align8(
+    const uint8_t **input,
+    int *length,
+    uint32_t crc,
+    const uint32_t *table_ptr) {
+
+    int leading = (int)((CRC_BRAID_W - ((size_t)*input & (CRC_BRAID_W - 1))) & (CRC_BRAID_W - 1));
+    if (leading) {
+        crc = s_crc_generic_sb1(*input, leading, crc, table_ptr);
+        *input += leading;
+        *length -= leading;
+    }
+    return crc;
+}
+
+#endif /* AWS_CHECKSUMS_COMPACT_TABLES */
+
 static uint32_t s_crc32_no_slice(const uint8_t *input, int length, uint32_t previousCrc32) {
-    return ~s_crc_generic_sb1(input, length, ~previousCrc32, &CRC32_TABLE[0][0]);
+    return ~s_crc_generic_sb1(input, length, ~previousCrc32, s_crc32_table());
 }
 
 /* Computes CRC32 (Ethernet, gzip, et. al.) using slice-by-4. */
 static uint32_t s_crc32_sb4(const uint8_t *input, int length, uint32_t previousCrc32) {
-    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, &CRC32_TABLE[0][0]);
-    return ~s_crc_generic_sb4(input, length, crc, &CRC32_TABLE[0][0]);
+    const uint32_t *table = s_crc32_table();
+    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, table);
+    return ~s_crc_generic_sb4(input, length, crc, table);
 }
 
+#ifndef AWS_CHECKSUMS_COMPACT_TABLES
+
 /* Computes CRC32 (Ethernet, gzip, et. al.) using slice-by-8. */
 static uint32_t s_crc32_sb8(const uint8_t *input, int length, uint32_t previousCrc32) {
-    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, &CRC32_TABLE[0][0]);
-    return ~s_crc_generic_sb8(input, length, crc, &CRC32_TABLE[0][0]);
+    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, s_crc32_table());
+    return ~s_crc_generic_sb8(input, length, crc, s_crc32_table());
 }
 
 /* Computes CRC32 (Ethernet, gzip, et. al.) using slice-by-16. */
 static uint32_t s_crc32_sb16(const uint8_t *input, int length, uint32_t previousCrc32) {
-    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, &CRC32_TABLE[0][0]);
-    return ~s_crc_generic_sb16(input, length, crc, &CRC32_TABLE[0][0]);
+    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, s_crc32_table());
+    return ~s_crc_generic_sb16(input, length, crc, s_crc32_table());
 }
 
+/* Computes CRC32 (Ethernet, gzip, et. al.) using the braided kernel, length must be at least CRC_BRAID_MIN_LENGTH. */
+static uint32_t s_crc32_braid(const uint8_t *input, int length, uint32_t previousCrc32) {
+    aws_thread_call_once(&s_braid_tables_once, s_init_braid_tables, NULL);
+    uint32_t crc = s_crc_generic_align8(&input, &length, ~previousCrc32, s_crc32_table());
+    return ~s_crc_generic_braid(input, length, crc, s_crc32_table(), (const uint32_t(*)[256])s_crc32_braid_table);
+}
+
+#endif /* AWS_CHECKSUMS_COMPACT_TABLES */
+
 static uint32_t s_crc32c_no_slice(const uint8_t *input, int length, uint32_t previousCrc32c) {
-    return ~s_crc_generic_sb1(input, length, ~previousCrc32c, &CRC32C_TABLE[0][0]);
+    return ~s_crc_generic_sb1(input, length, ~previousCrc32c, s_crc32c_table());
 }
 
 /* Computes the Castagnoli CRC32c (iSCSI) using slice-by-4. */
 static uint32_t s_crc32c_sb4(const uint8_t *input, int length, uint32_t previousCrc32) {
-    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, &CRC32C_TABLE[0][0]);
-    return ~s_crc_generic_sb4(input, length, crc, &CRC32C_TABLE[0][0]);
+    const uint32_t *table = s_crc32c_table();
+    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, table);
+    return ~s_crc_generic_sb4(input, length, crc, table);
 }
 
+#ifndef AWS_CHECKSUMS_COMPACT_TABLES
+
 /* Computes the Castagnoli CRC32c (iSCSI) using slice-by-8. */
 static uint32_t s_crc32c_sb8(const uint8_t *input, int length, uint32_t previousCrc32) {
-    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, &CRC32C_TABLE[0][0]);
-    return ~s_crc_generic_sb8(input, length, crc, &CRC32C_TABLE[0][0]);
+    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, s_crc32c_table());
+    return ~s_crc_generic_sb8(input, length, crc, s_crc32c_table());
 }
 
 /* Computes the Castagnoli CRC32c (iSCSI) using slice-by-16. */
 static uint32_t s_crc32c_sb16(const uint8_t *input, int length, uint32_t previousCrc32) {
-    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, &CRC32C_TABLE[0][0]);
-    return ~s_crc_generic_sb16(input, length, crc, &CRC32C_TABLE[0][0]);
+    uint32_t crc = s_crc_generic_align(&input, &length, ~previousCrc32, s_crc32c_table());
+    return ~s_crc_generic_sb16(input, length, crc, s_crc32c_table());
+}
+
+/* Computes the Castagnoli CRC32c (iSCSI) using the braided kernel, length must be at least CRC_BRAID_MIN_LENGTH. */
+static uint32_t s_crc32c_braid(const uint8_t *input, int length, uint32_t previousCrc32) {
+    aws_thread_call_once(&s_braid_tables_once, s_init_braid_tables, NULL);
+    uint32_t crc = s_crc_generic_align8(&input, &length, ~previousCrc32, s_crc32c_table());
+    return ~s_crc_generic_braid(input, length, crc, s_crc32c_table(), (const uint32_t(*)[256])s_crc32c_braid_table);
 }
 
+#endif /* AWS_CHECKSUMS_COMPACT_TABLES */
+
 /**
  * Computes the Ethernet, gzip CRC32 of the specified data buffer.
  * Pass 0 in the previousCrc32 parameter as an initial value unless continuing to update a running crc in a subsequent
  * call
  */
 uint32_t aws_checksums_crc32_sw(const uint8_t *input, int length, uint32_t previousCrc32) {
+#ifndef AWS_CHECKSUMS_COMPACT_TABLES
+    if (length >= CRC_BRAID_MIN_LENGTH) {
+        return s_crc32_braid(input, length, previousCrc32);
+    }
+
     if (length >= 16) {
         return s_crc32_sb16(input, length, previousCrc32);
     }
@@ -1260,6 +1466,7 @@ uint32_t aws_checksums_crc32_sw(const uint8_t *input, int length, uint32_t previ
     if (length >= 8) {
         return s_crc32_sb8(input, length, previousCrc32);
     }
+#endif
 
     if (length >= 4) {
         return s_crc32_sb4(input, length, previousCrc32);
@@ -1274,6 +1481,11 @@ uint32_t aws_checksums_crc32_sw(const uint8_t *input, int length, uint32_t previ
  * call
  */
 uint32_t aws_checksums_crc32c_sw(const uint8_t *input, int length, uint32_t previousCrc32c) {
+#ifndef AWS_CHECKSUMS_COMPACT_TABLES
+    if (length >= CRC_BRAID_MIN_LENGTH) {
+        return s_crc32c_braid(input, length, previousCrc32c);
+    }
+
     if (length >= 16) {
         return s_crc32c_sb16(input, length, previousCrc32c);
     }
@@ -1281,6 +1493,7 @@ uint32_t aws_checksums_crc32c_sw(const uint8_t *input, int length, uint32_t prev
     if (length >= 8) {
         return s_crc32c_sb8(input, length, previousCrc32c);
     }
+#endif
 
     if (length >= 4) {
         return s_crc32c_sb4(input, length, previousCrc32c);
@@ -1288,3 +1501,25 @@ uint32_t aws_checksums_crc32c_sw(const uint8_t *input, int length, uint32_t prev
 
     return s_crc32c_no_slice(input, length, previousCrc32c);
 }
+
+void aws_checksums_crc32c_hash_keys_sw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+    for (size_t i = 0; i < count; ++i) {
+        hashes[i] = aws_checksums_crc32c_sw(keys, (int)key_size, seed);
+        keys += key_size;
+    }
+}
+
+void aws_checksums_crc32c_multi_sw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+    for (size_t i = 0; i < count; ++i) {
+        crcs[i] = aws_checksums_crc32c_sw(buffers[i], (int)lengths[i], 0);
+    }
+}
@@ -0,0 +1,244 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_trace.h>
+
+#include <aws/common/common.h>
+
+static const uint8_t s_trace_magic[4] = {'A', 'C', 'K', 'T'};
+
+/* the algorithm lives in the top two bits of the record's first byte, the alignment in the low six */
+#define TRACE_ALIGNMENT_MASK 0x3F
+#define TRACE_ALGORITHM_SHIFT 6
+
+static size_t s_encode_varint(uint64_t value, uint8_t *out) {
+    size_t written = 0;
+    while (value >= 0x80) {
+        out[written++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[written++] = (uint8_t)value;
+    return written;
+}
+
+/* Reads a varint of at most max_bytes at offset into input without consuming it, size receives the encoded size. */
+static int s_decode_varint(
+    const struct aws_byte_cursor *input,
+    size_t offset,
+    size_t max_bytes,
+    uint64_t *value,
+    size_t *size) {
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < max_bytes; ++i) {
+        if (offset + i >= input->len) {
+            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+        }
+        uint8_t byte = input->ptr[offset + i];
+        result |= (uint64_t)(byte & 0x7F) << (7 * i);
+        if (!(byte & 0x80)) {
+            *value = result;
+            *size = i + 1;
+            return AWS_OP_SUCCESS;
+        }
+    }
+    return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+}
+
+int aws_checksums_trace_encode_header(struct aws_byte_buf *output) {
+    if (output->capacity - output->len < AWS_CHECKSUMS_TRACE_HEADER_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    aws_byte_buf_write(output, s_trace_magic, sizeof(s_trace_magic));
+    aws_byte_buf_write_u8(output, AWS_CHECKSUMS_TRACE_VERSION);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_trace_encode_record(
+    const struct aws_checksums_trace_record *record,
+    struct aws_byte_buf *output) {
+
+    if ((int)record->algorithm < 0 || record->algorithm >= AWS_CHECKSUMS_CRC_ALGORITHM_COUNT) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    uint8_t encoded[AWS_CHECKSUMS_TRACE_RECORD_MAX_SIZE];
+    size_t size = 0;
+    encoded[size++] =
+        (uint8_t)((record->algorithm << TRACE_ALGORITHM_SHIFT) | (record->alignment & TRACE_ALIGNMENT_MASK));
+    size += s_encode_varint(record->length, encoded + size);
+    size += s_encode_varint(record->inter_arrival_ns, encoded + size);
+
+    if (output->capacity - output->len < size) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    aws_byte_buf_write(output, encoded, size);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_trace_decode_header(struct aws_byte_cursor *input) {
+    if (input->len < AWS_CHECKSUMS_TRACE_HEADER_SIZE) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+    if (memcmp(input->ptr, s_trace_magic, sizeof(s_trace_magic)) ||
+        input->ptr[sizeof(s_trace_magic)] != AWS_CHECKSUMS_TRACE_VERSION) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    aws_byte_cursor_advance(input, AWS_CHECKSUMS_TRACE_HEADER_SIZE);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_trace_decode_record(
+    struct aws_byte_cursor *input,
+    struct aws_checksums_trace_record *record) {
+
+    if (input->len < 1) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    uint8_t tag = input->ptr[0];
+    size_t offset = 1;
+    uint64_t length = 0;
+    uint64_t inter_arrival_ns = 0;
+    size_t size = 0;
+
+    if (s_decode_varint(input, offset, 5, &length, &size)) {
+        return AWS_OP_ERR;
+    }
+    offset += size;
+    if (s_decode_varint(input, offset, 10, &inter_arrival_ns, &size)) {
+        return AWS_OP_ERR;
+    }
+    offset += size;
+
+    if ((tag >> TRACE_ALGORITHM_SHIFT) >= AWS_CHECKSUMS_CRC_ALGORITHM_COUNT || length > UINT32_MAX) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    record->algorithm = (enum aws_checksums_crc_algorithm)(tag >> TRACE_ALGORITHM_SHIFT);
+    record->alignment = tag & TRACE_ALIGNMENT_MASK;
+    record->length = (uint32_t)length;
+    record->inter_arrival_ns = inter_arrival_ns;
+    aws_byte_cursor_advance(input, offset);
+    return AWS_OP_SUCCESS;
+}
+
+#ifdef AWS_CHECKSUMS_ENABLE_TRACE
+
+#    include <aws/common/atomics.h>
+#    include <aws/common/clock.h>
+#    include <aws/common/file.h>
+#    include <aws/common/mutex.h>
+
+#    include <stdio.h>
+
+#    define TRACE_BUFFER_SIZE (64 * 1024)
+
+/*
+ * Records are encoded into a static buffer under s_trace_lock and written out whenever it fills up. The lock
+ * serializes every traced call, which is fine for an instrumented capture build but is why none of this is compiled
+ * in by default. s_recording lets the entry points skip the lock entirely while no trace is running.
+ */
+static struct aws_mutex s_trace_lock = AWS_MUTEX_INIT;
+static struct aws_atomic_var s_recording = AWS_ATOMIC_INIT_INT(0);
+static FILE *s_trace_file;
+static uint8_t s_trace_storage[TRACE_BUFFER_SIZE];
+static struct aws_byte_buf s_trace_buffer;
+static uint64_t s_last_call_ns;
+static bool s_write_failed;
+
+/* must be called with s_trace_lock held */
+static void s_flush_locked(void) {
+    if (s_trace_buffer.len &&
+        fwrite(s_trace_buffer.buffer, 1, s_trace_buffer.len, s_trace_file) != s_trace_buffer.len) {
+        s_write_failed = true;
+    }
+    s_trace_buffer.len = 0;
+}
+
+void aws_checksums_trace_record_call(enum aws_checksums_crc_algorithm algorithm, const uint8_t *input, int length) {
+    if (!aws_atomic_load_int_explicit(&s_recording, aws_memory_order_relaxed)) {
+        return;
+    }
+
+    /* timestamp before taking the lock, so contention doesn't show up as inter-arrival time */
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+
+    aws_mutex_lock(&s_trace_lock);
+    if (s_trace_file) {
+        struct aws_checksums_trace_record record = {
+            .algorithm = algorithm,
+            .alignment = (uint8_t)((uintptr_t)input & TRACE_ALIGNMENT_MASK),
+            .length = length > 0 ? (uint32_t)length : 0,
+            .inter_arrival_ns = now > s_last_call_ns ? now - s_last_call_ns : 0,
+        };
+        s_last_call_ns = now > s_last_call_ns ? now : s_last_call_ns;
+
+        if (s_trace_buffer.capacity - s_trace_buffer.len < AWS_CHECKSUMS_TRACE_RECORD_MAX_SIZE) {
+            s_flush_locked();
+        }
+        aws_checksums_trace_encode_record(&record, &s_trace_buffer);
+    }
+    aws_mutex_unlock(&s_trace_lock);
+}
+
+int aws_checksums_trace_start(const char *path) {
+    if (!path) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    aws_mutex_lock(&s_trace_lock);
+    if (s_trace_file) {
+        aws_mutex_unlock(&s_trace_lock);
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    s_trace_file = aws_fopen(path, "wb");
+    if (!s_trace_file) {
+        aws_mutex_unlock(&s_trace_lock);
+        return AWS_OP_ERR;
+    }
+
+    s_trace_buffer = aws_byte_buf_from_empty_array(s_trace_storage, sizeof(s_trace_storage));
+    aws_checksums_trace_encode_header(&s_trace_buffer);
+    s_write_failed = false;
+    aws_high_res_clock_get_ticks(&s_last_call_ns);
+    aws_atomic_store_int_explicit(&s_recording, 1, aws_memory_order_relaxed);
+    aws_mutex_unlock(&s_trace_lock);
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_trace_stop(void) {
+    aws_mutex_lock(&s_trace_lock);
+    if (!s_trace_file) {
+        aws_mutex_unlock(&s_trace_lock);
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+
+    aws_atomic_store_int_explicit(&s_recording, 0, aws_memory_order_relaxed);
+    s_flush_locked();
+    if (fclose(s_trace_file)) {
+        s_write_failed = true;
+    }
+    s_trace_file = NULL;
+    bool write_failed = s_write_failed;
+    aws_mutex_unlock(&s_trace_lock);
+
+    return write_failed ? aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE) : AWS_OP_SUCCESS;
+}
+
+#else
+
+int aws_checksums_trace_start(const char *path) {
+    (void)path;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+int aws_checksums_trace_stop(void) {
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+#endif /* AWS_CHECKSUMS_ENABLE_TRACE */
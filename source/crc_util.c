@@ -0,0 +1,86 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_util.h>
+
+#include <aws/common/common.h>
+
+#include <limits.h>
+
+uint32_t aws_checksums_multmodp(uint32_t a, uint32_t b, uint32_t poly) {
+    uint32_t m = (uint32_t)1 << 31;
+    uint32_t product = 0;
+
+    while (m) {
+        if (a & m) {
+            product ^= b;
+            if (!(a & (m - 1))) {
+                break;
+            }
+        }
+        m >>= 1;
+        /* b *= x */
+        b = (b & 1) ? (b >> 1) ^ poly : b >> 1;
+    }
+
+    return product;
+}
+
+uint32_t aws_checksums_x2nmodp(uint64_t n, uint32_t poly) {
+    /* x^0 */
+    uint32_t product = (uint32_t)1 << 31;
+    /* x^(2^k), starting from x^1 */
+    uint32_t square = (uint32_t)1 << 30;
+
+    while (n) {
+        if (n & 1) {
+            product = aws_checksums_multmodp(square, product, poly);
+        }
+        n >>= 1;
+        square = aws_checksums_multmodp(square, square, poly);
+    }
+
+    return product;
+}
+
+int aws_checksums_crc_select(
+    enum aws_checksums_crc_algorithm algorithm,
+    aws_checksums_crc_fn **out_crc,
+    uint32_t *out_poly) {
+
+    aws_checksums_crc_fn *crc = NULL;
+    uint32_t poly = 0;
+    switch (algorithm) {
+        case AWS_CHECKSUMS_CRC32:
+            crc = aws_checksums_crc32;
+            poly = CRC32_POLYNOMIAL;
+            break;
+        case AWS_CHECKSUMS_CRC32C:
+            crc = aws_checksums_crc32c;
+            poly = CRC32C_POLYNOMIAL;
+            break;
+        default:
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    *out_crc = crc;
+    if (out_poly) {
+        *out_poly = poly;
+    }
+    return AWS_OP_SUCCESS;
+}
+
+uint32_t aws_checksums_crc_update(
+    aws_checksums_crc_fn *crc,
+    const uint8_t *input,
+    size_t length,
+    uint32_t previous_crc) {
+
+    while (length > INT_MAX) {
+        previous_crc = crc(input, INT_MAX, previous_crc);
+        input += INT_MAX;
+        length -= INT_MAX;
+    }
+    return crc(input, (int)length, previous_crc);
+}
@@ -16,3 +16,20 @@ uint32_t aws_checksums_crc32c_hw(const uint8_t *input, int length, uint32_t prev
 uint32_t aws_checksums_crc32_hw(const uint8_t *input, int length, uint32_t previousCrc32) {
     return aws_checksums_crc32_sw(input, length, previousCrc32);
 }
+
+void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+    aws_checksums_crc32c_hash_keys_sw(keys, key_size, count, seed, hashes);
+}
+
+void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+    aws_checksums_crc32c_multi_sw(buffers, lengths, count, crcs);
+}
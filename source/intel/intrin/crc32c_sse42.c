@@ -0,0 +1,254 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/private/crc_priv.h>
+#include <aws/checksums/private/crc_probes.h>
+
+#include <aws/common/cpuid.h>
+
+#include <string.h>
+
+/*
+ * The SSE4.2 crc32c kernel. Built with -msse4.2 -mpclmul, or with the AWS_CHECKSUMS_FIXED_ISA flags alone in a fixed
+ * ISA build, where a target without the instructions gets the software fallbacks at the bottom instead.
+ */
+#if defined(__x86_64__) && defined(__SSE4_2__)
+
+#    include <nmmintrin.h>
+
+static inline uint64_t s_load_u64(const uint8_t *input) {
+    uint64_t value;
+    memcpy(&value, input, sizeof(value));
+    return value;
+}
+
+#    if defined(__PCLMUL__)
+
+#        include <wmmintrin.h>
+
+/*
+ * Computes the Castagnoli CRC32c (iSCSI) of a block of length0 + length1 + length2 bytes (each a multiple of 8) as
+ * three stripes side by side. Each crc32 instruction has a latency of 3 cycles but the unit takes a new one every
+ * cycle, so the stripes keep it busy where a single stream would stall on its own result. The first stripe carries on
+ * from crc, the other two start from 0. The first two are then shifted into place with a carry-less multiply, by k1
+ * over the length1 + length2 bytes after the first stripe and by k2 over the length2 bytes after the second, and
+ * reduced with one more crc32 before the three are merged. Note: this function does NOT invert bits of the input crc
+ * or return value.
+ */
+static inline uint32_t s_crc32c_3_stripes(
+    const uint8_t *input,
+    uint32_t crc,
+    size_t length0,
+    size_t length1,
+    size_t length2,
+    uint32_t k1,
+    uint32_t k2) {
+
+    const uint8_t *stripe1 = input + length0;
+    const uint8_t *stripe2 = stripe1 + length1;
+    size_t common = length0 < length1 ? length0 : length1;
+    common = length2 < common ? length2 : common;
+
+    uint64_t crc0 = crc;
+    uint64_t crc1 = 0;
+    uint64_t crc2 = 0;
+    size_t offset = 0;
+    for (; offset < common; offset += 8) {
+        crc0 = _mm_crc32_u64(crc0, s_load_u64(input + offset));
+        crc1 = _mm_crc32_u64(crc1, s_load_u64(stripe1 + offset));
+        crc2 = _mm_crc32_u64(crc2, s_load_u64(stripe2 + offset));
+    }
+    for (size_t i = offset; i < length0; i += 8) {
+        crc0 = _mm_crc32_u64(crc0, s_load_u64(input + i));
+    }
+    for (size_t i = offset; i < length1; i += 8) {
+        crc1 = _mm_crc32_u64(crc1, s_load_u64(stripe1 + i));
+    }
+    for (size_t i = offset; i < length2; i += 8) {
+        crc2 = _mm_crc32_u64(crc2, s_load_u64(stripe2 + i));
+    }
+
+    __m128i shifted0 = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)crc0), _mm_cvtsi32_si128((int)k1), 0x00);
+    __m128i shifted1 = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)crc1), _mm_cvtsi32_si128((int)k2), 0x00);
+    crc0 = _mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(shifted0));
+    crc1 = _mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(shifted1));
+    return (uint32_t)(crc0 ^ crc1 ^ crc2);
+}
+
+/* 256 byte blocks, in stripes of 88, 88 and 80 bytes */
+static inline uint32_t s_crc32c_sse42_clmul_256(const uint8_t *input, uint32_t crc) {
+    return s_crc32c_3_stripes(input, crc, 88, 88, 80, 0x1b3d8f29, 0x39d3b296);
+}
+
+/* 1024 byte blocks, in stripes of 344, 336 and 344 bytes */
+static inline uint32_t s_crc32c_sse42_clmul_1024(const uint8_t *input, uint32_t crc) {
+    return s_crc32c_3_stripes(input, crc, 344, 336, 344, 0xe417f38a, 0x8f158014);
+}
+
+/* 3072 byte blocks, in stripes of 1024 bytes */
+static inline uint32_t s_crc32c_sse42_clmul_3072(const uint8_t *input, uint32_t crc) {
+    return s_crc32c_3_stripes(input, crc, 1024, 1024, 1024, 0xa51b6135, 0x170076fa);
+}
+
+#        if defined(AWS_CHECKSUMS_FIXED_ISA)
+/* fixed ISA build for a cpu with CLMUL, nothing to detect */
+static const bool detected_clmul = true;
+#        else
+static bool detection_performed = false;
+static bool detected_clmul = false;
+#        endif
+
+#    endif /* __PCLMUL__ */
+
+/*
+ * Computes the Castagnoli CRC32c (iSCSI) of the specified data buffer using the Intel CRC32Q (64-bit quad word) and
+ * PCLMULQDQ machine instructions (if present).
+ * Handles data that isn't 8-byte aligned as well as any trailing data with the CRC32B (byte) instruction.
+ * Pass 0 in the previousCrc32 parameter as an initial value unless continuing to update a running CRC in a subsequent
+ * call.
+ */
+uint32_t aws_checksums_crc32c_hw(const uint8_t *input, int length, uint32_t previousCrc32) {
+
+#    if defined(__PCLMUL__) && !defined(AWS_CHECKSUMS_FIXED_ISA)
+    if (AWS_UNLIKELY(!detection_performed)) {
+        detected_clmul = aws_cpu_has_feature(AWS_CPU_FEATURE_CLMUL);
+        /* Simply setting the flag true to skip HW detection next time
+           Not using memory barriers since the worst that can
+           happen is a fallback to the non HW accelerated code. */
+        detection_performed = true;
+    }
+#    endif
+
+    uint32_t crc = ~previousCrc32;
+
+    /* For small input, forget about alignment checks - simply compute the CRC32c one byte at a time */
+    if (AWS_UNLIKELY(length < 8)) {
+        AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_BYTE, length);
+        while (length-- > 0) {
+            crc = _mm_crc32_u8(crc, *input++);
+        }
+        return ~crc;
+    }
+
+    /* Get the 8-byte memory alignment of our input buffer by looking at the least significant 3 bits */
+    int input_alignment = (int)((uintptr_t)input & 0x7);
+
+    /* Compute the number of unaligned bytes before the first aligned 8-byte chunk (will be in the range 0-7) */
+    int leading = (8 - input_alignment) & 0x7;
+
+    /* reduce the length by the leading unaligned bytes we are about to process */
+    length -= leading;
+
+    /* spin through the leading unaligned input bytes (if any) one-by-one */
+    for (int i = 0; i < leading; ++i) {
+        crc = _mm_crc32_u8(crc, *input++);
+    }
+
+#    if defined(__PCLMUL__)
+    /* Using likely to keep this code inlined */
+    if (AWS_LIKELY(detected_clmul)) {
+
+        AWS_CHECKSUMS_PROBE_KERNEL_TIER(
+            AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_CLMUL_3072, length - length % 3072);
+        while (AWS_LIKELY(length >= 3072)) {
+            /* Compute crc32c on each block, chaining each crc result */
+            crc = s_crc32c_sse42_clmul_3072(input, crc);
+            input += 3072;
+            length -= 3072;
+        }
+        AWS_CHECKSUMS_PROBE_KERNEL_TIER(
+            AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_CLMUL_1024, length - length % 1024);
+        while (AWS_LIKELY(length >= 1024)) {
+            /* Compute crc32c on each block, chaining each crc result */
+            crc = s_crc32c_sse42_clmul_1024(input, crc);
+            input += 1024;
+            length -= 1024;
+        }
+        AWS_CHECKSUMS_PROBE_KERNEL_TIER(
+            AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_CLMUL_256, length - length % 256);
+        while (AWS_LIKELY(length >= 256)) {
+            /* Compute crc32c on each block, chaining each crc result */
+            crc = s_crc32c_sse42_clmul_256(input, crc);
+            input += 256;
+            length -= 256;
+        }
+    }
+#    endif
+
+    /* Spin through remaining (aligned) 8-byte chunks using the CRC32Q quad word instruction */
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_QWORD, length & ~7);
+    uint64_t crc64 = crc;
+    while (AWS_LIKELY(length >= 8)) {
+        crc64 = _mm_crc32_u64(crc64, s_load_u64(input));
+        input += 8;
+        length -= 8;
+    }
+    crc = (uint32_t)crc64;
+
+    /* Finish up with any trailing bytes using the CRC32B single byte instruction one-by-one */
+    /* the byte tier reports the leading and trailing bytes together, so it fires once per call like the others */
+    AWS_CHECKSUMS_PROBE_KERNEL_TIER(AWS_CHECKSUMS_CRC32C, AWS_CHECKSUMS_PROBE_TIER_BYTE, leading + length);
+    while (length-- > 0) {
+        crc = _mm_crc32_u8(crc, *input++);
+    }
+
+    return ~crc;
+}
+
+#    define AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc, word) ((uint32_t)_mm_crc32_u64((crc), (word)))
+#    define AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc, byte) _mm_crc32_u8((crc), (byte))
+#    include <aws/checksums/private/crc32c_lanes.h>
+
+void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+
+    aws_checksums_crc32c_lanes_hash_keys(keys, key_size, count, seed, hashes);
+}
+
+void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+
+    aws_checksums_crc32c_lanes_multi(buffers, lengths, count, crcs);
+}
+
+uint32_t aws_checksums_crc32_hw(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32_sw(input, length, previousCrc32);
+}
+
+#else
+
+uint32_t aws_checksums_crc32_hw(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32_sw(input, length, previousCrc32);
+}
+
+uint32_t aws_checksums_crc32c_hw(const uint8_t *input, int length, uint32_t previousCrc32) {
+    return aws_checksums_crc32c_sw(input, length, previousCrc32);
+}
+
+void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+    aws_checksums_crc32c_hash_keys_sw(keys, key_size, count, seed, hashes);
+}
+
+void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+    aws_checksums_crc32c_multi_sw(buffers, lengths, count, crcs);
+}
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/private/crc_fold.h>
+
+#include <immintrin.h>
+
+/* block * x^d mod p ^ next, in each 128 bit lane; 0x96 is the truth table of a three way xor */
+static inline __m512i s_fold_xor(__m512i block, __m512i k, __m512i next) {
+    return _mm512_ternarylogic_epi64(
+        _mm512_clmulepi64_epi128(block, k, 0x00), _mm512_clmulepi64_epi128(block, k, 0x11), next, 0x96);
+}
+
+static inline __m128i s_fold(__m128i block, __m128i k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(block, k, 0x00), _mm_clmulepi64_si128(block, k, 0x11));
+}
+
+static inline __m512i s_load(const uint8_t *input) {
+    return _mm512_loadu_si512((const void *)input);
+}
+
+static inline __m512i s_broadcast(const uint64_t pair[2]) {
+    return _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)pair));
+}
+
+size_t aws_checksums_crc_fold_avx512(
+    const uint8_t *input,
+    size_t length,
+    uint32_t crc,
+    const struct aws_checksums_fold_constants *constants,
+    uint8_t remainder[16]) {
+
+    const uint8_t *start = input;
+
+    __m512i crc_block = _mm512_inserti32x4(_mm512_setzero_si512(), _mm_cvtsi32_si128((int)crc), 0);
+    __m512i x0 = _mm512_xor_si512(s_load(input), crc_block);
+    __m512i x1 = s_load(input + 64);
+    __m512i x2 = s_load(input + 128);
+    __m512i x3 = s_load(input + 192);
+    input += 256;
+    length -= 256;
+
+    /* 16 independent 128 bit streams, 256 bytes apart */
+    __m512i k = s_broadcast(constants->fold_2048);
+    while (length >= 256) {
+        x0 = s_fold_xor(x0, k, s_load(input));
+        x1 = s_fold_xor(x1, k, s_load(input + 64));
+        x2 = s_fold_xor(x2, k, s_load(input + 128));
+        x3 = s_fold_xor(x3, k, s_load(input + 192));
+        input += 256;
+        length -= 256;
+    }
+
+    k = s_broadcast(constants->fold_512);
+    x1 = s_fold_xor(x0, k, x1);
+    x2 = s_fold_xor(x1, k, x2);
+    x3 = s_fold_xor(x2, k, x3);
+
+    while (length >= 64) {
+        x3 = s_fold_xor(x3, k, s_load(input));
+        input += 64;
+        length -= 64;
+    }
+
+    /* the four lanes of the last accumulator are consecutive blocks, fold them onto the last one */
+    __m128i x = _mm512_extracti32x4_epi32(x3, 3);
+    x = _mm_xor_si128(
+        x, s_fold(_mm512_extracti32x4_epi32(x3, 0), _mm_loadu_si128((const __m128i *)constants->fold_384)));
+    x = _mm_xor_si128(
+        x, s_fold(_mm512_extracti32x4_epi32(x3, 1), _mm_loadu_si128((const __m128i *)constants->fold_256)));
+    x = _mm_xor_si128(
+        x, s_fold(_mm512_extracti32x4_epi32(x3, 2), _mm_loadu_si128((const __m128i *)constants->fold_128)));
+
+    __m128i k128 = _mm_loadu_si128((const __m128i *)constants->fold_128);
+    while (length >= 16) {
+        x = _mm_xor_si128(s_fold(x, k128), _mm_loadu_si128((const __m128i *)input));
+        input += 16;
+        length -= 16;
+    }
+
+    _mm_storeu_si128((__m128i *)remainder, x);
+    return (size_t)(input - start);
+}
@@ -0,0 +1,60 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/private/crc_fold.h>
+
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+/* block * x^d mod p, for the pair of remainders in k */
+static inline __m128i s_fold(__m128i block, __m128i k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(block, k, 0x00), _mm_clmulepi64_si128(block, k, 0x11));
+}
+
+static inline __m128i s_load(const uint8_t *input) {
+    return _mm_loadu_si128((const __m128i *)input);
+}
+
+size_t aws_checksums_crc_fold_clmul(
+    const uint8_t *input,
+    size_t length,
+    uint32_t crc,
+    const struct aws_checksums_fold_constants *constants,
+    uint8_t remainder[16]) {
+
+    const uint8_t *start = input;
+
+    __m128i x0 = _mm_xor_si128(s_load(input), _mm_cvtsi32_si128((int)crc));
+    __m128i x1 = s_load(input + 16);
+    __m128i x2 = s_load(input + 32);
+    __m128i x3 = s_load(input + 48);
+    input += 64;
+    length -= 64;
+
+    /* four independent streams 64 bytes apart, so the multiplies of one iteration don't wait on each other */
+    __m128i k = _mm_loadu_si128((const __m128i *)constants->fold_512);
+    while (length >= 64) {
+        x0 = _mm_xor_si128(s_fold(x0, k), s_load(input));
+        x1 = _mm_xor_si128(s_fold(x1, k), s_load(input + 16));
+        x2 = _mm_xor_si128(s_fold(x2, k), s_load(input + 32));
+        x3 = _mm_xor_si128(s_fold(x3, k), s_load(input + 48));
+        input += 64;
+        length -= 64;
+    }
+
+    x3 = _mm_xor_si128(x3, s_fold(x0, _mm_loadu_si128((const __m128i *)constants->fold_384)));
+    x3 = _mm_xor_si128(x3, s_fold(x1, _mm_loadu_si128((const __m128i *)constants->fold_256)));
+    x3 = _mm_xor_si128(x3, s_fold(x2, _mm_loadu_si128((const __m128i *)constants->fold_128)));
+
+    k = _mm_loadu_si128((const __m128i *)constants->fold_128);
+    while (length >= 16) {
+        x3 = _mm_xor_si128(s_fold(x3, k), s_load(input));
+        input += 16;
+        length -= 16;
+    }
+
+    _mm_storeu_si128((__m128i *)remainder, x3);
+    return (size_t)(input - start);
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/private/crc_pshufb.h>
+
+#include <immintrin.h>
+
+/*
+ * The SSSE3 kernel (crc_pshufb_ssse3.c) widened to 32 lanes. vpunpck and vpshufb work within 128-bit halves, so row
+ * i carries lane i in its low half and lane 16 + i in its high half and the same transpose and byte step apply to
+ * both halves; byte k of a plane is then lane k.
+ */
+#define INTERLEAVE_ROWS(dst, src)                                                                                      \
+    (dst)[0] = _mm256_unpacklo_epi8((src)[0], (src)[8]);                                                               \
+    (dst)[1] = _mm256_unpackhi_epi8((src)[0], (src)[8]);                                                               \
+    (dst)[2] = _mm256_unpacklo_epi8((src)[1], (src)[9]);                                                               \
+    (dst)[3] = _mm256_unpackhi_epi8((src)[1], (src)[9]);                                                               \
+    (dst)[4] = _mm256_unpacklo_epi8((src)[2], (src)[10]);                                                              \
+    (dst)[5] = _mm256_unpackhi_epi8((src)[2], (src)[10]);                                                              \
+    (dst)[6] = _mm256_unpacklo_epi8((src)[3], (src)[11]);                                                              \
+    (dst)[7] = _mm256_unpackhi_epi8((src)[3], (src)[11]);                                                              \
+    (dst)[8] = _mm256_unpacklo_epi8((src)[4], (src)[12]);                                                              \
+    (dst)[9] = _mm256_unpackhi_epi8((src)[4], (src)[12]);                                                              \
+    (dst)[10] = _mm256_unpacklo_epi8((src)[5], (src)[13]);                                                             \
+    (dst)[11] = _mm256_unpackhi_epi8((src)[5], (src)[13]);                                                             \
+    (dst)[12] = _mm256_unpacklo_epi8((src)[6], (src)[14]);                                                             \
+    (dst)[13] = _mm256_unpackhi_epi8((src)[6], (src)[14]);                                                             \
+    (dst)[14] = _mm256_unpacklo_epi8((src)[7], (src)[15]);                                                             \
+    (dst)[15] = _mm256_unpackhi_epi8((src)[7], (src)[15])
+
+/* 32 byte lookups of one byte plane of T[index_lo | index_hi << 4] */
+static inline __m256i s_lookup(__m256i lo, __m256i hi, __m256i index_lo, __m256i index_hi) {
+    return _mm256_xor_si256(_mm256_shuffle_epi8(lo, index_lo), _mm256_shuffle_epi8(hi, index_hi));
+}
+
+/* One byte step for 32 lanes, see crc_pshufb_ssse3.c. */
+#define CRC_STEP(bytes)                                                                                                \
+    do {                                                                                                               \
+        __m256i index = _mm256_xor_si256(p0, (bytes));                                                                 \
+        __m256i index_lo = _mm256_and_si256(index, nibble_mask);                                                       \
+        __m256i index_hi = _mm256_and_si256(_mm256_srli_epi16(index, 4), nibble_mask);                                 \
+        p0 = _mm256_xor_si256(p1, s_lookup(lo0, hi0, index_lo, index_hi));                                             \
+        p1 = _mm256_xor_si256(p2, s_lookup(lo1, hi1, index_lo, index_hi));                                             \
+        p2 = _mm256_xor_si256(p3, s_lookup(lo2, hi2, index_lo, index_hi));                                             \
+        p3 = s_lookup(lo3, hi3, index_lo, index_hi);                                                                   \
+    } while (0)
+
+void aws_checksums_crc_pshufb_avx2_block(
+    const uint8_t *input,
+    uint32_t lane_crcs[32],
+    const struct aws_checksums_nibble_tables *tables) {
+
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    const __m256i lo0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->lo[0]));
+    const __m256i lo1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->lo[1]));
+    const __m256i lo2 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->lo[2]));
+    const __m256i lo3 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->lo[3]));
+    const __m256i hi0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->hi[0]));
+    const __m256i hi1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->hi[1]));
+    const __m256i hi2 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->hi[2]));
+    const __m256i hi3 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tables->hi[3]));
+
+    uint8_t plane_bytes[4][32];
+    for (int lane = 0; lane < 32; ++lane) {
+        for (int j = 0; j < 4; ++j) {
+            plane_bytes[j][lane] = (uint8_t)(lane_crcs[lane] >> (8 * j));
+        }
+    }
+    __m256i p0 = _mm256_loadu_si256((const __m256i *)plane_bytes[0]);
+    __m256i p1 = _mm256_loadu_si256((const __m256i *)plane_bytes[1]);
+    __m256i p2 = _mm256_loadu_si256((const __m256i *)plane_bytes[2]);
+    __m256i p3 = _mm256_loadu_si256((const __m256i *)plane_bytes[3]);
+
+    const uint8_t *high_lanes = input + 16 * AWS_CHECKSUMS_PSHUFB_LANE_BYTES;
+    for (int offset = 0; offset < AWS_CHECKSUMS_PSHUFB_LANE_BYTES; offset += 16) {
+        __m256i rows[16];
+        __m256i shuffled[16];
+        for (int lane = 0; lane < 16; ++lane) {
+            int lane_offset = lane * AWS_CHECKSUMS_PSHUFB_LANE_BYTES + offset;
+            rows[lane] = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(input + lane_offset))),
+                _mm_loadu_si128((const __m128i *)(high_lanes + lane_offset)),
+                1);
+        }
+        INTERLEAVE_ROWS(shuffled, rows);
+        INTERLEAVE_ROWS(rows, shuffled);
+        INTERLEAVE_ROWS(shuffled, rows);
+        INTERLEAVE_ROWS(rows, shuffled);
+
+        CRC_STEP(rows[0]);
+        CRC_STEP(rows[1]);
+        CRC_STEP(rows[2]);
+        CRC_STEP(rows[3]);
+        CRC_STEP(rows[4]);
+        CRC_STEP(rows[5]);
+        CRC_STEP(rows[6]);
+        CRC_STEP(rows[7]);
+        CRC_STEP(rows[8]);
+        CRC_STEP(rows[9]);
+        CRC_STEP(rows[10]);
+        CRC_STEP(rows[11]);
+        CRC_STEP(rows[12]);
+        CRC_STEP(rows[13]);
+        CRC_STEP(rows[14]);
+        CRC_STEP(rows[15]);
+    }
+
+    _mm256_storeu_si256((__m256i *)plane_bytes[0], p0);
+    _mm256_storeu_si256((__m256i *)plane_bytes[1], p1);
+    _mm256_storeu_si256((__m256i *)plane_bytes[2], p2);
+    _mm256_storeu_si256((__m256i *)plane_bytes[3], p3);
+    for (int lane = 0; lane < 32; ++lane) {
+        lane_crcs[lane] = (uint32_t)plane_bytes[0][lane] | (uint32_t)plane_bytes[1][lane] << 8 |
+                          (uint32_t)plane_bytes[2][lane] << 16 | (uint32_t)plane_bytes[3][lane] << 24;
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/private/crc_pshufb.h>
+
+#include <tmmintrin.h>
+
+/*
+ * Interleaves row i with row i + 8 for all 8 pairs (a perfect shuffle of the 256 bytes). Four rounds of it transpose
+ * 16 rows of 16 bytes, after which row t holds byte t of every input row. Spelled out, like the byte steps below,
+ * since compilers leave the loop forms rolled at -O2 and that halves the throughput.
+ */
+#define INTERLEAVE_ROWS(dst, src)                                                                                      \
+    (dst)[0] = _mm_unpacklo_epi8((src)[0], (src)[8]);                                                                  \
+    (dst)[1] = _mm_unpackhi_epi8((src)[0], (src)[8]);                                                                  \
+    (dst)[2] = _mm_unpacklo_epi8((src)[1], (src)[9]);                                                                  \
+    (dst)[3] = _mm_unpackhi_epi8((src)[1], (src)[9]);                                                                  \
+    (dst)[4] = _mm_unpacklo_epi8((src)[2], (src)[10]);                                                                 \
+    (dst)[5] = _mm_unpackhi_epi8((src)[2], (src)[10]);                                                                 \
+    (dst)[6] = _mm_unpacklo_epi8((src)[3], (src)[11]);                                                                 \
+    (dst)[7] = _mm_unpackhi_epi8((src)[3], (src)[11]);                                                                 \
+    (dst)[8] = _mm_unpacklo_epi8((src)[4], (src)[12]);                                                                 \
+    (dst)[9] = _mm_unpackhi_epi8((src)[4], (src)[12]);                                                                 \
+    (dst)[10] = _mm_unpacklo_epi8((src)[5], (src)[13]);                                                                \
+    (dst)[11] = _mm_unpackhi_epi8((src)[5], (src)[13]);                                                                \
+    (dst)[12] = _mm_unpacklo_epi8((src)[6], (src)[14]);                                                                \
+    (dst)[13] = _mm_unpackhi_epi8((src)[6], (src)[14]);                                                                \
+    (dst)[14] = _mm_unpacklo_epi8((src)[7], (src)[15]);                                                                \
+    (dst)[15] = _mm_unpackhi_epi8((src)[7], (src)[15])
+
+/* 16 byte lookups of one byte plane of T[index_lo | index_hi << 4] */
+static inline __m128i s_lookup(__m128i lo, __m128i hi, __m128i index_lo, __m128i index_hi) {
+    return _mm_xor_si128(_mm_shuffle_epi8(lo, index_lo), _mm_shuffle_epi8(hi, index_hi));
+}
+
+/*
+ * One byte step of crc = (crc >> 8) ^ T[(crc ^ byte) & 0xff] for 16 lanes at once. p0..p3 hold byte 0..3 of every
+ * lane's crc, so the shift by 8 is just a renaming of the planes.
+ */
+#define CRC_STEP(bytes)                                                                                                \
+    do {                                                                                                               \
+        __m128i index = _mm_xor_si128(p0, (bytes));                                                                    \
+        __m128i index_lo = _mm_and_si128(index, nibble_mask);                                                          \
+        __m128i index_hi = _mm_and_si128(_mm_srli_epi16(index, 4), nibble_mask);                                      \
+        p0 = _mm_xor_si128(p1, s_lookup(lo0, hi0, index_lo, index_hi));                                                \
+        p1 = _mm_xor_si128(p2, s_lookup(lo1, hi1, index_lo, index_hi));                                                \
+        p2 = _mm_xor_si128(p3, s_lookup(lo2, hi2, index_lo, index_hi));                                                \
+        p3 = s_lookup(lo3, hi3, index_lo, index_hi);                                                                   \
+    } while (0)
+
+void aws_checksums_crc_pshufb_ssse3_block(
+    const uint8_t *input,
+    uint32_t lane_crcs[16],
+    const struct aws_checksums_nibble_tables *tables) {
+
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i lo0 = _mm_loadu_si128((const __m128i *)tables->lo[0]);
+    const __m128i lo1 = _mm_loadu_si128((const __m128i *)tables->lo[1]);
+    const __m128i lo2 = _mm_loadu_si128((const __m128i *)tables->lo[2]);
+    const __m128i lo3 = _mm_loadu_si128((const __m128i *)tables->lo[3]);
+    const __m128i hi0 = _mm_loadu_si128((const __m128i *)tables->hi[0]);
+    const __m128i hi1 = _mm_loadu_si128((const __m128i *)tables->hi[1]);
+    const __m128i hi2 = _mm_loadu_si128((const __m128i *)tables->hi[2]);
+    const __m128i hi3 = _mm_loadu_si128((const __m128i *)tables->hi[3]);
+
+    uint8_t plane_bytes[4][16];
+    for (int lane = 0; lane < 16; ++lane) {
+        for (int j = 0; j < 4; ++j) {
+            plane_bytes[j][lane] = (uint8_t)(lane_crcs[lane] >> (8 * j));
+        }
+    }
+    __m128i p0 = _mm_loadu_si128((const __m128i *)plane_bytes[0]);
+    __m128i p1 = _mm_loadu_si128((const __m128i *)plane_bytes[1]);
+    __m128i p2 = _mm_loadu_si128((const __m128i *)plane_bytes[2]);
+    __m128i p3 = _mm_loadu_si128((const __m128i *)plane_bytes[3]);
+
+    for (int offset = 0; offset < AWS_CHECKSUMS_PSHUFB_LANE_BYTES; offset += 16) {
+        __m128i rows[16];
+        __m128i shuffled[16];
+        for (int lane = 0; lane < 16; ++lane) {
+            rows[lane] = _mm_loadu_si128((const __m128i *)(input + lane * AWS_CHECKSUMS_PSHUFB_LANE_BYTES + offset));
+        }
+        INTERLEAVE_ROWS(shuffled, rows);
+        INTERLEAVE_ROWS(rows, shuffled);
+        INTERLEAVE_ROWS(shuffled, rows);
+        INTERLEAVE_ROWS(rows, shuffled);
+
+        CRC_STEP(rows[0]);
+        CRC_STEP(rows[1]);
+        CRC_STEP(rows[2]);
+        CRC_STEP(rows[3]);
+        CRC_STEP(rows[4]);
+        CRC_STEP(rows[5]);
+        CRC_STEP(rows[6]);
+        CRC_STEP(rows[7]);
+        CRC_STEP(rows[8]);
+        CRC_STEP(rows[9]);
+        CRC_STEP(rows[10]);
+        CRC_STEP(rows[11]);
+        CRC_STEP(rows[12]);
+        CRC_STEP(rows[13]);
+        CRC_STEP(rows[14]);
+        CRC_STEP(rows[15]);
+    }
+
+    _mm_storeu_si128((__m128i *)plane_bytes[0], p0);
+    _mm_storeu_si128((__m128i *)plane_bytes[1], p1);
+    _mm_storeu_si128((__m128i *)plane_bytes[2], p2);
+    _mm_storeu_si128((__m128i *)plane_bytes[3], p3);
+    for (int lane = 0; lane < 16; ++lane) {
+        lane_crcs[lane] = (uint32_t)plane_bytes[0][lane] | (uint32_t)plane_bytes[1][lane] << 8 |
+                          (uint32_t)plane_bytes[2][lane] << 16 | (uint32_t)plane_bytes[3][lane] << 24;
+    }
+}
@@ -74,4 +74,46 @@ uint32_t aws_checksums_crc32c_hw(const uint8_t *data, int length, uint32_t previ
 uint32_t aws_checksums_crc32_hw(const uint8_t *input, int length, uint32_t previousCrc32) {
     return aws_checksums_crc32_sw(input, length, previousCrc32);
 }
+
+#    if defined(_M_X64)
+#        define AWS_CHECKSUMS_CRC32C_LANE_STEP_U64(crc, word) ((uint32_t)_mm_crc32_u64((crc), (word)))
+#        define AWS_CHECKSUMS_CRC32C_LANE_STEP_U8(crc, byte) _mm_crc32_u8((crc), (byte))
+#        include <aws/checksums/private/crc32c_lanes.h>
+
+void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+
+    aws_checksums_crc32c_lanes_hash_keys(keys, key_size, count, seed, hashes);
+}
+
+void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+
+    aws_checksums_crc32c_lanes_multi(buffers, lengths, count, crcs);
+}
+#    else
+void aws_checksums_crc32c_hash_keys_hw(
+    const uint8_t *keys,
+    size_t key_size,
+    size_t count,
+    uint32_t seed,
+    uint32_t *hashes) {
+    aws_checksums_crc32c_hash_keys_sw(keys, key_size, count, seed, hashes);
+}
+
+void aws_checksums_crc32c_multi_hw(
+    const uint8_t *const *buffers,
+    const size_t *lengths,
+    size_t count,
+    uint32_t *crcs) {
+    aws_checksums_crc32c_multi_sw(buffers, lengths, count, crcs);
+}
+#    endif
 #endif /* x64 || x86 */
@@ -0,0 +1,196 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_file_reader.h>
+
+#ifdef AWS_CHECKSUMS_HAVE_IO_URING
+
+#    include <aws/common/common.h>
+#    include <aws/common/math.h>
+
+#    include <errno.h>
+#    include <linux/io_uring.h>
+#    include <string.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+/*
+ * A minimal io_uring over the raw system calls, so there is no liburing dependency: one submission per read, and
+ * completions are reaped one at a time. Only the calling thread touches the ring.
+ */
+struct aws_checksums_uring {
+    struct aws_allocator *allocator;
+    int ring_fd;
+    int fd;
+
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    struct io_uring_sqe *sqes;
+
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    void *sq_ring;
+    size_t sq_ring_size;
+    void *cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+};
+
+static int s_setup(unsigned entries, struct io_uring_params *params) {
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int s_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+/* IORING_OP_READ needs Linux 5.6, the probe opcode arrived in the same release */
+static bool s_supports_read(int ring_fd) {
+    uint64_t storage[(sizeof(struct io_uring_probe) + (IORING_OP_READ + 1) * sizeof(struct io_uring_probe_op) + 7) / 8];
+    memset(storage, 0, sizeof(storage));
+    struct io_uring_probe *probe = (struct io_uring_probe *)storage;
+    if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, IORING_OP_READ + 1) < 0) {
+        return false;
+    }
+    return probe->last_op >= IORING_OP_READ && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+}
+
+static void s_unmap(struct aws_checksums_uring *ring) {
+    if (ring->sqes) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring && ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+}
+
+struct aws_checksums_uring *aws_checksums_uring_new(struct aws_allocator *allocator, int fd, size_t queue_depth) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int ring_fd = s_setup((unsigned)queue_depth, &params);
+    if (ring_fd < 0) {
+        return NULL;
+    }
+    if (!s_supports_read(ring_fd)) {
+        close(ring_fd);
+        return NULL;
+    }
+
+    struct aws_checksums_uring *ring = aws_mem_calloc(allocator, 1, sizeof(struct aws_checksums_uring));
+    if (!ring) {
+        close(ring_fd);
+        return NULL;
+    }
+    ring->allocator = allocator;
+    ring->ring_fd = ring_fd;
+    ring->fd = fd;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        ring->sq_ring_size = ring->cq_ring_size = aws_max_size(ring->sq_ring_size, ring->cq_ring_size);
+    }
+
+    void *sq_ring =
+        mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+        goto error;
+    }
+    ring->sq_ring = sq_ring;
+
+    void *cq_ring = sq_ring;
+    if (!single_mmap) {
+        cq_ring = mmap(
+            NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+        if (cq_ring == MAP_FAILED) {
+            goto error;
+        }
+    }
+    ring->cq_ring = cq_ring;
+
+    void *sqes =
+        mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        goto error;
+    }
+    ring->sqes = sqes;
+
+    uint8_t *sq = sq_ring;
+    uint8_t *cq = cq_ring;
+    ring->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(sq + params.sq_off.array);
+    ring->cq_head = (unsigned *)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+    return ring;
+
+error:
+    s_unmap(ring);
+    close(ring_fd);
+    aws_mem_release(allocator, ring);
+    return NULL;
+}
+
+int aws_checksums_uring_submit(struct aws_checksums_uring *ring, struct aws_checksums_read *read) {
+    /* the kernel only moves the head, the tail is ours */
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = ring->fd;
+    sqe->addr = (uint64_t)(uintptr_t)read->buffer;
+    sqe->len = (uint32_t)read->length;
+    sqe->off = read->offset;
+    sqe->user_data = (uint64_t)(uintptr_t)read;
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    int submitted;
+    do {
+        submitted = s_enter(ring->ring_fd, 1, 0, 0);
+    } while (submitted < 0 && errno == EINTR);
+    if (submitted != 1) {
+        return aws_translate_and_raise_io_error(submitted < 0 ? errno : EAGAIN);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_uring_wait(struct aws_checksums_uring *ring, struct aws_checksums_read **completed) {
+    /* the kernel only moves the tail, the head is ours */
+    unsigned head = *ring->cq_head;
+    while (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+        if (s_enter(ring->ring_fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+            return aws_translate_and_raise_io_error(errno);
+        }
+    }
+
+    struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+    struct aws_checksums_read *read = (struct aws_checksums_read *)(uintptr_t)cqe->user_data;
+    read->result = cqe->res;
+    __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+
+    *completed = read;
+    return AWS_OP_SUCCESS;
+}
+
+void aws_checksums_uring_destroy(struct aws_checksums_uring *ring) {
+    s_unmap(ring);
+    close(ring->ring_fd);
+    aws_mem_release(ring->allocator, ring);
+}
+
+#endif /* AWS_CHECKSUMS_HAVE_IO_URING */
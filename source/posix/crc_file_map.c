@@ -0,0 +1,67 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_file.h>
+
+#include <aws/common/common.h>
+#include <aws/common/file.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef O_CLOEXEC
+#    define O_CLOEXEC 0
+#endif
+
+int aws_checksums_file_map(const char *path, struct aws_checksums_file_mapping *mapping) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return aws_translate_and_raise_io_error(errno);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+        int error = errno;
+        close(fd);
+        return aws_translate_and_raise_io_error(error);
+    }
+
+    /* mmap can't represent an empty mapping, and pipes and devices have no size to map */
+    if (!S_ISREG(st.st_mode) || st.st_size <= 0 || (uint64_t)st.st_size > SIZE_MAX) {
+        close(fd);
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    size_t length = (size_t)st.st_size;
+    void *data = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+    /* the mapping keeps its own reference to the file */
+    close(fd);
+    if (data == MAP_FAILED) {
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    /* hints only: read-ahead in big windows and drop pages behind the scan, huge pages where the file system can */
+#ifdef MADV_SEQUENTIAL
+    madvise(data, length, MADV_SEQUENTIAL);
+#endif
+#ifdef MADV_HUGEPAGE
+    madvise(data, length, MADV_HUGEPAGE);
+#endif
+
+    mapping->data = data;
+    mapping->length = length;
+    return AWS_OP_SUCCESS;
+}
+
+void aws_checksums_file_unmap(struct aws_checksums_file_mapping *mapping) {
+    if (mapping->data) {
+        munmap((void *)mapping->data, mapping->length);
+        mapping->data = NULL;
+        mapping->length = 0;
+    }
+}
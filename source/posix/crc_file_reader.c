@@ -0,0 +1,286 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#ifndef _GNU_SOURCE
+/* O_DIRECT */
+#    define _GNU_SOURCE
+#endif
+
+#include <aws/checksums/private/crc_file_reader.h>
+
+#include <aws/common/common.h>
+#include <aws/common/condition_variable.h>
+#include <aws/common/file.h>
+#include <aws/common/mutex.h>
+#include <aws/common/thread.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef O_CLOEXEC
+#    define O_CLOEXEC 0
+#endif
+
+/* more threads than this stop adding device parallelism and only add context switches */
+#define PREAD_POOL_MAX_THREADS 16
+
+/*
+ * Without io_uring, reads run on a small pool of threads doing blocking pread()s: workers take reads off the pending
+ * list and put them on the completed list, both FIFO and guarded by one lock.
+ */
+struct pread_list {
+    struct aws_checksums_read *head;
+    struct aws_checksums_read *tail;
+};
+
+struct aws_checksums_file_reader {
+    struct aws_allocator *allocator;
+    int fd;
+
+#ifdef AWS_CHECKSUMS_HAVE_IO_URING
+    struct aws_checksums_uring *ring;
+#endif
+
+    struct aws_mutex lock;
+    struct aws_condition_variable work_available;
+    struct aws_condition_variable read_completed;
+    struct pread_list pending;
+    struct pread_list completed;
+    bool shutting_down;
+    struct aws_thread *threads;
+    size_t thread_count;
+};
+
+static void s_list_push(struct pread_list *list, struct aws_checksums_read *read) {
+    read->next = NULL;
+    if (list->tail) {
+        list->tail->next = read;
+    } else {
+        list->head = read;
+    }
+    list->tail = read;
+}
+
+static struct aws_checksums_read *s_list_pop(struct pread_list *list) {
+    struct aws_checksums_read *read = list->head;
+    list->head = read->next;
+    if (!list->head) {
+        list->tail = NULL;
+    }
+    return read;
+}
+
+static bool s_work_or_shutdown(void *arg) {
+    struct aws_checksums_file_reader *reader = arg;
+    return reader->pending.head || reader->shutting_down;
+}
+
+static bool s_has_completed(void *arg) {
+    struct aws_checksums_file_reader *reader = arg;
+    return reader->completed.head != NULL;
+}
+
+static void s_pread_worker(void *arg) {
+    struct aws_checksums_file_reader *reader = arg;
+
+    aws_mutex_lock(&reader->lock);
+    while (true) {
+        aws_condition_variable_wait_pred(&reader->work_available, &reader->lock, s_work_or_shutdown, reader);
+        if (!reader->pending.head) {
+            break;
+        }
+        struct aws_checksums_read *read = s_list_pop(&reader->pending);
+        aws_mutex_unlock(&reader->lock);
+
+        /* fill the whole request unless the file ends, the caller treats a short read as the end */
+        size_t total = 0;
+        int64_t result = 0;
+        while (total < read->length) {
+            ssize_t bytes =
+                pread(reader->fd, read->buffer + total, read->length - total, (off_t)(read->offset + total));
+            if (bytes < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                result = -errno;
+                break;
+            }
+            if (bytes == 0) {
+                break;
+            }
+            total += (size_t)bytes;
+        }
+        read->result = result < 0 ? result : (int64_t)total;
+
+        aws_mutex_lock(&reader->lock);
+        s_list_push(&reader->completed, read);
+        aws_condition_variable_notify_one(&reader->read_completed);
+    }
+    aws_mutex_unlock(&reader->lock);
+}
+
+static void s_stop_pool(struct aws_checksums_file_reader *reader) {
+    aws_mutex_lock(&reader->lock);
+    reader->shutting_down = true;
+    aws_condition_variable_notify_all(&reader->work_available);
+    aws_mutex_unlock(&reader->lock);
+
+    for (size_t i = 0; i < reader->thread_count; ++i) {
+        aws_thread_join(&reader->threads[i]);
+        aws_thread_clean_up(&reader->threads[i]);
+    }
+    reader->thread_count = 0;
+}
+
+static int s_start_pool(struct aws_checksums_file_reader *reader, size_t queue_depth) {
+    size_t thread_count = queue_depth < PREAD_POOL_MAX_THREADS ? queue_depth : PREAD_POOL_MAX_THREADS;
+    reader->threads = aws_mem_calloc(reader->allocator, thread_count, sizeof(struct aws_thread));
+    if (!reader->threads) {
+        return AWS_OP_ERR;
+    }
+
+    for (size_t i = 0; i < thread_count; ++i) {
+        aws_thread_init(&reader->threads[i], reader->allocator);
+        if (aws_thread_launch(&reader->threads[i], s_pread_worker, reader, aws_default_thread_options())) {
+            aws_thread_clean_up(&reader->threads[i]);
+            /* fewer workers only means fewer reads in flight, but none at all can't make progress */
+            if (i == 0) {
+                return AWS_OP_ERR;
+            }
+            break;
+        }
+        reader->thread_count = i + 1;
+    }
+    return AWS_OP_SUCCESS;
+}
+
+static int s_open(const char *path, bool direct_io, bool *opened_direct) {
+    *opened_direct = false;
+#ifdef O_DIRECT
+    if (direct_io) {
+        int fd = open(path, O_RDONLY | O_CLOEXEC | O_DIRECT);
+        if (fd >= 0) {
+            *opened_direct = true;
+            return fd;
+        }
+        /* file systems without O_DIRECT (tmpfs, some network mounts) refuse it with EINVAL, read through the cache */
+        if (errno != EINVAL) {
+            return -1;
+        }
+    }
+#else
+    (void)direct_io;
+#endif
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+struct aws_checksums_file_reader *aws_checksums_file_reader_new(
+    struct aws_allocator *allocator,
+    const char *path,
+    const struct aws_checksums_file_reader_options *options,
+    struct aws_checksums_file_reader_info *info) {
+
+    AWS_ZERO_STRUCT(*info);
+    int fd = s_open(path, options->direct_io, &info->direct_io);
+    if (fd < 0) {
+        aws_translate_and_raise_io_error(errno);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+        aws_translate_and_raise_io_error(errno);
+        close(fd);
+        return NULL;
+    }
+    if (S_ISREG(st.st_mode)) {
+        info->size = (uint64_t)st.st_size;
+    } else if (S_ISBLK(st.st_mode)) {
+        /* block devices report no st_size, but seeking to the end gives their capacity */
+        off_t end = lseek(fd, 0, SEEK_END);
+        if (end < 0) {
+            aws_translate_and_raise_io_error(errno);
+            close(fd);
+            return NULL;
+        }
+        info->size = (uint64_t)end;
+    } else {
+        close(fd);
+        aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+        return NULL;
+    }
+
+    struct aws_checksums_file_reader *reader = aws_mem_calloc(allocator, 1, sizeof(struct aws_checksums_file_reader));
+    if (!reader) {
+        close(fd);
+        return NULL;
+    }
+    reader->allocator = allocator;
+    reader->fd = fd;
+
+#ifdef AWS_CHECKSUMS_HAVE_IO_URING
+    if (options->io_uring) {
+        reader->ring = aws_checksums_uring_new(allocator, fd, options->queue_depth);
+        if (reader->ring) {
+            info->io_uring = true;
+            return reader;
+        }
+    }
+#endif
+
+    aws_mutex_init(&reader->lock);
+    aws_condition_variable_init(&reader->work_available);
+    aws_condition_variable_init(&reader->read_completed);
+    if (s_start_pool(reader, options->queue_depth)) {
+        aws_checksums_file_reader_destroy(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+int aws_checksums_file_reader_submit(struct aws_checksums_file_reader *reader, struct aws_checksums_read *read) {
+#ifdef AWS_CHECKSUMS_HAVE_IO_URING
+    if (reader->ring) {
+        return aws_checksums_uring_submit(reader->ring, read);
+    }
+#endif
+    aws_mutex_lock(&reader->lock);
+    s_list_push(&reader->pending, read);
+    aws_condition_variable_notify_one(&reader->work_available);
+    aws_mutex_unlock(&reader->lock);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_checksums_file_reader_wait(struct aws_checksums_file_reader *reader, struct aws_checksums_read **completed) {
+#ifdef AWS_CHECKSUMS_HAVE_IO_URING
+    if (reader->ring) {
+        return aws_checksums_uring_wait(reader->ring, completed);
+    }
+#endif
+    aws_mutex_lock(&reader->lock);
+    aws_condition_variable_wait_pred(&reader->read_completed, &reader->lock, s_has_completed, reader);
+    *completed = s_list_pop(&reader->completed);
+    aws_mutex_unlock(&reader->lock);
+    return AWS_OP_SUCCESS;
+}
+
+void aws_checksums_file_reader_destroy(struct aws_checksums_file_reader *reader) {
+#ifdef AWS_CHECKSUMS_HAVE_IO_URING
+    if (reader->ring) {
+        aws_checksums_uring_destroy(reader->ring);
+        close(reader->fd);
+        aws_mem_release(reader->allocator, reader);
+        return;
+    }
+#endif
+    s_stop_pool(reader);
+    aws_mem_release(reader->allocator, reader->threads);
+    aws_condition_variable_clean_up(&reader->read_completed);
+    aws_condition_variable_clean_up(&reader->work_available);
+    aws_mutex_clean_up(&reader->lock);
+    close(reader->fd);
+    aws_mem_release(reader->allocator, reader);
+}
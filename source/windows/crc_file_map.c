@@ -0,0 +1,18 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_file.h>
+
+#include <aws/common/common.h>
+
+/* Not mapped on Windows yet, aws_checksums_file_crc() reads the file through a buffer instead. */
+int aws_checksums_file_map(const char *path, struct aws_checksums_file_mapping *mapping) {
+    (void)path;
+    (void)mapping;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+void aws_checksums_file_unmap(struct aws_checksums_file_mapping *mapping) {
+    (void)mapping;
+}
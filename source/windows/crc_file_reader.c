@@ -0,0 +1,37 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/checksums/private/crc_file_reader.h>
+
+#include <aws/common/common.h>
+
+/* No overlapped I/O reader on Windows yet, aws_checksums_file_crc_stream() reports the operation as unsupported. */
+struct aws_checksums_file_reader *aws_checksums_file_reader_new(
+    struct aws_allocator *allocator,
+    const char *path,
+    const struct aws_checksums_file_reader_options *options,
+    struct aws_checksums_file_reader_info *info) {
+    (void)allocator;
+    (void)path;
+    (void)options;
+    (void)info;
+    aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    return NULL;
+}
+
+int aws_checksums_file_reader_submit(struct aws_checksums_file_reader *reader, struct aws_checksums_read *read) {
+    (void)reader;
+    (void)read;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+int aws_checksums_file_reader_wait(struct aws_checksums_file_reader *reader, struct aws_checksums_read **completed) {
+    (void)reader;
+    (void)completed;
+    return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+}
+
+void aws_checksums_file_reader_destroy(struct aws_checksums_file_reader *reader) {
+    (void)reader;
+}
@@ -0,0 +1,146 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/block_index.h>
+
+#include <aws/common/file.h>
+#include <aws/testing/aws_test_harness.h>
+
+#include <stdio.h>
+
+#include "crc_test_util.h"
+
+typedef uint32_t(crc_fn)(const uint8_t *input, int length, uint32_t previous_crc);
+
+static int s_test_crc_block_index(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    char path[TEST_PATH_SIZE];
+    ASSERT_SUCCESS(s_init_test_path(path, "aws_checksums_block_index_test"));
+
+    /* not a multiple of the block size, so the last block is short */
+    const size_t length = 10 * 1000 + 123;
+    const uint32_t block_size = 1000;
+    uint8_t *data = aws_mem_acquire(allocator, length);
+    s_fill_test_bytes(data, length, 0xC0FFEE11);
+
+    size_t index_size = 0;
+    ASSERT_SUCCESS(aws_checksums_block_index_compute_size(length, block_size, &index_size));
+    ASSERT_UINT_EQUALS(AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE + 11 * 4, index_size);
+
+    uint8_t *storage = aws_mem_acquire(allocator, index_size);
+    for (int algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+        crc_fn *crc = algorithm == AWS_CHECKSUMS_CRC32 ? aws_checksums_crc32 : aws_checksums_crc32c;
+
+        struct aws_byte_buf output = aws_byte_buf_from_empty_array(storage, index_size - 1);
+        ASSERT_FAILS(aws_checksums_block_index_build(algorithm, data, length, block_size, &output));
+        ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+        output = aws_byte_buf_from_empty_array(storage, index_size);
+        ASSERT_SUCCESS(aws_checksums_block_index_build(algorithm, data, length, block_size, &output));
+        ASSERT_UINT_EQUALS(index_size, output.len);
+
+        struct aws_checksums_block_index index;
+        ASSERT_SUCCESS(aws_checksums_block_index_parse(aws_byte_cursor_from_buf(&output), &index));
+        ASSERT_INT_EQUALS(algorithm, index.algorithm);
+        ASSERT_UINT_EQUALS(block_size, index.block_size);
+        ASSERT_UINT_EQUALS(length, index.object_length);
+        ASSERT_UINT_EQUALS(11, index.block_count);
+        ASSERT_HEX_EQUALS(crc(data, (int)length, 0), index.object_crc);
+        for (uint64_t block = 0; block < index.block_count; ++block) {
+            size_t start = (size_t)block * block_size;
+            int block_length = (int)(length - start < block_size ? length - start : block_size);
+            ASSERT_HEX_EQUALS(
+                crc(data + start, block_length, 0), aws_checksums_block_index_get_block_crc(&index, block));
+        }
+
+        /* ranges starting and ending inside, at and around block boundaries, within one block and across many */
+        const size_t points[] = {0, 1, 999, 1000, 1001, 2500, 5000, 9999, 10000, 10001, 10122, 10123};
+        for (size_t a = 0; a < AWS_ARRAY_SIZE(points); ++a) {
+            for (size_t b = a; b < AWS_ARRAY_SIZE(points); ++b) {
+                uint64_t offset = points[a];
+                uint64_t range_length = points[b] - points[a];
+                uint32_t expected = crc(data + offset, (int)range_length, 0);
+                uint32_t range_crc = 0;
+                ASSERT_SUCCESS(
+                    aws_checksums_block_index_range_crc(&index, offset, range_length, data + offset, &range_crc));
+                ASSERT_HEX_EQUALS(expected, range_crc, "range %zu-%zu", points[a], points[b]);
+
+                /* only block aligned ranges can be verified */
+                bool aligned = offset % block_size == 0 && (points[b] % block_size == 0 || points[b] == length);
+                bool matches = false;
+                if (!aligned) {
+                    ASSERT_FAILS(aws_checksums_block_index_verify_range(
+                        &index, offset, range_length, data + offset, &matches));
+                    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+                    continue;
+                }
+                ASSERT_SUCCESS(
+                    aws_checksums_block_index_verify_range(&index, offset, range_length, data + offset, &matches));
+                ASSERT_TRUE(matches, "range %zu-%zu", points[a], points[b]);
+            }
+        }
+
+        /* damage in the first block, an interior block, or the short last block of a range is caught */
+        const size_t damaged[] = {2000, 4567, 9999, 10100};
+        for (size_t d = 0; d < AWS_ARRAY_SIZE(damaged); ++d) {
+            data[damaged[d]] ^= 0x04;
+            bool matches = true;
+            ASSERT_SUCCESS(aws_checksums_block_index_verify_range(&index, 2000, length - 2000, data + 2000, &matches));
+            ASSERT_FALSE(matches, "damaged byte %zu", damaged[d]);
+            /* a range not covering the damaged block still verifies */
+            ASSERT_SUCCESS(aws_checksums_block_index_verify_range(&index, 0, 2000, data, &matches));
+            ASSERT_TRUE(matches);
+            data[damaged[d]] ^= 0x04;
+        }
+
+        /* whole blocks come from the index alone, the data isn't touched */
+        uint32_t range_crc = 0;
+        ASSERT_SUCCESS(aws_checksums_block_index_range_crc(&index, 2000, 5000, NULL, &range_crc));
+        ASSERT_HEX_EQUALS(crc(data + 2000, 5000, 0), range_crc);
+        ASSERT_SUCCESS(aws_checksums_block_index_range_crc(&index, 10000, 123, NULL, &range_crc));
+        ASSERT_HEX_EQUALS(crc(data + 10000, 123, 0), range_crc);
+
+        ASSERT_FAILS(aws_checksums_block_index_range_crc(&index, 10000, 124, data, &range_crc));
+        ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+        /* the file builder produces the same bytes */
+        FILE *file = aws_fopen(path, "wb");
+        ASSERT_NOT_NULL(file);
+        ASSERT_UINT_EQUALS(length, fwrite(data, 1, length, file));
+        ASSERT_INT_EQUALS(0, fclose(file));
+
+        struct aws_byte_buf file_index;
+        ASSERT_SUCCESS(
+            aws_checksums_block_index_build_file(allocator, path, algorithm, block_size, &file_index));
+        ASSERT_BIN_ARRAYS_EQUALS(output.buffer, output.len, file_index.buffer, file_index.len);
+        aws_byte_buf_clean_up(&file_index);
+    }
+    remove(path);
+
+    /* a damaged header or a truncated entry table is rejected */
+    struct aws_checksums_block_index index;
+    storage[9] ^= 0x01;
+    ASSERT_FAILS(aws_checksums_block_index_parse(aws_byte_cursor_from_array(storage, index_size), &index));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    storage[9] ^= 0x01;
+    ASSERT_FAILS(aws_checksums_block_index_parse(aws_byte_cursor_from_array(storage, index_size - 1), &index));
+    ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+    ASSERT_SUCCESS(aws_checksums_block_index_parse(aws_byte_cursor_from_array(storage, index_size), &index));
+
+    /* an empty object has a header and no entries */
+    uint8_t empty_storage[AWS_CHECKSUMS_BLOCK_INDEX_HEADER_SIZE];
+    struct aws_byte_buf empty = aws_byte_buf_from_empty_array(empty_storage, sizeof(empty_storage));
+    ASSERT_SUCCESS(aws_checksums_block_index_build(AWS_CHECKSUMS_CRC32C, NULL, 0, 4096, &empty));
+    ASSERT_SUCCESS(aws_checksums_block_index_parse(aws_byte_cursor_from_buf(&empty), &index));
+    ASSERT_UINT_EQUALS(0, index.block_count);
+    ASSERT_HEX_EQUALS(0, index.object_crc);
+
+    ASSERT_FAILS(aws_checksums_block_index_compute_size(length, 0, &index_size));
+
+    aws_mem_release(allocator, storage);
+    aws_mem_release(allocator, data);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_block_index, s_test_crc_block_index)
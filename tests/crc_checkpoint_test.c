@@ -0,0 +1,110 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/checkpoint.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#include "crc_test_util.h"
+
+static int s_test_crc_checkpoint(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    uint8_t data[10000];
+    s_fill_test_bytes(data, sizeof(data), 0x2545F491);
+
+    /* the layout is part of the format: check the bytes, not just the round trip */
+    struct aws_checksums_checkpoint checkpoint;
+    ASSERT_SUCCESS(aws_checksums_checkpoint_init(&checkpoint, AWS_CHECKSUMS_CRC32C));
+    ASSERT_SUCCESS(aws_checksums_checkpoint_update(&checkpoint, (const uint8_t *)"1234", 4));
+    ASSERT_SUCCESS(aws_checksums_checkpoint_update(&checkpoint, (const uint8_t *)"56789", 5));
+    ASSERT_HEX_EQUALS(0xE3069283, checkpoint.crc);
+    ASSERT_UINT_EQUALS(9, checkpoint.length);
+
+    uint8_t storage[2 * AWS_CHECKSUMS_CHECKPOINT_SIZE];
+    struct aws_byte_buf buffer = aws_byte_buf_from_empty_array(storage, sizeof(storage));
+    ASSERT_SUCCESS(aws_checksums_checkpoint_encode(&checkpoint, &buffer));
+    ASSERT_UINT_EQUALS(AWS_CHECKSUMS_CHECKPOINT_SIZE, buffer.len);
+    const uint8_t expected_body[] = {
+        'A', 'C', 'K', 'P', 1, AWS_CHECKSUMS_CRC32C, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0xE3, 0x06, 0x92, 0x83};
+    ASSERT_BIN_ARRAYS_EQUALS(expected_body, sizeof(expected_body), storage, sizeof(expected_body));
+    const uint32_t integrity = aws_checksums_crc32c(expected_body, sizeof(expected_body), 0);
+    ASSERT_UINT_EQUALS(integrity >> 24, storage[20]);
+    ASSERT_UINT_EQUALS(integrity & 0xFF, storage[23]);
+
+    struct aws_checksums_checkpoint decoded;
+    struct aws_byte_cursor cursor = aws_byte_cursor_from_buf(&buffer);
+    ASSERT_SUCCESS(aws_checksums_checkpoint_decode(&cursor, &decoded));
+    ASSERT_UINT_EQUALS(0, cursor.len);
+    ASSERT_INT_EQUALS(AWS_CHECKSUMS_CRC32C, decoded.algorithm);
+    ASSERT_HEX_EQUALS(checkpoint.crc, decoded.crc);
+    ASSERT_UINT_EQUALS(checkpoint.length, decoded.length);
+
+    /* truncated, then every single bit flip, is rejected without consuming the input */
+    cursor = aws_byte_cursor_from_array(storage, AWS_CHECKSUMS_CHECKPOINT_SIZE - 1);
+    ASSERT_FAILS(aws_checksums_checkpoint_decode(&cursor, &decoded));
+    ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+    for (size_t bit = 0; bit < 8 * AWS_CHECKSUMS_CHECKPOINT_SIZE; ++bit) {
+        storage[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        cursor = aws_byte_cursor_from_array(storage, AWS_CHECKSUMS_CHECKPOINT_SIZE);
+        ASSERT_FAILS(aws_checksums_checkpoint_decode(&cursor, &decoded), "bit %zu", bit);
+        ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+        ASSERT_UINT_EQUALS(AWS_CHECKSUMS_CHECKPOINT_SIZE, cursor.len);
+        storage[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+    }
+
+    /* shards checksummed separately, persisted, restored and merged give the crc of the whole */
+    const size_t splits[] = {0, 1, 333, 4096, 9999, 10000};
+    for (int algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+        struct aws_checksums_checkpoint whole;
+        ASSERT_SUCCESS(aws_checksums_checkpoint_init(&whole, algorithm));
+        ASSERT_SUCCESS(aws_checksums_checkpoint_update(&whole, data, sizeof(data)));
+
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(splits); ++i) {
+            struct aws_checksums_checkpoint shards[2];
+            ASSERT_SUCCESS(aws_checksums_checkpoint_init(&shards[0], algorithm));
+            ASSERT_SUCCESS(aws_checksums_checkpoint_init(&shards[1], algorithm));
+            ASSERT_SUCCESS(aws_checksums_checkpoint_update(&shards[0], data, splits[i]));
+            ASSERT_SUCCESS(aws_checksums_checkpoint_update(&shards[1], data + splits[i], sizeof(data) - splits[i]));
+
+            buffer = aws_byte_buf_from_empty_array(storage, sizeof(storage));
+            ASSERT_SUCCESS(aws_checksums_checkpoint_encode(&shards[0], &buffer));
+            ASSERT_SUCCESS(aws_checksums_checkpoint_encode(&shards[1], &buffer));
+            ASSERT_FAILS(aws_checksums_checkpoint_encode(&shards[1], &buffer));
+            ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+
+            struct aws_checksums_checkpoint restored[2];
+            cursor = aws_byte_cursor_from_buf(&buffer);
+            ASSERT_SUCCESS(aws_checksums_checkpoint_decode(&cursor, &restored[0]));
+            ASSERT_SUCCESS(aws_checksums_checkpoint_decode(&cursor, &restored[1]));
+
+            ASSERT_SUCCESS(aws_checksums_checkpoint_merge(&restored[0], &restored[1], &restored[0]));
+            ASSERT_HEX_EQUALS(whole.crc, restored[0].crc);
+            ASSERT_UINT_EQUALS(whole.length, restored[0].length);
+
+            /* a resumed stream continues from the restored state */
+            struct aws_checksums_checkpoint resumed = shards[0];
+            ASSERT_SUCCESS(aws_checksums_checkpoint_update(&resumed, data + splits[i], sizeof(data) - splits[i]));
+            ASSERT_HEX_EQUALS(whole.crc, resumed.crc);
+        }
+    }
+
+    struct aws_checksums_checkpoint crc32_checkpoint;
+    ASSERT_SUCCESS(aws_checksums_checkpoint_init(&crc32_checkpoint, AWS_CHECKSUMS_CRC32));
+    ASSERT_FAILS(aws_checksums_checkpoint_merge(&checkpoint, &crc32_checkpoint, &decoded));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    ASSERT_FAILS(aws_checksums_checkpoint_init(&decoded, AWS_CHECKSUMS_CRC_ALGORITHM_COUNT));
+
+    crc32_checkpoint.length = UINT64_MAX;
+    struct aws_checksums_checkpoint one_byte;
+    ASSERT_SUCCESS(aws_checksums_checkpoint_init(&one_byte, AWS_CHECKSUMS_CRC32));
+    ASSERT_SUCCESS(aws_checksums_checkpoint_update(&one_byte, data, 1));
+    ASSERT_FAILS(aws_checksums_checkpoint_merge(&crc32_checkpoint, &one_byte, &decoded));
+    ASSERT_INT_EQUALS(AWS_ERROR_OVERFLOW_DETECTED, aws_last_error());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_checkpoint, s_test_crc_checkpoint)
@@ -0,0 +1,145 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/event_stream.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#define EVENT_STREAM_TEST_FRAMES 8
+
+static void s_write_u32(uint8_t *bytes, uint32_t value) {
+    bytes[0] = (uint8_t)(value >> 24);
+    bytes[1] = (uint8_t)(value >> 16);
+    bytes[2] = (uint8_t)(value >> 8);
+    bytes[3] = (uint8_t)value;
+}
+
+/* frames a message of headers_length + payload_length filler bytes at out, returning its length */
+static size_t s_build_message(uint8_t *out, uint32_t headers_length, uint32_t payload_length, uint8_t seed) {
+    uint32_t total_length = headers_length + payload_length + AWS_CHECKSUMS_EVENT_STREAM_MIN_MESSAGE_SIZE;
+    s_write_u32(out, total_length);
+    s_write_u32(out + 4, headers_length);
+    /* the crc fields are garbage until filled in */
+    memset(out + 8, 0xAA, 4);
+    memset(out + total_length - 4, 0xAA, 4);
+    for (uint32_t i = 0; i < headers_length + payload_length; ++i) {
+        out[AWS_CHECKSUMS_EVENT_STREAM_PRELUDE_SIZE + i] = (uint8_t)(seed + i * 7);
+    }
+
+    uint32_t prelude_crc = 0;
+    uint32_t message_crc = 0;
+    aws_checksums_event_stream_compute_crcs(out, total_length, &prelude_crc, &message_crc);
+    s_write_u32(out + 8, prelude_crc);
+    s_write_u32(out + total_length - 4, message_crc);
+    return total_length;
+}
+
+static int s_test_crc_event_stream(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    /* the empty message of the event-stream test vectors */
+    const uint8_t empty_message[] = {
+        0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc2, 0x48, 0xeb, 0x7d, 0x98, 0xc8, 0xff};
+    uint32_t prelude_crc = 0;
+    uint32_t message_crc = 0;
+    ASSERT_SUCCESS(
+        aws_checksums_event_stream_compute_crcs(empty_message, sizeof(empty_message), &prelude_crc, &message_crc));
+    ASSERT_HEX_EQUALS(0x05c248eb, prelude_crc);
+    ASSERT_HEX_EQUALS(0x7d98c8ff, message_crc);
+    ASSERT_FAILS(aws_checksums_event_stream_compute_crcs(empty_message, 15, &prelude_crc, &message_crc));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    /* a built message agrees with the two pass computation and validates, exposing headers and payload */
+    const size_t capacity = 64 * 1024;
+    uint8_t *stream = aws_mem_acquire(allocator, capacity);
+    size_t length = s_build_message(stream, 37, 1000, 3);
+    prelude_crc = aws_checksums_crc32(stream, 8, 0);
+    message_crc = aws_checksums_crc32(stream, (int)length - 4, 0);
+
+    struct aws_checksums_event_stream_frame frame;
+    struct aws_byte_cursor input = aws_byte_cursor_from_array(stream, length);
+    ASSERT_SUCCESS(aws_checksums_event_stream_validate(&input, &frame));
+    ASSERT_UINT_EQUALS(0, input.len);
+    ASSERT_TRUE(frame.prelude_crc_matches);
+    ASSERT_TRUE(frame.message_crc_matches);
+    ASSERT_HEX_EQUALS(prelude_crc, frame.prelude_crc);
+    ASSERT_HEX_EQUALS(message_crc, frame.message_crc);
+    ASSERT_UINT_EQUALS(length, frame.total_length);
+    ASSERT_UINT_EQUALS(37, frame.headers_length);
+    ASSERT_PTR_EQUALS(stream + 12, frame.headers.ptr);
+    ASSERT_UINT_EQUALS(37, frame.headers.len);
+    ASSERT_PTR_EQUALS(stream + 12 + 37, frame.payload.ptr);
+    ASSERT_UINT_EQUALS(1000, frame.payload.len);
+
+    /* a truncated message is left for later */
+    input = aws_byte_cursor_from_array(stream, length - 1);
+    ASSERT_FAILS(aws_checksums_event_stream_validate(&input, &frame));
+    ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+    ASSERT_UINT_EQUALS(length - 1, input.len);
+
+    /* a damaged payload fails the message crc only, a damaged length fails the prelude crc and isn't consumed */
+    stream[500] ^= 0x10;
+    input = aws_byte_cursor_from_array(stream, length);
+    ASSERT_SUCCESS(aws_checksums_event_stream_validate(&input, &frame));
+    ASSERT_TRUE(frame.prelude_crc_matches);
+    ASSERT_FALSE(frame.message_crc_matches);
+    ASSERT_UINT_EQUALS(0, input.len);
+    stream[500] ^= 0x10;
+    stream[2] ^= 0x01;
+    input = aws_byte_cursor_from_array(stream, length);
+    ASSERT_SUCCESS(aws_checksums_event_stream_validate(&input, &frame));
+    ASSERT_FALSE(frame.prelude_crc_matches);
+    ASSERT_FALSE(frame.message_crc_matches);
+    ASSERT_UINT_EQUALS(length, input.len);
+    stream[2] ^= 0x01;
+
+    /* lengths that don't add up, with a valid prelude crc */
+    uint8_t bad[16];
+    memcpy(bad, empty_message, sizeof(bad));
+    s_write_u32(bad + 4, 1);
+    s_write_u32(bad + 8, aws_checksums_crc32(bad, 8, 0));
+    input = aws_byte_cursor_from_array(bad, sizeof(bad));
+    ASSERT_FAILS(aws_checksums_event_stream_validate(&input, &frame));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    /* back to back messages of all sizes, fed with a partial message at the end */
+    size_t offsets[EVENT_STREAM_TEST_FRAMES + 1];
+    length = 0;
+    for (size_t i = 0; i < EVENT_STREAM_TEST_FRAMES; ++i) {
+        offsets[i] = length;
+        length += s_build_message(stream + length, (uint32_t)(i * 11), (uint32_t)(i * i * 97), (uint8_t)i);
+    }
+    offsets[EVENT_STREAM_TEST_FRAMES] = length;
+
+    struct aws_checksums_event_stream_frame frames[EVENT_STREAM_TEST_FRAMES];
+    size_t frame_count = 0;
+    input = aws_byte_cursor_from_array(stream, length - 5);
+    ASSERT_SUCCESS(aws_checksums_event_stream_validate_batch(&input, frames, EVENT_STREAM_TEST_FRAMES, &frame_count));
+    ASSERT_UINT_EQUALS(EVENT_STREAM_TEST_FRAMES - 1, frame_count);
+    ASSERT_PTR_EQUALS(stream + offsets[EVENT_STREAM_TEST_FRAMES - 1], input.ptr);
+    for (size_t i = 0; i < frame_count; ++i) {
+        ASSERT_TRUE(frames[i].prelude_crc_matches && frames[i].message_crc_matches);
+        ASSERT_UINT_EQUALS(offsets[i + 1] - offsets[i], frames[i].total_length);
+        ASSERT_HEX_EQUALS(
+            aws_checksums_crc32(stream + offsets[i], (int)frames[i].total_length - 4, 0), frames[i].message_crc);
+    }
+
+    /* the capacity limits a call, and a bad message ends the batch as its last frame */
+    input = aws_byte_cursor_from_array(stream, length);
+    ASSERT_SUCCESS(aws_checksums_event_stream_validate_batch(&input, frames, 3, &frame_count));
+    ASSERT_UINT_EQUALS(3, frame_count);
+    ASSERT_PTR_EQUALS(stream + offsets[3], input.ptr);
+
+    stream[offsets[5] + 13] ^= 0x80;
+    ASSERT_SUCCESS(aws_checksums_event_stream_validate_batch(&input, frames, EVENT_STREAM_TEST_FRAMES, &frame_count));
+    ASSERT_UINT_EQUALS(3, frame_count);
+    ASSERT_TRUE(frames[1].message_crc_matches);
+    ASSERT_FALSE(frames[2].message_crc_matches);
+    ASSERT_PTR_EQUALS(stream + offsets[6], input.ptr);
+
+    aws_mem_release(allocator, stream);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_event_stream, s_test_crc_event_stream)
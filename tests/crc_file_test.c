@@ -0,0 +1,153 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/file.h>
+
+#include <aws/common/file.h>
+#include <aws/testing/aws_test_harness.h>
+
+#include <stdio.h>
+
+#include "crc_test_util.h"
+
+static int s_write_test_file(const char *path, const uint8_t *data, size_t length) {
+    FILE *file = aws_fopen(path, "wb");
+    ASSERT_NOT_NULL(file);
+    ASSERT_UINT_EQUALS(length, fwrite(data, 1, length, file));
+    ASSERT_INT_EQUALS(0, fclose(file));
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_crc_file(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    char path[TEST_PATH_SIZE];
+    ASSERT_SUCCESS(s_init_test_path(path, "aws_checksums_file_test"));
+
+    /* odd sized, so the per-thread ranges don't split evenly */
+    const size_t length = 3 * 1024 * 1024 + 4097;
+    uint8_t *data = aws_mem_acquire(allocator, length);
+    s_fill_test_bytes(data, length, 0x12345678);
+    ASSERT_SUCCESS(s_write_test_file(path, data, length));
+
+    const uint32_t expected[] = {
+        aws_checksums_crc32(data, (int)length, 0),
+        aws_checksums_crc32c(data, (int)length, 0),
+    };
+    const struct aws_checksums_file_options configurations[] = {
+        {.thread_count = 1},
+        {.thread_count = 4, .min_bytes_per_thread = 64 * 1024},
+        {.thread_count = 7, .min_bytes_per_thread = 1},
+        {.force_buffered = true},
+    };
+
+    for (int algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+        uint32_t crc = 0;
+        ASSERT_SUCCESS(aws_checksums_file_crc(allocator, path, algorithm, NULL, &crc));
+        ASSERT_HEX_EQUALS(expected[algorithm], crc);
+
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(configurations); ++i) {
+            crc = 0;
+            ASSERT_SUCCESS(aws_checksums_file_crc(allocator, path, algorithm, &configurations[i], &crc));
+            ASSERT_HEX_EQUALS(expected[algorithm], crc, "algorithm %d configuration %zu", algorithm, i);
+        }
+    }
+
+    /* empty files can't be mapped and take the buffered path */
+    ASSERT_SUCCESS(s_write_test_file(path, data, 0));
+    uint32_t crc = 0xFFFFFFFF;
+    ASSERT_SUCCESS(aws_checksums_file_crc(allocator, path, AWS_CHECKSUMS_CRC32C, NULL, &crc));
+    ASSERT_HEX_EQUALS(0, crc);
+
+    ASSERT_FAILS(aws_checksums_file_crc(allocator, path, AWS_CHECKSUMS_CRC_ALGORITHM_COUNT, NULL, &crc));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    remove(path);
+    ASSERT_FAILS(aws_checksums_file_crc(allocator, path, AWS_CHECKSUMS_CRC32C, NULL, &crc));
+
+    aws_mem_release(allocator, data);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_file, s_test_crc_file)
+
+static int s_test_crc_file_stream(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    char path[TEST_PATH_SIZE];
+    ASSERT_SUCCESS(s_init_test_path(path, "aws_checksums_file_test"));
+
+    /* not a multiple of the block size nor of the O_DIRECT alignment */
+    const size_t length = 1024 * 1024 + 12345;
+    uint8_t *data = aws_mem_acquire(allocator, length);
+    for (size_t i = 0; i < length; ++i) {
+        data[i] = (uint8_t)(i * 7 + (i >> 11));
+    }
+    ASSERT_SUCCESS(s_write_test_file(path, data, length));
+
+    const uint32_t expected[] = {
+        aws_checksums_crc32(data, (int)length, 0),
+        aws_checksums_crc32c(data, (int)length, 0),
+    };
+    const struct aws_checksums_file_stream_options configurations[] = {
+        {.queue_depth = 1, .block_size = 4096},
+        {.queue_depth = 3, .block_size = 64 * 1024},
+        {.queue_depth = 4, .block_size = 5000, .disable_io_uring = true},
+        {.queue_depth = 16, .block_size = 128 * 1024, .disable_direct_io = true},
+        {.disable_direct_io = true, .disable_io_uring = true},
+    };
+
+    /* platforms without a reader (Windows) report the operation as unsupported */
+    uint32_t crc = 0;
+    if (aws_checksums_file_crc_stream(allocator, path, AWS_CHECKSUMS_CRC32C, NULL, &crc, NULL) &&
+        aws_last_error() == AWS_ERROR_UNSUPPORTED_OPERATION) {
+        remove(path);
+        aws_mem_release(allocator, data);
+        return AWS_OP_SKIP;
+    }
+
+    for (int algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+        struct aws_checksums_file_stream_stats stats;
+        ASSERT_SUCCESS(aws_checksums_file_crc_stream(allocator, path, algorithm, NULL, &crc, &stats));
+        ASSERT_HEX_EQUALS(expected[algorithm], crc);
+        ASSERT_UINT_EQUALS(length, stats.bytes);
+
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(configurations); ++i) {
+            crc = 0;
+            ASSERT_SUCCESS(
+                aws_checksums_file_crc_stream(allocator, path, algorithm, &configurations[i], &crc, &stats));
+            ASSERT_HEX_EQUALS(expected[algorithm], crc, "algorithm %d configuration %zu", algorithm, i);
+            ASSERT_UINT_EQUALS(length, stats.bytes);
+            /* at least one read per block, blocks being rounded up to 4 KiB */
+            size_t block_size = configurations[i].block_size ? configurations[i].block_size
+                                                             : AWS_CHECKSUMS_FILE_STREAM_DEFAULT_BLOCK_SIZE;
+            block_size = (block_size + 4095) / 4096 * 4096;
+            ASSERT_TRUE(stats.reads >= (length + block_size - 1) / block_size);
+            ASSERT_TRUE(stats.elapsed_ns >= stats.checksum_ns);
+            if (configurations[i].disable_io_uring) {
+                ASSERT_FALSE(stats.io_uring);
+            }
+            if (configurations[i].disable_direct_io) {
+                ASSERT_FALSE(stats.direct_io);
+            }
+        }
+    }
+
+    /* buffers for queue_depth blocks that don't fit in a size_t */
+    const struct aws_checksums_file_stream_options huge = {.queue_depth = SIZE_MAX / 4096, .block_size = 8192};
+    ASSERT_FAILS(aws_checksums_file_crc_stream(allocator, path, AWS_CHECKSUMS_CRC32C, &huge, &crc, NULL));
+    ASSERT_INT_EQUALS(AWS_ERROR_OVERFLOW_DETECTED, aws_last_error());
+
+    ASSERT_SUCCESS(s_write_test_file(path, data, 0));
+    crc = 0xFFFFFFFF;
+    ASSERT_SUCCESS(aws_checksums_file_crc_stream(allocator, path, AWS_CHECKSUMS_CRC32C, NULL, &crc, NULL));
+    ASSERT_HEX_EQUALS(0, crc);
+
+    remove(path);
+    ASSERT_FAILS(aws_checksums_file_crc_stream(allocator, path, AWS_CHECKSUMS_CRC32C, NULL, &crc, NULL));
+
+    aws_mem_release(allocator, data);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_file_stream, s_test_crc_file_stream)
@@ -0,0 +1,161 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/header.h>
+
+#include <aws/common/encoding.h>
+#include <aws/testing/aws_test_harness.h>
+
+#include "crc_test_util.h"
+
+#define HEADER_TEST_BATCH 100
+
+static int s_test_crc_header(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    const uint8_t check[] = "123456789";
+    uint8_t storage[AWS_CHECKSUMS_HEADER_VALUE_SIZE * HEADER_TEST_BATCH];
+
+    ASSERT_UINT_EQUALS(0, aws_checksums_header_name(AWS_CHECKSUMS_CRC_ALGORITHM_COUNT).len);
+    struct aws_byte_cursor name = aws_checksums_header_name(AWS_CHECKSUMS_CRC32C);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&name, "x-amz-checksum-crc32c"));
+    name = aws_checksums_header_name(AWS_CHECKSUMS_CRC32);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&name, "x-amz-checksum-crc32"));
+
+    /* the check values of both algorithms */
+    struct aws_byte_buf output = aws_byte_buf_from_empty_array(storage, sizeof(storage));
+    ASSERT_SUCCESS(aws_checksums_header_value_compute(AWS_CHECKSUMS_CRC32C, check, 9, &output));
+    ASSERT_SUCCESS(aws_checksums_header_value_compute(AWS_CHECKSUMS_CRC32, check, 9, &output));
+    ASSERT_BIN_ARRAYS_EQUALS("4waSgw==y/Q5Jg==", 16, output.buffer, output.len);
+
+    bool matches = false;
+    ASSERT_SUCCESS(aws_checksums_header_value_verify(
+        AWS_CHECKSUMS_CRC32C, check, 9, aws_byte_cursor_from_c_str(" 4waSgw==\t"), &matches));
+    ASSERT_TRUE(matches);
+    ASSERT_SUCCESS(aws_checksums_header_value_verify(
+        AWS_CHECKSUMS_CRC32C, check, 8, aws_byte_cursor_from_c_str("4waSgw=="), &matches));
+    ASSERT_FALSE(matches);
+    ASSERT_FAILS(aws_checksums_header_value_verify(
+        AWS_CHECKSUMS_CRC_ALGORITHM_COUNT, check, 9, aws_byte_cursor_from_c_str("4waSgw=="), &matches));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    /* agrees with the generic base64 encoder in both directions, one value at a time and in a batch */
+    uint32_t crcs[HEADER_TEST_BATCH];
+    uint32_t state = 0x8BADF00D;
+    for (size_t i = 0; i < HEADER_TEST_BATCH; ++i) {
+        uint32_t value = s_next_test_value(&state);
+        crcs[i] = i == 0 ? 0 : i == 1 ? 0xFFFFFFFF : value;
+    }
+    output = aws_byte_buf_from_empty_array(storage, sizeof(storage));
+    ASSERT_SUCCESS(aws_checksums_header_value_encode_batch(crcs, HEADER_TEST_BATCH, &output));
+    ASSERT_UINT_EQUALS(sizeof(storage), output.len);
+
+    struct aws_byte_cursor values[HEADER_TEST_BATCH];
+    for (size_t i = 0; i < HEADER_TEST_BATCH; ++i) {
+        uint8_t bytes[4] = {
+            (uint8_t)(crcs[i] >> 24), (uint8_t)(crcs[i] >> 16), (uint8_t)(crcs[i] >> 8), (uint8_t)crcs[i]};
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(bytes, 4);
+        uint8_t expected_storage[AWS_CHECKSUMS_HEADER_VALUE_SIZE + 1];
+        struct aws_byte_buf expected = aws_byte_buf_from_empty_array(expected_storage, sizeof(expected_storage));
+        ASSERT_SUCCESS(aws_base64_encode(&to_encode, &expected));
+        ASSERT_UINT_EQUALS(AWS_CHECKSUMS_HEADER_VALUE_SIZE, expected.len);
+
+        uint8_t single_storage[AWS_CHECKSUMS_HEADER_VALUE_SIZE];
+        struct aws_byte_buf single = aws_byte_buf_from_empty_array(single_storage, sizeof(single_storage));
+        ASSERT_SUCCESS(aws_checksums_header_value_encode(crcs[i], &single));
+        ASSERT_BIN_ARRAYS_EQUALS(expected.buffer, expected.len, single.buffer, single.len);
+        ASSERT_FAILS(aws_checksums_header_value_encode(crcs[i], &single));
+        ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+
+        values[i] = aws_byte_cursor_from_array(storage + i * AWS_CHECKSUMS_HEADER_VALUE_SIZE, 8);
+        ASSERT_BIN_ARRAYS_EQUALS(expected.buffer, expected.len, values[i].ptr, values[i].len);
+    }
+
+    uint32_t decoded[HEADER_TEST_BATCH];
+    ASSERT_SUCCESS(aws_checksums_header_value_decode_batch(values, HEADER_TEST_BATCH, decoded));
+    ASSERT_BIN_ARRAYS_EQUALS(crcs, sizeof(crcs), decoded, sizeof(decoded));
+
+    output.len = sizeof(storage) - 1;
+    ASSERT_FAILS(aws_checksums_header_value_encode_batch(crcs, 1, &output));
+    ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+    ASSERT_UINT_EQUALS(sizeof(storage) - 1, output.len);
+
+    /* anything but the canonical 8 characters is rejected */
+    const char *malformed[] = {
+        "",
+        "4waSgw=",
+        "4waSgw===",
+        "4waSgw",
+        "4waS gw==",
+        "4waSg!==",
+        "4waSgx==", /* non-zero padding bits */
+        "4waSgw=A",
+        "4waSgwAA",
+        "4waSgw==,",
+    };
+    uint32_t crc = 0;
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(malformed); ++i) {
+        struct aws_byte_cursor value = aws_byte_cursor_from_c_str(malformed[i]);
+        ASSERT_FAILS(aws_checksums_header_value_decode(value, &crc), "%s", malformed[i]);
+        ASSERT_INT_EQUALS(AWS_ERROR_INVALID_BASE64_STR, aws_last_error());
+    }
+    values[3] = aws_byte_cursor_from_c_str("4waSg!==");
+    ASSERT_FAILS(aws_checksums_header_value_decode_batch(values, HEADER_TEST_BATCH, decoded));
+    ASSERT_HEX_EQUALS(crcs[2], decoded[2]);
+
+    /* the composite form of a multipart upload, e.g. the crc32c of "123456789" uploaded as parts of 4 */
+    uint8_t composite_storage[AWS_CHECKSUMS_HEADER_COMPOSITE_VALUE_MAX_SIZE];
+    output = aws_byte_buf_from_empty_array(composite_storage, sizeof(composite_storage));
+    ASSERT_SUCCESS(aws_checksums_header_value_encode_composite(0xb9256a70, 3, &output));
+    ASSERT_BIN_ARRAYS_EQUALS("uSVqcA==-3", 10, output.buffer, output.len);
+    output.len = 0;
+    ASSERT_SUCCESS(aws_checksums_header_value_encode_composite(0xFFFFFFFF, SIZE_MAX, &output));
+    ASSERT_UINT_EQUALS(AWS_CHECKSUMS_HEADER_VALUE_SIZE + 1 + (SIZE_MAX > UINT32_MAX ? 20 : 10), output.len);
+    size_t part_count = 0;
+    ASSERT_SUCCESS(aws_checksums_header_value_decode_composite(aws_byte_cursor_from_buf(&output), &crc, &part_count));
+    ASSERT_HEX_EQUALS(0xFFFFFFFF, crc);
+    ASSERT_UINT_EQUALS(SIZE_MAX, part_count);
+
+    output.len = 0;
+    ASSERT_FAILS(aws_checksums_header_value_encode_composite(0, 0, &output));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    output = aws_byte_buf_from_empty_array(composite_storage, 11);
+    ASSERT_FAILS(aws_checksums_header_value_encode_composite(0, 100, &output));
+    ASSERT_INT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+    ASSERT_UINT_EQUALS(0, output.len);
+
+    ASSERT_SUCCESS(aws_checksums_header_value_decode_composite(
+        aws_byte_cursor_from_c_str(" uSVqcA==-10000\t"), &crc, &part_count));
+    ASSERT_HEX_EQUALS(0xb9256a70, crc);
+    ASSERT_UINT_EQUALS(10000, part_count);
+    ASSERT_SUCCESS(
+        aws_checksums_header_value_decode_composite(aws_byte_cursor_from_c_str("4waSgw=="), &crc, &part_count));
+    ASSERT_HEX_EQUALS(0xe3069283, crc);
+    ASSERT_UINT_EQUALS(0, part_count);
+
+    const char *malformed_composite[] = {
+        "uSVqcA==-",
+        "uSVqcA==-0",
+        "uSVqcA==-03",
+        "uSVqcA==-3a",
+        "uSVqcA==- 3",
+        "uSVqcA==+3",
+        "uSVqcA=-3",
+        "uSVqcx==-3",
+        "uSVqcA==-99999999999999999999999",
+    };
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(malformed_composite); ++i) {
+        struct aws_byte_cursor value = aws_byte_cursor_from_c_str(malformed_composite[i]);
+        ASSERT_FAILS(
+            aws_checksums_header_value_decode_composite(value, &crc, &part_count), "%s", malformed_composite[i]);
+        ASSERT_INT_EQUALS(AWS_ERROR_INVALID_BASE64_STR, aws_last_error());
+    }
+    /* the plain decoder still takes only the 8 characters */
+    ASSERT_FAILS(aws_checksums_header_value_decode(aws_byte_cursor_from_c_str("uSVqcA==-3"), &crc));
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_header, s_test_crc_header)
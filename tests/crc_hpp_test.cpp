@@ -0,0 +1,74 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.hpp>
+
+#include <cstdio>
+#include <vector>
+
+using namespace Aws::Checksums;
+
+/* the check values of the crc catalogue, evaluated by the compiler */
+static_assert(Crc32::Literal("123456789") == 0xCBF43926u, "crc32 check value");
+static_assert(Crc32c::Literal("123456789") == 0xE3069283u, "crc32c check value");
+static_assert(Crc64Nvme::Literal("123456789") == 0xAE8B14860A799888ull, "crc64nvme check value");
+static_assert(Crc32c::Literal("") == 0, "empty input");
+static_assert(Crc32c::Literal("56789", Crc32c::Literal("1234")) == 0xE3069283u, "chained constexpr crc");
+
+static int s_failures = 0;
+
+#define CHECK_EQUAL(expected, actual)                                                                                  \
+    do {                                                                                                               \
+        unsigned long long e = (expected);                                                                             \
+        unsigned long long a = (actual);                                                                               \
+        if (e != a) {                                                                                                  \
+            fprintf(stderr, "%s:%d: expected 0x%llx, got 0x%llx\n", __FILE__, __LINE__, e, a);                         \
+            ++s_failures;                                                                                              \
+        }                                                                                                              \
+    } while (0)
+
+template <typename Poly> static void s_check_runtime_matches_constexpr(const std::vector<char> &data) {
+    using ValueType = typename Poly::ValueType;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data.data());
+
+    for (size_t length = 0; length <= data.size(); ++length) {
+        ValueType expected = Crc<Poly>::Constexpr(data.data(), length, 0x1234);
+        CHECK_EQUAL(expected, Crc<Poly>::Checksum(bytes, length, 0x1234));
+
+        /* split at every point the streaming hasher must agree */
+        for (size_t split = 0; split <= length; ++split) {
+            CrcHasher<Poly> hasher(0x1234);
+            hasher.Update(bytes, split).Update(bytes + split, length - split);
+            CHECK_EQUAL(expected, hasher.Value());
+        }
+    }
+}
+
+int main() {
+    std::vector<char> data(200);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i * 131 + 7);
+    }
+
+    s_check_runtime_matches_constexpr<Crc32Polynomial>(data);
+    s_check_runtime_matches_constexpr<Crc32cPolynomial>(data);
+    s_check_runtime_matches_constexpr<Crc64NvmePolynomial>(data);
+
+    /* the C++ wrappers and the C API are the same computation */
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data.data());
+    CHECK_EQUAL(aws_checksums_crc32(bytes, 200, 0), Crc32::Checksum(bytes, 200));
+    CHECK_EQUAL(aws_checksums_crc32c(bytes, 200, 0), Crc32c::Checksum(bytes, 200));
+
+    Crc32cHasher hasher;
+    hasher.Update("1234", 4);
+    hasher.Reset();
+    CHECK_EQUAL(0xE3069283u, hasher.Update("123456789", 9).Value());
+
+    if (s_failures) {
+        fprintf(stderr, "%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/*
+ * crc_test.c checks crc_inline.h as the test target is compiled, which outside a fixed ISA build is the fallback that
+ * calls into the library. This file is compiled with the crc instruction flags (see tests/CMakeLists.txt) so the
+ * instruction loops and the x86 carry-less multiply reductions get checked too, on hosts that can run them.
+ */
+#include <aws/checksums/crc.h>
+#include <aws/checksums/crc_inline.h>
+#include <aws/checksums/private/crc_priv.h>
+
+#include <aws/common/cpuid.h>
+#include <aws/testing/aws_test_harness.h>
+
+static bool s_can_run_inline_isa(void) {
+#if defined(AWS_CHECKSUMS_INLINE_CRC32_CLMUL)
+    return aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) && aws_cpu_has_feature(AWS_CPU_FEATURE_CLMUL);
+#elif defined(AWS_CHECKSUMS_INLINE_CRC32C_INSTRUCTIONS)
+    return aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) || aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC);
+#else
+    /* built without the flags (MSVC, 32 bit targets), crc_test.c already covers the fallback */
+    return false;
+#endif
+}
+
+static int s_test_crc_inline_isa(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    if (!s_can_run_inline_isa()) {
+        return AWS_OP_SKIP;
+    }
+
+    uint8_t buffer[80];
+    for (size_t i = 0; i < sizeof(buffer); ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t length = 0; length <= 64; ++length) {
+            const uint8_t *input = buffer + offset;
+            ASSERT_HEX_EQUALS(
+                aws_checksums_crc32_sw(input, (int)length, 0x1234),
+                aws_checksums_crc32_inline(input, (int)length, 0x1234),
+                "crc32_inline offset %zu length %zu",
+                offset,
+                length);
+            ASSERT_HEX_EQUALS(
+                aws_checksums_crc32c_sw(input, (int)length, 0x1234),
+                aws_checksums_crc32c_inline(input, (int)length, 0x1234),
+                "crc32c_inline offset %zu length %zu",
+                offset,
+                length);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_inline_isa, s_test_crc_inline_isa)
+
+static int s_test_crc_inline_isa_fixed_width(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    if (!s_can_run_inline_isa()) {
+        return AWS_OP_SKIP;
+    }
+
+    uint8_t buffer[24];
+    for (size_t i = 0; i < sizeof(buffer); ++i) {
+        buffer[i] = (uint8_t)(i * 37 + 201);
+    }
+
+    const uint32_t previous[] = {0, 0x1234, 0xFFFFFFFF};
+    for (size_t p = 0; p < AWS_ARRAY_SIZE(previous); ++p) {
+        for (size_t offset = 0; offset < 8; ++offset) {
+            const uint8_t *input = buffer + offset;
+            const uint32_t prev = previous[p];
+
+            ASSERT_HEX_EQUALS(aws_checksums_crc32_sw(input, 4, prev), aws_checksums_crc32_u32(input, prev));
+            ASSERT_HEX_EQUALS(aws_checksums_crc32_sw(input, 8, prev), aws_checksums_crc32_u64(input, prev));
+            ASSERT_HEX_EQUALS(aws_checksums_crc32_sw(input, 12, prev), aws_checksums_crc32_u96(input, prev));
+            ASSERT_HEX_EQUALS(aws_checksums_crc32_sw(input, 16, prev), aws_checksums_crc32_u128(input, prev));
+
+            ASSERT_HEX_EQUALS(aws_checksums_crc32c_sw(input, 4, prev), aws_checksums_crc32c_u32(input, prev));
+            ASSERT_HEX_EQUALS(aws_checksums_crc32c_sw(input, 8, prev), aws_checksums_crc32c_u64(input, prev));
+            ASSERT_HEX_EQUALS(aws_checksums_crc32c_sw(input, 12, prev), aws_checksums_crc32c_u96(input, prev));
+            ASSERT_HEX_EQUALS(aws_checksums_crc32c_sw(input, 16, prev), aws_checksums_crc32c_u128(input, prev));
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_inline_isa_fixed_width, s_test_crc_inline_isa_fixed_width)
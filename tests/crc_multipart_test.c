@@ -0,0 +1,84 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/multipart.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#include "crc_test_util.h"
+
+typedef uint32_t(crc_fn)(const uint8_t *input, int length, uint32_t previous_crc);
+
+static int s_check_multipart(
+    enum aws_checksums_crc_algorithm algorithm,
+    crc_fn *crc,
+    const uint8_t *data,
+    const size_t *part_lengths,
+    size_t part_count) {
+
+    struct aws_checksums_part parts[400];
+    uint8_t part_crc_bytes[4 * AWS_ARRAY_SIZE(parts)];
+    AWS_FATAL_ASSERT(part_count <= AWS_ARRAY_SIZE(parts));
+
+    size_t offset = 0;
+    for (size_t i = 0; i < part_count; ++i) {
+        parts[i].crc = crc(data + offset, (int)part_lengths[i], 0);
+        parts[i].length = part_lengths[i];
+        part_crc_bytes[4 * i] = (uint8_t)(parts[i].crc >> 24);
+        part_crc_bytes[4 * i + 1] = (uint8_t)(parts[i].crc >> 16);
+        part_crc_bytes[4 * i + 2] = (uint8_t)(parts[i].crc >> 8);
+        part_crc_bytes[4 * i + 3] = (uint8_t)parts[i].crc;
+        offset += part_lengths[i];
+    }
+
+    struct aws_checksums_multipart_crc result;
+    ASSERT_SUCCESS(aws_checksums_multipart_crc_compute(algorithm, parts, part_count, &result));
+    ASSERT_HEX_EQUALS(crc(data, (int)offset, 0), result.full_object_crc);
+    ASSERT_HEX_EQUALS(crc(part_crc_bytes, (int)(4 * part_count), 0), result.composite_crc);
+    ASSERT_UINT_EQUALS(offset, result.total_length);
+    ASSERT_UINT_EQUALS(part_count, result.part_count);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_crc_multipart(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const size_t length = 400 * 1000;
+    uint8_t *data = aws_mem_acquire(allocator, length);
+    s_fill_test_bytes(data, length, 0x9E3779B9);
+
+    /* equal parts with a short last one, as uploaders split; more parts than one composite batch */
+    size_t uniform[300];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(uniform); ++i) {
+        uniform[i] = i + 1 == AWS_ARRAY_SIZE(uniform) ? 617 : 1300;
+    }
+    /* uneven and empty parts, the shift changes from one part to the next */
+    const size_t uneven[] = {1, 0, 4096, 3, 3, 3, 65536, 0, 777, 10000, 1};
+    const size_t single[] = {12345};
+
+    for (int algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+        crc_fn *crc = algorithm == AWS_CHECKSUMS_CRC32 ? aws_checksums_crc32 : aws_checksums_crc32c;
+        ASSERT_SUCCESS(s_check_multipart(algorithm, crc, data, uniform, AWS_ARRAY_SIZE(uniform)));
+        ASSERT_SUCCESS(s_check_multipart(algorithm, crc, data, uneven, AWS_ARRAY_SIZE(uneven)));
+        ASSERT_SUCCESS(s_check_multipart(algorithm, crc, data, single, AWS_ARRAY_SIZE(single)));
+
+        struct aws_checksums_multipart_crc result;
+        ASSERT_SUCCESS(aws_checksums_multipart_crc_compute(algorithm, NULL, 0, &result));
+        ASSERT_HEX_EQUALS(0, result.full_object_crc);
+        ASSERT_HEX_EQUALS(0, result.composite_crc);
+        ASSERT_UINT_EQUALS(0, result.part_count);
+    }
+
+    struct aws_checksums_multipart_crc result;
+    struct aws_checksums_part part = {.crc = 0, .length = 0};
+    ASSERT_FAILS(aws_checksums_multipart_crc_compute(AWS_CHECKSUMS_CRC_ALGORITHM_COUNT, &part, 1, &result));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    ASSERT_FAILS(aws_checksums_multipart_crc_compute(AWS_CHECKSUMS_CRC32C, NULL, 1, &result));
+    ASSERT_FAILS(aws_checksums_multipart_crc_compute(AWS_CHECKSUMS_CRC32C, &part, 1, NULL));
+
+    aws_mem_release(allocator, data);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_multipart, s_test_crc_multipart)
@@ -0,0 +1,158 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/rolling.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#include "crc_test_util.h"
+
+typedef uint32_t(crc_fn)(const uint8_t *input, int length, uint32_t previous_crc);
+
+#define ROLLING_TEST_MAX_CHUNKS 256
+
+static int s_check_chunks(
+    crc_fn *crc,
+    const uint8_t *data,
+    size_t length,
+    const struct aws_checksums_chunk *chunks,
+    size_t chunk_count) {
+
+    uint64_t offset = 0;
+    for (size_t i = 0; i < chunk_count; ++i) {
+        ASSERT_UINT_EQUALS(offset, chunks[i].offset);
+        ASSERT_HEX_EQUALS(crc(data + offset, (int)chunks[i].length, 0), chunks[i].crc, "chunk %zu", i);
+        offset += chunks[i].length;
+    }
+    ASSERT_UINT_EQUALS(length, offset);
+    return AWS_OP_SUCCESS;
+}
+
+/* feeds data in pieces of at most piece bytes with room for at most capacity chunks per call, collecting all chunks */
+static int s_chunk_all(
+    struct aws_checksums_rolling_crc *rolling,
+    const uint8_t *data,
+    size_t length,
+    size_t piece,
+    size_t capacity,
+    struct aws_checksums_chunk *chunks,
+    size_t *out_chunk_count) {
+
+    size_t chunk_count = 0;
+    size_t position = 0;
+    while (position < length) {
+        size_t input_length = length - position < piece ? length - position : piece;
+        size_t room = ROLLING_TEST_MAX_CHUNKS - chunk_count;
+        size_t found = 0;
+        size_t consumed = aws_checksums_rolling_crc_find_chunks(
+            rolling, data + position, input_length, chunks + chunk_count, room < capacity ? room : capacity, &found);
+        ASSERT_TRUE(consumed <= input_length);
+        ASSERT_TRUE(consumed == input_length || found == capacity);
+        position += consumed;
+        chunk_count += found;
+    }
+    if (aws_checksums_rolling_crc_finish(rolling, &chunks[chunk_count])) {
+        ++chunk_count;
+    }
+    *out_chunk_count = chunk_count;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_crc_rolling(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const size_t length = 64 * 1024 + 77;
+    uint8_t *data = aws_mem_acquire(allocator, length);
+    s_fill_test_bytes(data, length, 0x5EED1234);
+    struct aws_checksums_chunk *whole = aws_mem_calloc(allocator, ROLLING_TEST_MAX_CHUNKS, sizeof(*whole));
+    struct aws_checksums_chunk *pieces = aws_mem_calloc(allocator, ROLLING_TEST_MAX_CHUNKS, sizeof(*pieces));
+
+    for (int algorithm = 0; algorithm < AWS_CHECKSUMS_CRC_ALGORITHM_COUNT; ++algorithm) {
+        crc_fn *crc = algorithm == AWS_CHECKSUMS_CRC32 ? aws_checksums_crc32 : aws_checksums_crc32c;
+
+        struct aws_checksums_rolling_crc_options options = {
+            .algorithm = algorithm,
+            .window_size = 48,
+            .boundary_mask = 0x3FF,
+            .min_chunk_size = 256,
+            .max_chunk_size = 4096,
+        };
+        struct aws_checksums_rolling_crc *rolling = aws_checksums_rolling_crc_new(allocator, &options);
+        ASSERT_NOT_NULL(rolling);
+
+        /* the window starts as zeros, then is exactly the crc of the last window_size bytes, however it is fed */
+        uint8_t zeros[48] = {0};
+        ASSERT_HEX_EQUALS(crc(zeros, 48, 0), aws_checksums_rolling_crc_update(rolling, NULL, 0));
+        uint8_t partial[48] = {0};
+        memcpy(partial + 48 - 5, data, 5);
+        ASSERT_HEX_EQUALS(crc(partial, 48, 0), aws_checksums_rolling_crc_update(rolling, data, 5));
+        size_t position = 5;
+        const size_t steps[] = {43, 1, 7, 47, 48, 49, 300, 2};
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(steps); ++i) {
+            uint32_t window_crc = aws_checksums_rolling_crc_update(rolling, data + position, steps[i]);
+            position += steps[i];
+            ASSERT_HEX_EQUALS(crc(data + position - 48, 48, 0), window_crc, "after %zu bytes", position);
+        }
+
+        /* one call, then many small pieces with crossing windows and chunks, then a limited chunk capacity */
+        aws_checksums_rolling_crc_reset(rolling);
+        size_t whole_count = 0;
+        ASSERT_SUCCESS(s_chunk_all(rolling, data, length, length, ROLLING_TEST_MAX_CHUNKS, whole, &whole_count));
+        ASSERT_SUCCESS(s_check_chunks(crc, data, length, whole, whole_count));
+        ASSERT_TRUE(whole_count > 16);
+
+        size_t max_cuts = 0;
+        for (size_t i = 0; i < whole_count; ++i) {
+            ASSERT_TRUE(whole[i].length <= options.max_chunk_size);
+            ASSERT_TRUE(whole[i].length >= options.min_chunk_size || i == whole_count - 1);
+            if (i != whole_count - 1) {
+                uint64_t end = whole[i].offset + whole[i].length;
+                uint32_t window_crc = crc(data + end - 48, 48, 0);
+                ASSERT_TRUE((window_crc & options.boundary_mask) == 0 || whole[i].length == options.max_chunk_size);
+                max_cuts += whole[i].length == options.max_chunk_size;
+            }
+        }
+        ASSERT_TRUE(max_cuts < whole_count);
+
+        const size_t piece_sizes[] = {1, 13, 47, 1000, 4097};
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(piece_sizes); ++i) {
+            size_t pieces_count = 0;
+            ASSERT_SUCCESS(s_chunk_all(rolling, data, length, piece_sizes[i], 3, pieces, &pieces_count));
+            ASSERT_UINT_EQUALS(whole_count, pieces_count);
+            ASSERT_BIN_ARRAYS_EQUALS(whole, whole_count * sizeof(*whole), pieces, pieces_count * sizeof(*pieces));
+        }
+
+        /* with no boundary ever matching, chunks are cut at max_chunk_size */
+        aws_checksums_rolling_crc_destroy(rolling);
+        options.boundary_mask = 0xFFFFFFFF;
+        options.min_chunk_size = 4096;
+        rolling = aws_checksums_rolling_crc_new(allocator, &options);
+        ASSERT_NOT_NULL(rolling);
+        ASSERT_SUCCESS(s_chunk_all(rolling, data, length, length, 1, pieces, &whole_count));
+        ASSERT_UINT_EQUALS(length / 4096 + 1, whole_count);
+        ASSERT_SUCCESS(s_check_chunks(crc, data, length, pieces, whole_count));
+        struct aws_checksums_chunk last;
+        ASSERT_FALSE(aws_checksums_rolling_crc_finish(rolling, &last));
+        aws_checksums_rolling_crc_destroy(rolling);
+    }
+
+    struct aws_checksums_rolling_crc_options bad_options = {
+        .algorithm = AWS_CHECKSUMS_CRC32C,
+        .window_size = 0,
+    };
+    ASSERT_NULL(aws_checksums_rolling_crc_new(allocator, &bad_options));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    bad_options.window_size = 32;
+    bad_options.min_chunk_size = 100;
+    bad_options.max_chunk_size = 99;
+    ASSERT_NULL(aws_checksums_rolling_crc_new(allocator, &bad_options));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    aws_mem_release(allocator, pieces);
+    aws_mem_release(allocator, whole);
+    aws_mem_release(allocator, data);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_rolling, s_test_crc_rolling)
@@ -0,0 +1,61 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+#include <aws/checksums/stats.h>
+#include <aws/testing/aws_test_harness.h>
+
+static uint64_t s_total_calls(const struct aws_checksums_stats *stats, enum aws_checksums_crc_algorithm algorithm) {
+    uint64_t calls = 0;
+    for (size_t kernel = 0; kernel < AWS_CHECKSUMS_KERNEL_COUNT; ++kernel) {
+        calls += stats->kernels[algorithm][kernel].calls;
+    }
+    return calls;
+}
+
+static uint64_t s_size_class_calls(
+    const struct aws_checksums_stats *stats,
+    enum aws_checksums_crc_algorithm algorithm,
+    size_t size_class) {
+    uint64_t calls = 0;
+    for (size_t kernel = 0; kernel < AWS_CHECKSUMS_KERNEL_COUNT; ++kernel) {
+        calls += stats->kernels[algorithm][kernel].size_class_calls[size_class];
+    }
+    return calls;
+}
+
+/* Counters are only compiled in with AWS_CHECKSUMS_ENABLE_STATS; without it the snapshot says so and this skips. */
+static int s_test_crc_stats(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    struct aws_checksums_stats before;
+    if (aws_checksums_stats_snapshot(&before)) {
+        ASSERT_INT_EQUALS(AWS_ERROR_UNSUPPORTED_OPERATION, aws_last_error());
+        return AWS_OP_SKIP;
+    }
+
+    uint8_t buffer[100] = {0};
+    aws_checksums_crc32c(buffer, sizeof(buffer), 0);
+    aws_checksums_crc32c(buffer, 8, 0);
+    aws_checksums_crc32(buffer, 0, 0);
+
+    struct aws_checksums_stats after;
+    ASSERT_SUCCESS(aws_checksums_stats_snapshot(&after));
+
+    ASSERT_UINT_EQUALS(2, s_total_calls(&after, AWS_CHECKSUMS_CRC32C) - s_total_calls(&before, AWS_CHECKSUMS_CRC32C));
+    ASSERT_UINT_EQUALS(1, s_total_calls(&after, AWS_CHECKSUMS_CRC32) - s_total_calls(&before, AWS_CHECKSUMS_CRC32));
+
+    /* 100 bytes lands in [64, 128), 8 bytes in [8, 16), 0 bytes in class 0 */
+    ASSERT_UINT_EQUALS(
+        1, s_size_class_calls(&after, AWS_CHECKSUMS_CRC32C, 7) - s_size_class_calls(&before, AWS_CHECKSUMS_CRC32C, 7));
+    ASSERT_UINT_EQUALS(
+        1, s_size_class_calls(&after, AWS_CHECKSUMS_CRC32C, 4) - s_size_class_calls(&before, AWS_CHECKSUMS_CRC32C, 4));
+    ASSERT_UINT_EQUALS(
+        1, s_size_class_calls(&after, AWS_CHECKSUMS_CRC32, 0) - s_size_class_calls(&before, AWS_CHECKSUMS_CRC32, 0));
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_stats, s_test_crc_stats)
@@ -4,7 +4,10 @@
  */
 
 #include <aws/checksums/crc.h>
+#include <aws/checksums/crc_inline.h>
 #include <aws/checksums/private/crc_priv.h>
+
+#include <aws/common/cpuid.h>
 #include <aws/testing/aws_test_harness.h>
 
 static const uint8_t DATA_32_ZEROS[32] = {0};
@@ -115,3 +118,405 @@ static int s_test_crc32(struct aws_allocator *allocator, void *ctx) {
     return res;
 }
 AWS_TEST_CASE(test_crc32, s_test_crc32)
+
+/* one bit at a time reference, independent of every table in the library */
+static uint32_t s_crc_bitwise(const uint8_t *input, size_t length, uint32_t previous_crc, uint32_t reflected_poly) {
+    uint32_t crc = ~previous_crc;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= input[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (reflected_poly & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/* Long inputs take the braided kernel in the sw path; check it across alignments and around its length threshold. */
+static int s_test_crc_sw_long_inputs(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    size_t buffer_size = 4096 + 8;
+    uint8_t *buffer = aws_mem_acquire(allocator, buffer_size);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t length = 600; length <= 4096; length += 97) {
+            const uint8_t *input = buffer + offset;
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0xEDB88320),
+                aws_checksums_crc32_sw(input, (int)length, 0x1234),
+                "crc32_sw offset %zu length %zu",
+                offset,
+                length);
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0x82F63B78),
+                aws_checksums_crc32c_sw(input, (int)length, 0x1234),
+                "crc32c_sw offset %zu length %zu",
+                offset,
+                length);
+            ASSERT_HEX_EQUALS(
+                aws_checksums_crc32c_sw(input, (int)length, 0), aws_checksums_crc32c(input, (int)length, 0));
+            ASSERT_HEX_EQUALS(
+                aws_checksums_crc32_sw(input, (int)length, 0), aws_checksums_crc32(input, (int)length, 0));
+        }
+    }
+
+    aws_mem_release(allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_sw_long_inputs, s_test_crc_sw_long_inputs)
+
+/* The pshufb kernels work in 4 KiB (SSSE3) and 8 KiB (AVX2) blocks with a table driven tail; cover both block sizes,
+ * tails and misaligned inputs. They fall back to the reference implementation where unavailable. */
+static int s_test_crc_pshufb(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    size_t buffer_size = 3 * 8192 + 512 + 8;
+    uint8_t *buffer = aws_mem_acquire(allocator, buffer_size);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    const size_t lengths[] = {4095, 4096, 4097, 8191, 8192, 8192 + 4096 + 100, 3 * 8192 + 512};
+    for (size_t offset = 0; offset < 8; offset += 3) {
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(lengths); ++i) {
+            const uint8_t *input = buffer + offset;
+            size_t length = lengths[i];
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0xEDB88320),
+                aws_checksums_crc32_pshufb(input, (int)length, 0x1234),
+                "crc32_pshufb offset %zu length %zu",
+                offset,
+                length);
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0x82F63B78),
+                aws_checksums_crc32c_pshufb(input, (int)length, 0x1234),
+                "crc32c_pshufb offset %zu length %zu",
+                offset,
+                length);
+        }
+    }
+
+    aws_mem_release(allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_pshufb, s_test_crc_pshufb)
+
+/* The crc instruction kernel takes 3072, 1024 and 256 byte blocks of three stripes, then 8 byte steps, with single
+ * bytes before the first aligned word and after the last; cover every boundary around those and misaligned inputs.
+ * Only run where the cpu has the instructions. */
+static int s_test_crc_hw(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    if (!aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) && !aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC)) {
+        return AWS_OP_SKIP;
+    }
+
+    size_t buffer_size = 2 * 3072 + 1024 + 512 + 8;
+    uint8_t *buffer = aws_mem_acquire(allocator, buffer_size);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    for (size_t offset = 0; offset < 8; offset += 3) {
+        for (size_t length = 0; length <= buffer_size - 8; length += (length < 300 ? 1 : 89)) {
+            const uint8_t *input = buffer + offset;
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0x82F63B78),
+                aws_checksums_crc32c_hw(input, (int)length, 0x1234),
+                "crc32c_hw offset %zu length %zu",
+                offset,
+                length);
+        }
+    }
+
+    aws_mem_release(allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_hw, s_test_crc_hw)
+
+/* The folding kernels take 64 (PCLMULQDQ) or 256 (AVX-512) byte steps, then 16 byte steps, then a table driven tail;
+ * cover every boundary around those and misaligned inputs. They fall back to the reference implementation where
+ * unavailable. */
+static int s_test_crc_clmul(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    size_t buffer_size = 4096 + 8;
+    uint8_t *buffer = aws_mem_acquire(allocator, buffer_size);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    for (size_t offset = 0; offset < 8; offset += 3) {
+        for (size_t length = 0; length <= 4096; length += (length < 600 ? 1 : 61)) {
+            const uint8_t *input = buffer + offset;
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0xEDB88320),
+                aws_checksums_crc32_clmul(input, (int)length, 0x1234),
+                "crc32_clmul offset %zu length %zu",
+                offset,
+                length);
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0x82F63B78),
+                aws_checksums_crc32c_clmul(input, (int)length, 0x1234),
+                "crc32c_clmul offset %zu length %zu",
+                offset,
+                length);
+        }
+    }
+
+    aws_mem_release(allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_clmul, s_test_crc_clmul)
+
+/* The header-inline kernels are instruction loops or calls into the library depending on the flags this file is
+ * compiled with; both must match the reference, including on misaligned inputs. */
+static int s_test_crc_inline(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    ASSERT_HEX_EQUALS(KNOWN_CRC32_TEST_VECTOR, aws_checksums_crc32_inline(TEST_VECTOR, sizeof(TEST_VECTOR), 0));
+    ASSERT_HEX_EQUALS(KNOWN_CRC32C_TEST_VECTOR, aws_checksums_crc32c_inline(TEST_VECTOR, sizeof(TEST_VECTOR), 0));
+
+    uint8_t buffer[80];
+    for (size_t i = 0; i < sizeof(buffer); ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t length = 0; length <= 64; ++length) {
+            const uint8_t *input = buffer + offset;
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0xEDB88320),
+                aws_checksums_crc32_inline(input, (int)length, 0x1234),
+                "crc32_inline offset %zu length %zu",
+                offset,
+                length);
+            ASSERT_HEX_EQUALS(
+                s_crc_bitwise(input, length, 0x1234, 0x82F63B78),
+                aws_checksums_crc32c_inline(input, (int)length, 0x1234),
+                "crc32c_inline offset %zu length %zu",
+                offset,
+                length);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_inline, s_test_crc_inline)
+
+static int s_test_crc_inline_fixed_width(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    uint8_t buffer[24];
+    for (size_t i = 0; i < sizeof(buffer); ++i) {
+        buffer[i] = (uint8_t)(i * 37 + 201);
+    }
+
+    const uint32_t previous[] = {0, 0x1234, 0xFFFFFFFF};
+    for (size_t p = 0; p < AWS_ARRAY_SIZE(previous); ++p) {
+        for (size_t offset = 0; offset < 8; ++offset) {
+            const uint8_t *input = buffer + offset;
+            const uint32_t prev = previous[p];
+
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 4, prev, 0xEDB88320), aws_checksums_crc32_u32(input, prev));
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 8, prev, 0xEDB88320), aws_checksums_crc32_u64(input, prev));
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 12, prev, 0xEDB88320), aws_checksums_crc32_u96(input, prev));
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 16, prev, 0xEDB88320), aws_checksums_crc32_u128(input, prev));
+
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 4, prev, 0x82F63B78), aws_checksums_crc32c_u32(input, prev));
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 8, prev, 0x82F63B78), aws_checksums_crc32c_u64(input, prev));
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 12, prev, 0x82F63B78), aws_checksums_crc32c_u96(input, prev));
+            ASSERT_HEX_EQUALS(s_crc_bitwise(input, 16, prev, 0x82F63B78), aws_checksums_crc32c_u128(input, prev));
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_inline_fixed_width, s_test_crc_inline_fixed_width)
+
+static int s_test_crc_hash_keys(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    const size_t key_sizes[] = {0, 1, 4, 7, 8, 12, 16, 24, 33};
+    const size_t max_count = 11;
+    uint8_t keys[33 * 11];
+    for (size_t i = 0; i < sizeof(keys); ++i) {
+        keys[i] = (uint8_t)(i * 29 + 3);
+    }
+
+    /* the lane kernel executes crc instructions unconditionally, only call it where the cpu has them */
+    const bool has_hw = aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) || aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC);
+    uint32_t hashes[11];
+    uint32_t hashes_sw[11];
+    uint32_t hashes_hw[11];
+    for (size_t k = 0; k < AWS_ARRAY_SIZE(key_sizes); ++k) {
+        const size_t key_size = key_sizes[k];
+        /* counts around the 4 key groups, with a sentinel after the last hash */
+        for (size_t count = 0; count < max_count; ++count) {
+            hashes[count] = 0xDEADBEEF;
+            hashes_hw[count] = 0xDEADBEEF;
+            aws_checksums_crc32c_hash_keys(keys, key_size, count, 0x1234, hashes);
+            aws_checksums_crc32c_hash_keys_sw(keys, key_size, count, 0x1234, hashes_sw);
+            if (has_hw) {
+                aws_checksums_crc32c_hash_keys_hw(keys, key_size, count, 0x1234, hashes_hw);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t expected = s_crc_bitwise(keys + i * key_size, key_size, 0x1234, 0x82F63B78);
+                ASSERT_HEX_EQUALS(expected, hashes[i], "key_size %zu count %zu key %zu", key_size, count, i);
+                ASSERT_HEX_EQUALS(expected, hashes_sw[i], "key_size %zu count %zu key %zu", key_size, count, i);
+                if (has_hw) {
+                    ASSERT_HEX_EQUALS(expected, hashes_hw[i], "key_size %zu count %zu key %zu", key_size, count, i);
+                }
+            }
+            ASSERT_HEX_EQUALS(0xDEADBEEF, hashes[count]);
+            ASSERT_HEX_EQUALS(0xDEADBEEF, hashes_hw[count]);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_hash_keys, s_test_crc_hash_keys)
+
+static int s_test_crc_combine(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    uint8_t buffer[300];
+    for (size_t i = 0; i < sizeof(buffer); ++i) {
+        buffer[i] = (uint8_t)(i * 97 + 13);
+    }
+
+    const uint32_t crc32 = aws_checksums_crc32(buffer, sizeof(buffer), 0);
+    const uint32_t crc32c = aws_checksums_crc32c(buffer, sizeof(buffer), 0);
+    for (size_t split = 0; split <= sizeof(buffer); split += 7) {
+        const int len_a = (int)split;
+        const int len_b = (int)(sizeof(buffer) - split);
+        ASSERT_HEX_EQUALS(
+            crc32,
+            aws_checksums_crc32_combine(
+                aws_checksums_crc32(buffer, len_a, 0), aws_checksums_crc32(buffer + split, len_b, 0), len_b));
+        ASSERT_HEX_EQUALS(
+            crc32c,
+            aws_checksums_crc32c_combine(
+                aws_checksums_crc32c(buffer, len_a, 0), aws_checksums_crc32c(buffer + split, len_b, 0), len_b));
+    }
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_combine, s_test_crc_combine)
+
+static int s_test_crc_patch(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    /* longer than one delta chunk, so patches can span several */
+    const size_t length = 4096 + 77;
+    uint8_t *buffer = aws_mem_acquire(allocator, length);
+    uint8_t *original = aws_mem_acquire(allocator, length);
+    for (size_t i = 0; i < length; ++i) {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    /* (offset, n): at the start, at the end, empty, across chunk boundaries, and the whole buffer */
+    const size_t patches[][2] = {
+        {0, 1}, {0, 64}, {length - 1, 1}, {length - 64, 64}, {1000, 0}, {100, 700}, {0, length}};
+    for (size_t p = 0; p < AWS_ARRAY_SIZE(patches); ++p) {
+        const size_t offset = patches[p][0];
+        const size_t n = patches[p][1];
+        memcpy(original, buffer, length);
+        const uint32_t old_crc32 = aws_checksums_crc32(buffer, (int)length, 0);
+        const uint32_t old_crc32c = aws_checksums_crc32c(buffer, (int)length, 0);
+
+        for (size_t i = 0; i < n; ++i) {
+            buffer[offset + i] = (uint8_t)(buffer[offset + i] * 29 + p + 1);
+        }
+
+        ASSERT_HEX_EQUALS(
+            aws_checksums_crc32(buffer, (int)length, 0),
+            aws_checksums_crc32_patch(old_crc32, length, offset, original + offset, buffer + offset, n),
+            "patch %zu",
+            p);
+        ASSERT_HEX_EQUALS(
+            aws_checksums_crc32c(buffer, (int)length, 0),
+            aws_checksums_crc32c_patch(old_crc32c, length, offset, original + offset, buffer + offset, n),
+            "patch %zu",
+            p);
+    }
+
+    aws_mem_release(allocator, original);
+    aws_mem_release(allocator, buffer);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_patch, s_test_crc_patch)
+
+static int s_test_crc_verify_batch(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    /* more records than one internal batch and not a multiple of 8, lengths equal in some groups of 4 and not others */
+    const size_t count = 150;
+    const uint8_t *buffers[150];
+    size_t lengths[150];
+    uint32_t expected_crc32[150];
+    uint32_t expected_crc32c[150];
+    uint32_t crcs[150];
+    uint32_t crcs_sw[150];
+    uint8_t *data = aws_mem_acquire(allocator, 150 * 300);
+    for (size_t i = 0; i < 150 * 300; ++i) {
+        data[i] = (uint8_t)(i * 31 + 5);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        buffers[i] = data + i * 300 + i % 3;
+        lengths[i] = i < 40 ? 64 + (i / 4) % 3 : (i * 37) % 297;
+        expected_crc32[i] = aws_checksums_crc32(buffers[i], (int)lengths[i], 0);
+        expected_crc32c[i] = aws_checksums_crc32c(buffers[i], (int)lengths[i], 0);
+    }
+
+    aws_checksums_crc32c_multi_sw(buffers, lengths, count, crcs_sw);
+    ASSERT_BIN_ARRAYS_EQUALS(expected_crc32c, sizeof(expected_crc32c), crcs_sw, sizeof(crcs_sw));
+    /* the lane kernel executes crc instructions unconditionally, only call it where the cpu has them */
+    if (aws_cpu_has_feature(AWS_CPU_FEATURE_SSE_4_2) || aws_cpu_has_feature(AWS_CPU_FEATURE_ARM_CRC)) {
+        aws_checksums_crc32c_multi_hw(buffers, lengths, count, crcs);
+        ASSERT_BIN_ARRAYS_EQUALS(expected_crc32c, sizeof(expected_crc32c), crcs, sizeof(crcs));
+    }
+
+    /* a sentinel after the (150 + 7) / 8 = 19 bitmap bytes */
+    uint8_t bitmap[20];
+    memset(bitmap, 0xAA, sizeof(bitmap));
+    ASSERT_UINT_EQUALS(0, aws_checksums_crc32_verify_batch(buffers, lengths, expected_crc32, count, bitmap));
+    ASSERT_UINT_EQUALS(0, aws_checksums_crc32c_verify_batch(buffers, lengths, expected_crc32c, count, bitmap));
+    for (size_t i = 0; i < 19; ++i) {
+        ASSERT_UINT_EQUALS(0, bitmap[i]);
+    }
+    ASSERT_UINT_EQUALS(0xAA, bitmap[19]);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i += 7) {
+        expected_crc32[i] ^= 0x100;
+        expected_crc32c[i] ^= 0x100;
+        ++mismatches;
+    }
+    ASSERT_UINT_EQUALS(mismatches, aws_checksums_crc32_verify_batch(buffers, lengths, expected_crc32, count, bitmap));
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_UINT_EQUALS(i % 7 == 0, (bitmap[i / 8] >> (i % 8)) & 1, "record %zu", i);
+    }
+    memset(bitmap, 0xAA, sizeof(bitmap));
+    ASSERT_UINT_EQUALS(
+        mismatches, aws_checksums_crc32c_verify_batch(buffers, lengths, expected_crc32c, count, bitmap));
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_UINT_EQUALS(i % 7 == 0, (bitmap[i / 8] >> (i % 8)) & 1, "record %zu", i);
+    }
+    /* the unused high bits of the last byte are cleared */
+    ASSERT_UINT_EQUALS(0, bitmap[18] >> 6);
+    ASSERT_UINT_EQUALS(0xAA, bitmap[19]);
+
+    ASSERT_UINT_EQUALS(0, aws_checksums_crc32c_verify_batch(NULL, NULL, NULL, 0, NULL));
+
+    aws_mem_release(allocator, data);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_verify_batch, s_test_crc_verify_batch)
@@ -0,0 +1,44 @@
+#ifndef AWS_CHECKSUMS_CRC_TEST_UTIL_H
+#define AWS_CHECKSUMS_CRC_TEST_UTIL_H
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/common/uuid.h>
+#include <aws/testing/aws_test_harness.h>
+
+#include <stdio.h>
+
+/* room for the longest prefix below, a uuid and the extension */
+#define TEST_PATH_SIZE 96
+
+/* the next value of the linear congruential generator the tests take their pseudo-random inputs from */
+static inline uint32_t s_next_test_value(uint32_t *state) {
+    *state = *state * 1103515245 + 12345;
+    return *state;
+}
+
+/* length bytes from that generator started at seed, its high byte each step (the low ones have short periods) */
+static inline void s_fill_test_bytes(uint8_t *data, size_t length, uint32_t seed) {
+    uint32_t state = seed;
+    for (size_t i = 0; i < length; ++i) {
+        data[i] = (uint8_t)(s_next_test_value(&state) >> 24);
+    }
+}
+
+/*
+ * A file name of its own, prefix followed by a uuid, so concurrent test runs in the same directory don't overwrite
+ * each other's file. path must hold TEST_PATH_SIZE bytes.
+ */
+static inline int s_init_test_path(char *path, const char *prefix) {
+    struct aws_uuid uuid;
+    ASSERT_SUCCESS(aws_uuid_init(&uuid));
+    char uuid_str[AWS_UUID_STR_LEN] = {0};
+    struct aws_byte_buf uuid_buf = aws_byte_buf_from_empty_array(uuid_str, sizeof(uuid_str));
+    ASSERT_SUCCESS(aws_uuid_to_str(&uuid, &uuid_buf));
+    ASSERT_TRUE(snprintf(path, TEST_PATH_SIZE, "%s_%s.bin", prefix, uuid_str) < TEST_PATH_SIZE);
+    return AWS_OP_SUCCESS;
+}
+
+#endif /* AWS_CHECKSUMS_CRC_TEST_UTIL_H */
@@ -0,0 +1,100 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/checksums/crc.h>
+#include <aws/checksums/trace.h>
+
+#include <aws/common/file.h>
+#include <aws/testing/aws_test_harness.h>
+
+#include <stdio.h>
+
+static int s_test_crc_trace_round_trip(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    const struct aws_checksums_trace_record records[] = {
+        {.algorithm = AWS_CHECKSUMS_CRC32C, .alignment = 0, .length = 0, .inter_arrival_ns = 0},
+        {.algorithm = AWS_CHECKSUMS_CRC32, .alignment = 63, .length = 127, .inter_arrival_ns = 128},
+        {.algorithm = AWS_CHECKSUMS_CRC32C, .alignment = 7, .length = UINT32_MAX, .inter_arrival_ns = UINT64_MAX},
+    };
+
+    uint8_t storage[AWS_CHECKSUMS_TRACE_HEADER_SIZE + 3 * AWS_CHECKSUMS_TRACE_RECORD_MAX_SIZE];
+    struct aws_byte_buf output = aws_byte_buf_from_empty_array(storage, sizeof(storage));
+    ASSERT_SUCCESS(aws_checksums_trace_encode_header(&output));
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(records); ++i) {
+        ASSERT_SUCCESS(aws_checksums_trace_encode_record(&records[i], &output));
+    }
+    /* 127 still fits one varint byte, 128 takes two */
+    ASSERT_UINT_EQUALS(AWS_CHECKSUMS_TRACE_HEADER_SIZE + 3 + (1 + 1 + 2) + (1 + 5 + 10), output.len);
+
+    struct aws_byte_cursor input = aws_byte_cursor_from_buf(&output);
+    ASSERT_SUCCESS(aws_checksums_trace_decode_header(&input));
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(records); ++i) {
+        struct aws_checksums_trace_record decoded;
+        ASSERT_SUCCESS(aws_checksums_trace_decode_record(&input, &decoded));
+        ASSERT_INT_EQUALS(records[i].algorithm, decoded.algorithm);
+        ASSERT_UINT_EQUALS(records[i].alignment, decoded.alignment);
+        ASSERT_UINT_EQUALS(records[i].length, decoded.length);
+        ASSERT_UINT_EQUALS(records[i].inter_arrival_ns, decoded.inter_arrival_ns);
+    }
+    ASSERT_UINT_EQUALS(0, input.len);
+
+    /* a truncated record is reported and not consumed */
+    struct aws_checksums_trace_record decoded;
+    struct aws_byte_cursor truncated =
+        aws_byte_cursor_from_array(storage + AWS_CHECKSUMS_TRACE_HEADER_SIZE + 3 + 4, 15);
+    ASSERT_ERROR(AWS_ERROR_SHORT_BUFFER, aws_checksums_trace_decode_record(&truncated, &decoded));
+    ASSERT_UINT_EQUALS(15, truncated.len);
+
+    const uint8_t not_a_trace[] = {'A', 'C', 'K', 'T', AWS_CHECKSUMS_TRACE_VERSION + 1};
+    struct aws_byte_cursor bad_header = aws_byte_cursor_from_array(not_a_trace, sizeof(not_a_trace));
+    ASSERT_ERROR(AWS_ERROR_INVALID_ARGUMENT, aws_checksums_trace_decode_header(&bad_header));
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_trace_round_trip, s_test_crc_trace_round_trip)
+
+/* Recording is only compiled in with AWS_CHECKSUMS_ENABLE_TRACE; without it starting a trace says so and this skips. */
+static int s_test_crc_trace_record(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const char *path = "aws_checksums_test.trace";
+    if (aws_checksums_trace_start(path)) {
+        ASSERT_INT_EQUALS(AWS_ERROR_UNSUPPORTED_OPERATION, aws_last_error());
+        return AWS_OP_SKIP;
+    }
+
+    ASSERT_ERROR(AWS_ERROR_INVALID_STATE, aws_checksums_trace_start(path));
+
+    uint8_t buffer[128] = {0};
+    aws_checksums_crc32c(buffer + 1, 100, 0);
+    aws_checksums_crc32(buffer, 8, 0);
+    ASSERT_SUCCESS(aws_checksums_trace_stop());
+    ASSERT_ERROR(AWS_ERROR_INVALID_STATE, aws_checksums_trace_stop());
+
+    FILE *file = aws_fopen(path, "rb");
+    ASSERT_NOT_NULL(file);
+    uint8_t *contents = aws_mem_acquire(allocator, 256);
+    size_t length = fread(contents, 1, 256, file);
+    fclose(file);
+    remove(path);
+
+    struct aws_byte_cursor input = aws_byte_cursor_from_array(contents, length);
+    struct aws_checksums_trace_record record;
+    ASSERT_SUCCESS(aws_checksums_trace_decode_header(&input));
+    ASSERT_SUCCESS(aws_checksums_trace_decode_record(&input, &record));
+    ASSERT_INT_EQUALS(AWS_CHECKSUMS_CRC32C, record.algorithm);
+    ASSERT_UINT_EQUALS(100, record.length);
+    ASSERT_UINT_EQUALS(((uintptr_t)buffer + 1) % 64, record.alignment);
+    ASSERT_SUCCESS(aws_checksums_trace_decode_record(&input, &record));
+    ASSERT_INT_EQUALS(AWS_CHECKSUMS_CRC32, record.algorithm);
+    ASSERT_UINT_EQUALS(8, record.length);
+    ASSERT_UINT_EQUALS(0, input.len);
+
+    aws_mem_release(allocator, contents);
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_crc_trace_record, s_test_crc_trace_record)